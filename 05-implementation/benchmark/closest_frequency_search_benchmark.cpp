@@ -0,0 +1,146 @@
+/**
+ * @file closest_frequency_search_benchmark.cpp
+ * @brief Closest-standard-frequency search benchmark across input distributions
+ * @traceability DES-C-001 → find_closest_standard_frequency
+ *
+ * Compares the branch-free boundary table search (standard_rate_table.hpp)
+ * with the previous exact-match / 48k-family / range-scan implementation,
+ * reproduced below, on random, sequential and hot-rate inputs.
+ */
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "src/lib/Standards/AES/AES5/2018/core/frequency_validation/standard_rate_table.hpp"
+
+using namespace AES::AES5::_2018::core::frequency_validation;
+
+namespace {
+
+/// Previous find_closest_standard_frequency() implementation (branching scans)
+uint32_t legacy_find_closest(uint32_t frequency) noexcept {
+    struct FrequencyRange {
+        uint32_t min_freq;
+        uint32_t max_freq;
+        uint32_t standard_freq;
+    };
+    static constexpr std::array<FrequencyRange, 11> FREQUENCY_LOOKUP_TABLE = {{
+        {0, 38050, 32000},        {38051, 45999, 44100},    {46000, 47499, 47952},
+        {47500, 47899, 47952},    {47900, 48150, 48000},    {48151, 68124, 48048},
+        {68125, 92100, 88200},    {92101, 136200, 96000},   {136201, 184200, 176400},
+        {184201, 288000, 192000}, {288001, UINT32_MAX, 384000}
+    }};
+    static constexpr std::array<uint32_t, 10> EXACT_STANDARDS = {
+        32000, 44100, 47952, 48000, 48048, 88200, 96000, 176400, 192000, 384000
+    };
+
+    if (frequency == 0) {
+        return 32000;
+    }
+    for (uint32_t exact_freq : EXACT_STANDARDS) {
+        if (frequency == exact_freq) {
+            return exact_freq;
+        }
+    }
+    if (frequency >= 47900 && frequency <= 48150) {
+        if (frequency <= 47976) return 47952;
+        return 48000;
+    }
+    for (const auto& range : FREQUENCY_LOOKUP_TABLE) {
+        if (frequency >= range.min_freq && frequency <= range.max_freq) {
+            return range.standard_freq;
+        }
+    }
+    return 32000;
+}
+
+} // namespace
+
+class ClosestFrequencySearchBenchmark {
+private:
+    static constexpr size_t SAMPLE_COUNT = 1 << 16;
+    static constexpr size_t PASSES = 100;
+
+public:
+    void run() {
+        std::mt19937 rng(42);
+
+        // Random: uniform over the audio range, every branch equally likely
+        std::vector<uint32_t> random_input(SAMPLE_COUNT);
+        std::uniform_int_distribution<uint32_t> uniform(8000, 400000);
+        for (auto& frequency : random_input) {
+            frequency = uniform(rng);
+        }
+
+        // Sequential: slow sweep, perfectly predictable
+        std::vector<uint32_t> sequential_input(SAMPLE_COUNT);
+        for (size_t i = 0; i < SAMPLE_COUNT; ++i) {
+            sequential_input[i] = 8000 + static_cast<uint32_t>(i * 6);
+        }
+
+        // Hot-rate: 90% 48 kHz family with drift, 10% other standard rates
+        std::vector<uint32_t> hot_input(SAMPLE_COUNT);
+        const uint32_t hot_rates[] = {47952, 48000, 48048};
+        const uint32_t cold_rates[] = {32000, 44100, 88200, 96000, 176400, 192000, 384000};
+        std::uniform_int_distribution<int> drift(-5, 5);
+        for (auto& frequency : hot_input) {
+            const bool hot = (rng() % 10) != 0;
+            const uint32_t base = hot ? hot_rates[rng() % 3] : cold_rates[rng() % 7];
+            frequency = static_cast<uint32_t>(static_cast<int>(base) + drift(rng));
+        }
+
+        run_distribution("Random", random_input);
+        run_distribution("Sequential", sequential_input);
+        run_distribution("Hot-rate (48k family)", hot_input);
+    }
+
+private:
+    void run_distribution(const char* name, const std::vector<uint32_t>& input) {
+        size_t mismatches = 0;
+        for (uint32_t frequency : input) {
+            mismatches += (legacy_find_closest(frequency) != detail::find_closest_standard_rate(frequency)) ? 1 : 0;
+        }
+
+        const double legacy_ns = measure(input, [](uint32_t f) { return legacy_find_closest(f); });
+        const double table_ns = measure(input, [](uint32_t f) { return detail::find_closest_standard_rate(f); });
+
+        std::cout << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(2)
+                  << "legacy " << std::setw(6) << legacy_ns << " ns   "
+                  << "boundary table " << std::setw(6) << table_ns << " ns   "
+                  << "speedup " << std::setprecision(1) << legacy_ns / table_ns << "x"
+                  << (mismatches == 0 ? "" : "   RESULT MISMATCH") << "\n";
+    }
+
+    template<typename Search>
+    double measure(const std::vector<uint32_t>& input, Search search) {
+        uint64_t checksum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t pass = 0; pass < PASSES; ++pass) {
+            for (uint32_t frequency : input) {
+                checksum += search(frequency);
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        sink_ += checksum;
+        return std::chrono::duration<double, std::nano>(end - start).count() /
+               static_cast<double>(input.size() * PASSES);
+    }
+
+    volatile uint64_t sink_ = 0;
+};
+
+int main() {
+    std::cout << "=== Closest Standard Frequency Search Benchmark ===\n";
+    std::cout << "Boundary table: " << detail::SEGMENT_BOUNDARIES.size()
+              << " compile-time boundaries, branch-free compare-and-count\n\n";
+
+    ClosestFrequencySearchBenchmark benchmark;
+    benchmark.run();
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file flight_recorder_benchmark.cpp
+ * @brief Cost of a FlightRecorder on FrequencyValidator::validate_frequency()
+ * @traceability DES-C-001, DES-C-005 → FlightRecorder
+ *
+ * Measures validate_frequency() per timing policy with and without an
+ * attached FlightRecorderStorage, and reports the difference. Interleaved
+ * repetitions keep frequency scaling from favouring either variant.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include "src/lib/Standards/AES/AES5/2018/core/frequency_validation/frequency_validator.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/compliance/compliance_engine.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core;
+using namespace AES::AES5::_2018::core::frequency_validation;
+using namespace AES::AES5::_2018::core::validation;
+using Clock = std::chrono::steady_clock;
+
+class FlightRecorderBenchmark {
+private:
+    static constexpr size_t ITERATIONS = 5 * 1000 * 1000;
+    static constexpr int REPETITIONS = 5;
+
+    static double ns_per_validation(const FrequencyValidator& validator) {
+        uint64_t sink = 0;
+        auto start = Clock::now();
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            sink += validator.validate_frequency(static_cast<uint32_t>(48000 + (i & 7))).closest_standard_frequency;
+        }
+        auto end = Clock::now();
+        if (sink == 42) {
+            std::cout << "";
+        }
+        return std::chrono::duration<double, std::nano>(end - start).count() / ITERATIONS;
+    }
+
+    static std::unique_ptr<FrequencyValidator> make_validator(FlightRecorder* recorder, TimingPolicy policy) {
+        auto core = std::make_unique<ValidationCore>();
+        core->attach_flight_recorder(recorder);
+        auto validator = FrequencyValidator::create(std::make_unique<compliance::ComplianceEngine>(),
+                                                    std::move(core));
+        validator->set_timing_policy(policy);
+        return validator;
+    }
+
+public:
+    struct Result {
+        double plain_ns;
+        double recorded_ns;
+    };
+
+    Result run(TimingPolicy policy) {
+        static FlightRecorderStorage<4096> recorder;
+        auto plain = make_validator(nullptr, policy);
+        auto recorded = make_validator(&recorder, policy);
+
+        // Best of several interleaved runs for each variant
+        Result result{1e9, 1e9};
+        for (int r = 0; r < REPETITIONS; ++r) {
+            const double plain_ns = ns_per_validation(*plain);
+            const double recorded_ns = ns_per_validation(*recorded);
+            result.plain_ns = plain_ns < result.plain_ns ? plain_ns : result.plain_ns;
+            result.recorded_ns = recorded_ns < result.recorded_ns ? recorded_ns : result.recorded_ns;
+        }
+        return result;
+    }
+};
+
+int main() {
+    const struct {
+        TimingPolicy policy;
+        const char* name;
+    } policies[] = {
+        {TimingPolicy::Off, "Off"},
+        {TimingPolicy::Always, "Always"},
+    };
+
+    std::cout << "=== FlightRecorder Overhead Benchmark ===\n\n";
+    std::cout << std::setw(12) << "Policy"
+              << std::setw(18) << "no recorder ns"
+              << std::setw(18) << "recorder ns"
+              << std::setw(16) << "overhead ns\n";
+
+    FlightRecorderBenchmark benchmark;
+    double worst_overhead_ns = 0.0;
+    for (const auto& entry : policies) {
+        const auto result = benchmark.run(entry.policy);
+        const double overhead_ns = result.recorded_ns - result.plain_ns;
+        worst_overhead_ns = overhead_ns > worst_overhead_ns ? overhead_ns : worst_overhead_ns;
+        std::cout << std::setw(12) << entry.name << std::fixed << std::setprecision(2)
+                  << std::setw(18) << result.plain_ns
+                  << std::setw(18) << result.recorded_ns
+                  << std::setw(15) << overhead_ns << "\n";
+    }
+
+    std::cout << "\nRecording Overhead Target (<5 ns per validation): "
+              << (worst_overhead_ns < 5.0 ? "✓ PASSED" : "✗ FAILED") << "\n";
+    return 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file frequency_validator_batch_benchmark.cpp
+ * @brief Throughput benchmark for FrequencyValidator batch validation
+ * @traceability DES-C-001 → validate_frequency_batch
+ *
+ * Compares per-call validate_frequency() against validate_frequency_batch()
+ * with the portable scalar kernel and the best SIMD kernel available on the
+ * executing CPU. Target: >=10x per-call throughput with the AVX2 kernel.
+ */
+
+#include <chrono>
+#include <vector>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <string>
+
+#include "src/lib/Standards/AES/AES5/2018/core/frequency_validation/frequency_validator.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/compliance/compliance_engine.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/validation/validation_core.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/simd/cpu_features.hpp"
+
+using namespace AES::AES5::_2018::core;
+using namespace AES::AES5::_2018::core::frequency_validation;
+
+class FrequencyBatchBenchmark {
+private:
+    static constexpr size_t STREAM_COUNT = 4096;   ///< Streams validated per tick
+    static constexpr size_t TICKS = 200;
+
+    std::unique_ptr<FrequencyValidator> validator_;
+    std::vector<uint32_t> frequencies_;
+    std::vector<validation::ValidationResult> status_;
+    std::vector<uint32_t> closest_;
+    std::vector<double> ppm_;
+
+public:
+    FrequencyBatchBenchmark()
+        : status_(STREAM_COUNT), closest_(STREAM_COUNT), ppm_(STREAM_COUNT) {
+        validator_ = FrequencyValidator::create(
+            std::make_unique<compliance::ComplianceEngine>(),
+            std::make_unique<validation::ValidationCore>());
+
+        // Standard rates with small measured drift, as seen from clock recovery
+        const uint32_t rates[] = {32000, 44100, 47952, 48000, 48048, 88200, 96000, 176400, 192000, 384000};
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> drift(-8, 8);
+        frequencies_.reserve(STREAM_COUNT);
+        for (size_t i = 0; i < STREAM_COUNT; ++i) {
+            frequencies_.push_back(static_cast<uint32_t>(
+                static_cast<int>(rates[rng() % 10]) + drift(rng)));
+        }
+    }
+
+    double run_per_call() {
+        size_t valid = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t tick = 0; tick < TICKS; ++tick) {
+            for (uint32_t frequency : frequencies_) {
+                valid += validator_->validate_frequency(frequency).is_valid() ? 1 : 0;
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return report("Per-call validate_frequency", start, end, valid);
+    }
+
+    double run_batch(simd::SimdLevel level) {
+        simd::set_max_simd_level(level);
+        const FrequencyBatchResults results{status_.data(), closest_.data(), ppm_.data(), nullptr};
+
+        size_t valid = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t tick = 0; tick < TICKS; ++tick) {
+            valid += validator_->validate_frequency_batch(frequencies_.data(), frequencies_.size(), results);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::string name = std::string("Batch (") + simd::to_string(simd::get_active_simd_level()) + ")";
+        simd::set_max_simd_level(simd::SimdLevel::AVX512);
+        return report(name.c_str(), start, end, valid);
+    }
+
+private:
+    template<typename TimePoint>
+    double report(const char* name, TimePoint start, TimePoint end, size_t valid) {
+        const double total_ns = std::chrono::duration<double, std::nano>(end - start).count();
+        const double validations = static_cast<double>(STREAM_COUNT * TICKS);
+        const double per_second = validations * 1e9 / total_ns;
+
+        std::cout << std::left << std::setw(32) << name << std::right
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(10) << total_ns / validations << " ns/validation  "
+                  << std::setprecision(0) << std::setw(14) << per_second << " validations/s"
+                  << "  (" << valid << " valid)\n";
+        return per_second;
+    }
+};
+
+int main() {
+    std::cout << "=== FrequencyValidator Batch Throughput Benchmark ===\n";
+    std::cout << "Detected SIMD level: " << simd::to_string(simd::get_active_simd_level()) << "\n\n";
+
+    FrequencyBatchBenchmark benchmark;
+
+    const double per_call = benchmark.run_per_call();
+    const double scalar = benchmark.run_batch(simd::SimdLevel::Scalar);
+    const double best = benchmark.run_batch(simd::SimdLevel::AVX512);
+
+    std::cout << "\nSpeedup vs per-call: scalar batch " << std::setprecision(1) << scalar / per_call
+              << "x, best batch " << best / per_call << "x\n";
+
+    const bool meets_target = (best / per_call) >= 10.0;
+    std::cout << "Throughput Target (>=10x per-call): " << (meets_target ? "✓ PASSED" : "✗ FAILED") << "\n";
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file instrumentation_level_benchmark.cpp
+ * @brief Hot-path cost at the compiled AES5_INSTRUMENTATION_LEVEL
+ * @traceability DES-C-001, DES-C-003, DES-C-005 → InstrumentationLevel
+ *
+ * Built once per level by the instrumentation_benchmark_matrix target
+ * (instrumentation_level_benchmark_<level>). Each binary measures the
+ * same operations, so the rows compare directly:
+ * - FrequencyValidator::validate_frequency() (TimingPolicy::Always)
+ * - RateCategoryManager::classify_rate_category() on alternating rates
+ * - ValidationCore::validate() with an inlined callable
+ * - FrequencyValidator::validate_frequency_batch() per element
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "src/lib/Standards/AES/AES5/2018/core/frequency_validation/frequency_validator.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/rate_categories/rate_category_manager.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/compliance/compliance_engine.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core;
+using namespace AES::AES5::_2018::core::frequency_validation;
+using namespace AES::AES5::_2018::core::rate_categories;
+using namespace AES::AES5::_2018::core::validation;
+using Clock = std::chrono::steady_clock;
+
+class InstrumentationLevelBenchmark {
+private:
+    static constexpr size_t ITERATIONS = 5 * 1000 * 1000;
+    static constexpr size_t BATCH_SIZE = 1024;
+    static constexpr int REPETITIONS = 3;
+
+    // Best of REPETITIONS runs
+    template<typename Operation>
+    static double ns_per_iteration(size_t iterations, Operation&& operation) {
+        double best = 1e9;
+        for (int r = 0; r < REPETITIONS; ++r) {
+            auto start = Clock::now();
+            for (size_t i = 0; i < iterations; ++i) {
+                operation(i);
+            }
+            auto end = Clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+            best = ns < best ? ns : best;
+        }
+        return best;
+    }
+
+public:
+    struct Result {
+        double validate_frequency_ns;
+        double classify_ns;
+        double core_validate_ns;
+        double batch_element_ns;
+        uint64_t recorded_validations;
+    };
+
+    Result run() {
+        Result result{};
+        uint64_t sink = 0;
+
+        auto validator = FrequencyValidator::create(std::make_unique<compliance::ComplianceEngine>(),
+                                                    std::make_unique<ValidationCore>());
+        validator->set_timing_policy(TimingPolicy::Always);
+        result.validate_frequency_ns = ns_per_iteration(ITERATIONS, [&](size_t i) {
+            sink += validator->validate_frequency(static_cast<uint32_t>(48000 + (i & 7))).closest_standard_frequency;
+        });
+
+        auto manager = RateCategoryManager::create(std::make_unique<ValidationCore>());
+        static const uint32_t rates[] = {44100, 48000, 88200, 96000};
+        result.classify_ns = ns_per_iteration(ITERATIONS, [&](size_t i) {
+            sink += static_cast<uint64_t>(manager->classify_rate_category(rates[i & 3]).category);
+        });
+
+        ValidationCore core;
+        result.core_validate_ns = ns_per_iteration(ITERATIONS, [&](size_t i) {
+            sink += static_cast<uint64_t>(core.validate(static_cast<uint32_t>(48000 + (i & 1)), [](uint32_t value) noexcept {
+                return (value == 48000) ? ValidationResult::Valid : ValidationResult::OutOfTolerance;
+            }));
+        });
+
+        std::vector<uint32_t> frequencies(BATCH_SIZE);
+        for (size_t i = 0; i < BATCH_SIZE; ++i) {
+            frequencies[i] = static_cast<uint32_t>(44100 + (i % 16) * 3900);
+        }
+        std::vector<ValidationResult> status(BATCH_SIZE);
+        std::vector<uint32_t> closest(BATCH_SIZE);
+        std::vector<double> ppm(BATCH_SIZE);
+        result.batch_element_ns = ns_per_iteration(ITERATIONS / BATCH_SIZE, [&](size_t) {
+            sink += validator->validate_frequency_batch(frequencies.data(), BATCH_SIZE,
+                                                        {status.data(), closest.data(), ppm.data(), nullptr});
+        }) / BATCH_SIZE;
+
+        result.recorded_validations = validator->get_metrics().total_validations.load();
+        if (sink == 42) {
+            std::cout << "";
+        }
+        return result;
+    }
+};
+
+int main() {
+    InstrumentationLevelBenchmark benchmark;
+    const auto result = benchmark.run();
+
+    std::cout << "=== Instrumentation Level: " << instrumentation_level_name(INSTRUMENTATION_LEVEL) << " ===\n";
+    std::cout << std::fixed << std::setprecision(2)
+              << "  validate_frequency() (Always):   " << std::setw(8) << result.validate_frequency_ns << " ns\n"
+              << "  classify_rate_category():        " << std::setw(8) << result.classify_ns << " ns\n"
+              << "  ValidationCore::validate():      " << std::setw(8) << result.core_validate_ns << " ns\n"
+              << "  validate_frequency_batch() /elem:" << std::setw(8) << result.batch_element_ns << " ns\n"
+              << "  Validations counted by metrics:  " << result.recorded_validations << "\n\n";
+    return 0;
+}
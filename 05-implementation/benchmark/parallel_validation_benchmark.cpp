@@ -0,0 +1,117 @@
+/**
+ * @file parallel_validation_benchmark.cpp
+ * @brief ParallelValidationEngine throughput vs worker count
+ * @traceability DES-C-001, DES-C-003, DES-C-005 → ParallelValidationEngine
+ *
+ * Validates and classifies a large frequency array with 1..N workers
+ * (N = hardware concurrency, at least 4 rows) and reports throughput and
+ * parallel efficiency relative to one worker. Rows with more workers than
+ * hardware threads are oversubscribed and not expected to scale.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/lib/Standards/AES/AES5/2018/core/parallel/parallel_validation_engine.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/compliance/compliance_engine.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core;
+using namespace AES::AES5::_2018::core::parallel;
+using Clock = std::chrono::high_resolution_clock;
+
+class ParallelValidationBenchmark {
+private:
+    static constexpr size_t ELEMENTS = 16 * 1024 * 1024;
+    static constexpr size_t ROUNDS = 5;
+
+    std::vector<uint32_t> frequencies_;
+
+public:
+    ParallelValidationBenchmark() : frequencies_(ELEMENTS) {
+        static const uint32_t rates[] = {48000, 48001, 44100, 96000, 47952, 192000, 47999, 88200,
+                                         50000, 0, 384000, 11025, 32000, 176400, 47990, 24000};
+        uint32_t state = 12345;
+        for (auto& frequency : frequencies_) {
+            state = state * 1664525u + 1013904223u;
+            frequency = rates[state >> 28];
+        }
+    }
+
+    /// Best-of-ROUNDS throughput in million elements per second
+    double run(size_t workers, uint64_t& steals) {
+        auto engine = ParallelValidationEngine::create(
+            frequency_validation::FrequencyValidator::create(
+                std::make_unique<compliance::ComplianceEngine>(),
+                std::make_unique<validation::ValidationCore>()),
+            rate_categories::RateCategoryManager::create(std::make_unique<validation::ValidationCore>()),
+            workers);
+        if (!engine) {
+            return 0.0;
+        }
+
+        ParallelValidationReport report;
+        engine->validate(frequencies_.data(), frequencies_.size(), report);   // warm-up, allocates report
+
+        double best_ns = 0.0;
+        steals = 0;
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            auto start = Clock::now();
+            engine->validate(frequencies_.data(), frequencies_.size(), report);
+            auto end = Clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+            if (round == 0 || ns < best_ns) {
+                best_ns = ns;
+            }
+            steals += report.steal_count;
+        }
+        return ELEMENTS / best_ns * 1000.0;
+    }
+};
+
+int main() {
+    const size_t hardware_threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+    const size_t max_workers = hardware_threads < 4 ? 4 : hardware_threads;
+
+    std::cout << "=== ParallelValidationEngine Scaling Benchmark ===\n";
+    std::cout << "Elements: 16M, hardware threads: " << hardware_threads << "\n\n";
+    std::cout << std::setw(9) << "Workers"
+              << std::setw(16) << "M elem/s"
+              << std::setw(12) << "Speedup"
+              << std::setw(14) << "Efficiency"
+              << std::setw(10) << "Steals\n";
+
+    ParallelValidationBenchmark benchmark;
+    double single = 0.0;
+    bool scales = true;
+    for (size_t workers = 1; workers <= max_workers; workers *= 2) {
+        uint64_t steals = 0;
+        const double throughput = benchmark.run(workers, steals);
+        if (workers == 1) {
+            single = throughput;
+        }
+        const double speedup = throughput / single;
+        const double efficiency = speedup / static_cast<double>(workers);
+        std::cout << std::setw(9) << workers << std::fixed << std::setprecision(1)
+                  << std::setw(16) << throughput
+                  << std::setw(11) << std::setprecision(2) << speedup << "x"
+                  << std::setw(13) << std::setprecision(0) << efficiency * 100.0 << "%"
+                  << std::setw(9) << steals
+                  << (workers > hardware_threads ? "  (oversubscribed)" : "") << "\n";
+        if (workers <= hardware_threads && workers > 1) {
+            scales = scales && efficiency >= 0.75;
+        }
+        if (workers < max_workers && workers * 2 > max_workers) {
+            workers = max_workers / 2;   // always end on max_workers
+        }
+    }
+
+    std::cout << "\nScaling Target (>= 75% efficiency up to hardware threads): "
+              << (scales ? "✓ PASSED" : "✗ FAILED") << "\n";
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file rate_category_lookup_benchmark.cpp
+ * @brief Rate category lookup: range checks vs two-level boundary table
+ * @traceability DES-C-003 → classify_rate_category
+ *
+ * Classifies a mix of integer-kHz and 44.1 kHz-family rates (the latter
+ * missed the old whole-kHz table) plus a uniform random sweep of 0-440 kHz,
+ * once with the six range checks over RATE_CATEGORY_BOUNDS and once with the
+ * O(1) bucket table from rate_category_table.hpp.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "src/lib/Standards/AES/AES5/2018/core/rate_categories/rate_category_table.hpp"
+
+using namespace AES::AES5::_2018::core::rate_categories;
+using Clock = std::chrono::steady_clock;
+
+class RateCategoryLookupBenchmark {
+private:
+    static constexpr size_t SAMPLES = 1 << 16;
+    static constexpr int PASSES = 64;
+    static constexpr int REPETITIONS = 3;
+
+    // Best of REPETITIONS runs over PASSES passes of the sample set
+    template<typename Classify>
+    static double ns_per_iteration(const std::vector<uint32_t>& frequencies, Classify&& classify, uint64_t& sink) {
+        double best = 1e12;
+        for (int r = 0; r < REPETITIONS; ++r) {
+            auto start = Clock::now();
+            for (int pass = 0; pass < PASSES; ++pass) {
+                for (uint32_t frequency : frequencies) {
+                    sink += static_cast<uint64_t>(classify(frequency));
+                }
+            }
+            auto end = Clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(end - start).count() /
+                              (static_cast<double>(frequencies.size()) * PASSES);
+            best = ns < best ? ns : best;
+        }
+        return best;
+    }
+
+public:
+    struct Result {
+        double range_mixed_ns;
+        double table_mixed_ns;
+        double range_sweep_ns;
+        double table_sweep_ns;
+    };
+
+    Result run() {
+        std::mt19937 rng(42);
+        const uint32_t rates[] = {44100, 48000, 88200, 96000, 176400, 192000, 352800, 384000, 22050, 32000};
+        std::uniform_int_distribution<size_t> pick(0, sizeof(rates) / sizeof(rates[0]) - 1);
+        std::uniform_int_distribution<uint32_t> sweep(0, 440000);
+
+        std::vector<uint32_t> mixed(SAMPLES);
+        std::vector<uint32_t> swept(SAMPLES);
+        for (size_t i = 0; i < SAMPLES; ++i) {
+            mixed[i] = rates[pick(rng)];
+            swept[i] = sweep(rng);
+        }
+
+        Result result{};
+        uint64_t sink = 0;
+        auto by_range = [](uint32_t f) { return detail::classify_rate_category_by_range(f); };
+        auto by_table = [](uint32_t f) { return detail::lookup_rate_category(f); };
+        result.range_mixed_ns = ns_per_iteration(mixed, by_range, sink);
+        result.table_mixed_ns = ns_per_iteration(mixed, by_table, sink);
+        result.range_sweep_ns = ns_per_iteration(swept, by_range, sink);
+        result.table_sweep_ns = ns_per_iteration(swept, by_table, sink);
+
+        if (sink == 42) {
+            std::cout << "";
+        }
+        return result;
+    }
+};
+
+int main() {
+    RateCategoryLookupBenchmark benchmark;
+    const auto result = benchmark.run();
+
+    std::cout << "=== Rate Category Lookup Benchmark ===\n\n";
+    std::cout << "Table size: " << sizeof(detail::RATE_BUCKET_TABLE) + sizeof(detail::RATE_SEGMENT_CATEGORIES)
+              << " bytes (" << detail::RATE_BUCKET_COUNT << " buckets of " << detail::BUCKET_HZ << " Hz)\n\n";
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "Common rates (random order):\n"
+              << "  Range checks:   " << std::setw(8) << result.range_mixed_ns << " ns\n"
+              << "  Boundary table: " << std::setw(8) << result.table_mixed_ns << " ns\n"
+              << "Uniform 0-440 kHz sweep:\n"
+              << "  Range checks:   " << std::setw(8) << result.range_sweep_ns << " ns\n"
+              << "  Boundary table: " << std::setw(8) << result.table_sweep_ns << " ns\n";
+
+    const bool size_ok = sizeof(detail::RATE_BUCKET_TABLE) + sizeof(detail::RATE_SEGMENT_CATEGORIES) < 1024;
+    std::cout << "\nTable Size Target (<1 KB): " << (size_ok ? "✓ PASSED" : "✗ FAILED") << "\n";
+    std::cout << "Lookup Target (table no slower than range checks on random input): "
+              << (result.table_sweep_ns <= result.range_sweep_ns ? "✓ PASSED" : "✗ FAILED") << "\n";
+    return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file rate_classification_contention_benchmark.cpp
+ * @brief Multi-threaded scaling of RateCategoryManager::classify_rate_category()
+ * @traceability DES-C-003 → RateClassificationCache
+ *
+ * Threads share one RateCategoryManager and classify a hot set of stream
+ * rates, so nearly every call hits the lock-free classification cache.
+ * Runs once with MetricsBackend::Shared and once with MetricsBackend::Sharded:
+ * cache hits are read-only, so with sharded metrics nothing is written to a
+ * shared cache line and throughput should scale with the core count.
+ * Also reports single-thread hit vs miss cost.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/lib/Standards/AES/AES5/2018/core/rate_categories/rate_category_manager.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core;
+using namespace AES::AES5::_2018::core::rate_categories;
+
+class ClassificationContentionBenchmark {
+private:
+    static constexpr size_t CLASSIFICATIONS_PER_THREAD = 2000000;
+    static constexpr uint32_t HOT_RATES[] = {44100, 48000, 88200, 96000, 176400, 192000, 32000, 384000};
+
+public:
+    /// Classifications per second with thread_count threads sharing one manager
+    double run(validation::MetricsBackend backend, unsigned thread_count) {
+        auto manager = RateCategoryManager::create(std::make_unique<validation::ValidationCore>(backend));
+
+        std::atomic<bool> start_flag{false};
+        std::atomic<unsigned> ready{0};
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+
+        for (unsigned t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&, t]() {
+                ready.fetch_add(1);
+                while (!start_flag.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                size_t valid = 0;
+                for (size_t i = 0; i < CLASSIFICATIONS_PER_THREAD; ++i) {
+                    valid += manager->classify_rate_category(HOT_RATES[(i + t) & 7]).valid ? 1 : 0;
+                }
+                (void)valid;
+            });
+        }
+
+        while (ready.load() < thread_count) {
+            std::this_thread::yield();
+        }
+        auto start = std::chrono::high_resolution_clock::now();
+        start_flag.store(true, std::memory_order_release);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        // Sanity check: every classification counted
+        const uint64_t expected = static_cast<uint64_t>(CLASSIFICATIONS_PER_THREAD) * thread_count;
+        if (manager->get_metrics().total_validations.load() != expected) {
+            std::cerr << "Lost metrics updates!\n";
+        }
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        return static_cast<double>(expected) / seconds;
+    }
+
+    /// Single-thread ns per call: all hits vs all misses (distinct frequencies)
+    void hit_miss_cost(double& hit_ns, double& miss_ns) {
+        auto manager = RateCategoryManager::create(std::make_unique<validation::ValidationCore>());
+        uint64_t sink = 0;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < CLASSIFICATIONS_PER_THREAD; ++i) {
+            sink += static_cast<uint64_t>(manager->classify_rate_category(HOT_RATES[i & 7]).category);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        hit_ns = std::chrono::duration<double, std::nano>(end - start).count() / CLASSIFICATIONS_PER_THREAD;
+
+        start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < CLASSIFICATIONS_PER_THREAD; ++i) {
+            sink += static_cast<uint64_t>(manager->classify_rate_category(static_cast<uint32_t>(8000 + i)).category);
+        }
+        end = std::chrono::high_resolution_clock::now();
+        miss_ns = std::chrono::duration<double, std::nano>(end - start).count() / CLASSIFICATIONS_PER_THREAD;
+
+        if (sink == 42) {
+            std::cout << "";
+        }
+    }
+};
+
+int main() {
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << "=== RateCategoryManager Classification Contention Benchmark ===\n";
+    std::cout << "Hardware threads: " << cores << "\n\n";
+
+    ClassificationContentionBenchmark benchmark;
+    double hit_ns = 0.0;
+    double miss_ns = 0.0;
+    benchmark.hit_miss_cost(hit_ns, miss_ns);
+    std::cout << std::fixed << std::setprecision(2)
+              << "Single thread: cache hit " << hit_ns << " ns, cache miss " << miss_ns << " ns\n\n";
+
+    std::cout << std::setw(8) << "Threads"
+              << std::setw(18) << "Shared (M/s)"
+              << std::setw(18) << "Sharded (M/s)"
+              << std::setw(22) << "Sharded efficiency\n";
+
+    double sharded_single = 0.0;
+    double worst_efficiency = 1.0;
+    for (unsigned threads = 1;; threads = std::min(threads * 2, cores)) {
+        const double shared = benchmark.run(validation::MetricsBackend::Shared, threads);
+        const double sharded = benchmark.run(validation::MetricsBackend::Sharded, threads);
+        if (threads == 1) {
+            sharded_single = sharded;
+        }
+        const double efficiency = sharded / (sharded_single * threads);
+        worst_efficiency = std::min(worst_efficiency, efficiency);
+
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(1)
+                  << std::setw(18) << shared / 1e6
+                  << std::setw(18) << sharded / 1e6
+                  << std::setw(20) << efficiency * 100.0 << " %\n";
+
+        if (threads == cores) {
+            break;
+        }
+    }
+
+    std::cout << "\nCache Hit Target (hit cheaper than miss): "
+              << (hit_ns < miss_ns ? "✓ PASSED" : "✗ FAILED") << "\n";
+    std::cout << "Sharded Scaling Target (>=80% per-thread efficiency up to core count): "
+              << (worst_efficiency >= 0.8 ? "✓ PASSED" : "✗ FAILED") << "\n";
+    return 0;
+}
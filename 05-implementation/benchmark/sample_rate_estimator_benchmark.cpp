@@ -0,0 +1,75 @@
+/**
+ * @file sample_rate_estimator_benchmark.cpp
+ * @brief Update throughput of SampleRateEstimator across many streams
+ * @traceability DES-C-008 → SampleRateEstimator
+ *
+ * Interleaves timestamp updates over an array of estimators (one per
+ * stream) so each update touches a different estimator, as a multi-stream
+ * clock-recovery loop would. Target: several million updates per second.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "src/lib/Standards/AES/AES5/2018/core/rate_estimation/sample_rate_estimator.hpp"
+
+using namespace AES::AES5::_2018::core::rate_estimation;
+
+class SampleRateEstimatorBenchmark {
+private:
+    static constexpr size_t UPDATES_PER_STREAM = 20000;
+    static constexpr uint64_t FRAMES_PER_BLOCK = 64;
+
+public:
+    /// Updates per second with stream_count interleaved streams
+    double run(size_t stream_count) {
+        std::vector<SampleRateEstimator> estimators(stream_count);
+        std::vector<uint64_t> periods_ns(stream_count);
+        for (size_t s = 0; s < stream_count; ++s) {
+            // 64 frames at ~48 kHz with a per-stream offset of a few ppm
+            periods_ns[s] = 1333333 + (s % 7) * 11;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < UPDATES_PER_STREAM; ++i) {
+            for (size_t s = 0; s < stream_count; ++s) {
+                estimators[s].update(i * FRAMES_PER_BLOCK, 1000000000ULL + i * periods_ns[s] + (i & 3));
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double checksum = 0.0;
+        for (const auto& estimator : estimators) {
+            checksum += estimator.estimate().frequency_hz;
+        }
+        if (checksum <= 0.0) {
+            std::cerr << "No estimate produced!\n";
+        }
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        return static_cast<double>(UPDATES_PER_STREAM * stream_count) / seconds;
+    }
+};
+
+int main() {
+    std::cout << "=== SampleRateEstimator Update Throughput ===\n";
+    std::cout << "Estimator size: " << sizeof(SampleRateEstimator) << " bytes\n\n";
+    std::cout << std::setw(10) << "Streams" << std::setw(22) << "Updates/s (M)" << std::setw(16) << "ns/update\n";
+
+    SampleRateEstimatorBenchmark benchmark;
+    double worst = 0.0;
+    for (size_t streams : {1, 16, 256, 4096}) {
+        const double rate = benchmark.run(streams);
+        worst = (worst == 0.0 || rate < worst) ? rate : worst;
+        std::cout << std::setw(10) << streams << std::fixed << std::setprecision(1)
+                  << std::setw(22) << rate / 1e6
+                  << std::setw(14) << 1e9 / rate << "\n";
+    }
+
+    std::cout << "\nThroughput Target (>1M updates/s at every stream count): "
+              << (worst > 1e6 ? "✓ PASSED" : "✗ FAILED") << "\n";
+    return 0;
+}
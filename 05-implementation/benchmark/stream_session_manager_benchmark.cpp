@@ -0,0 +1,129 @@
+/**
+ * @file stream_session_manager_benchmark.cpp
+ * @brief StreamSessionManager tick cost vs one FrequencyValidator per stream
+ * @traceability DES-C-001, DES-C-003 → StreamSessionManager
+ *
+ * Baseline: one FrequencyValidator + RateCategoryManager per stream (each with
+ * heap-allocated dependencies), validated and classified one call at a time.
+ * Session manager: one tick() over structure-of-arrays state.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "src/lib/Standards/AES/AES5/2018/core/stream_sessions/stream_session_manager.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/compliance/compliance_engine.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core;
+using namespace AES::AES5::_2018::core::stream_sessions;
+using Clock = std::chrono::high_resolution_clock;
+
+class StreamSessionBenchmark {
+private:
+    static constexpr size_t TICKS = 20;
+
+    static uint32_t rate_for(size_t stream) {
+        static const uint32_t rates[] = {48000, 48001, 44100, 96000, 47952, 192000, 47999, 88200};
+        return rates[stream & 7];
+    }
+
+public:
+    struct Result {
+        double setup_ms;
+        double tick_ns_per_stream;
+    };
+
+    Result run_per_stream_validators(size_t stream_count) {
+        struct Stream {
+            std::unique_ptr<frequency_validation::FrequencyValidator> validator;
+            std::unique_ptr<rate_categories::RateCategoryManager> categories;
+            uint32_t rate;
+        };
+
+        auto setup_start = Clock::now();
+        std::vector<Stream> streams;
+        streams.reserve(stream_count);
+        for (size_t i = 0; i < stream_count; ++i) {
+            streams.push_back({
+                frequency_validation::FrequencyValidator::create(
+                    std::make_unique<compliance::ComplianceEngine>(),
+                    std::make_unique<validation::ValidationCore>()),
+                rate_categories::RateCategoryManager::create(std::make_unique<validation::ValidationCore>()),
+                rate_for(i)});
+            streams.back().validator->set_timing_policy(frequency_validation::TimingPolicy::Off);
+        }
+        auto setup_end = Clock::now();
+
+        size_t valid = 0;
+        auto start = Clock::now();
+        for (size_t tick = 0; tick < TICKS; ++tick) {
+            for (auto& stream : streams) {
+                valid += stream.validator->validate_frequency(stream.rate).is_valid() ? 1 : 0;
+                valid += stream.categories->classify_rate_category(stream.rate).is_valid() ? 1 : 0;
+            }
+        }
+        auto end = Clock::now();
+        (void)valid;
+
+        return {std::chrono::duration<double, std::milli>(setup_end - setup_start).count(),
+                std::chrono::duration<double, std::nano>(end - start).count() / (TICKS * stream_count)};
+    }
+
+    Result run_session_manager(size_t stream_count) {
+        auto setup_start = Clock::now();
+        auto manager = StreamSessionManager::create(
+            frequency_validation::FrequencyValidator::create(
+                std::make_unique<compliance::ComplianceEngine>(),
+                std::make_unique<validation::ValidationCore>()),
+            rate_categories::RateCategoryManager::create(std::make_unique<validation::ValidationCore>()),
+            stream_count);
+        for (size_t i = 0; i < stream_count; ++i) {
+            manager->add_stream(rate_for(i));
+        }
+        auto setup_end = Clock::now();
+
+        size_t valid = 0;
+        auto start = Clock::now();
+        for (size_t tick = 0; tick < TICKS; ++tick) {
+            valid += manager->tick();
+        }
+        auto end = Clock::now();
+        (void)valid;
+
+        return {std::chrono::duration<double, std::milli>(setup_end - setup_start).count(),
+                std::chrono::duration<double, std::nano>(end - start).count() / (TICKS * stream_count)};
+    }
+};
+
+int main() {
+    std::cout << "=== StreamSessionManager Benchmark ===\n\n";
+    std::cout << std::setw(9) << "Streams"
+              << std::setw(20) << "Per-stream setup"
+              << std::setw(20) << "Per-stream ns/str"
+              << std::setw(18) << "Session setup"
+              << std::setw(18) << "Session ns/str"
+              << std::setw(10) << "Speedup\n";
+
+    StreamSessionBenchmark benchmark;
+    bool scales = true;
+    for (size_t streams : {1000, 4000, 20000, 100000}) {
+        const auto baseline = benchmark.run_per_stream_validators(streams);
+        const auto session = benchmark.run_session_manager(streams);
+        std::cout << std::setw(9) << streams << std::fixed << std::setprecision(2)
+                  << std::setw(17) << baseline.setup_ms << " ms"
+                  << std::setw(20) << baseline.tick_ns_per_stream
+                  << std::setw(15) << session.setup_ms << " ms"
+                  << std::setw(18) << session.tick_ns_per_stream
+                  << std::setw(8) << baseline.tick_ns_per_stream / session.tick_ns_per_stream << "x\n";
+        scales = scales && session.tick_ns_per_stream < baseline.tick_ns_per_stream;
+    }
+
+    std::cout << "\nSession Manager Target (cheaper per stream at every size up to 100k): "
+              << (scales ? "✓ PASSED" : "✗ FAILED") << "\n";
+    return 0;
+}
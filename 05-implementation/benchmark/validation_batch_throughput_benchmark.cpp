@@ -0,0 +1,112 @@
+/**
+ * @file validation_batch_throughput_benchmark.cpp
+ * @brief ValidationCore::batch_validate_into() throughput from 16 to 10M elements
+ * @traceability DES-C-005 → batch_validate_into
+ *
+ * Baseline: one ValidationCore::validate() call per element (two clock reads
+ * and one metrics update each). Batch: batch_validate_into() with per-element
+ * results, metrics amortized per BATCH_CHUNK_SIZE chunk.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "src/lib/Standards/AES/AES5/2018/core/frequency_validation/frequency_validator.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/compliance/compliance_engine.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core;
+using namespace AES::AES5::_2018::core::validation;
+using Clock = std::chrono::high_resolution_clock;
+
+class BatchThroughputBenchmark {
+private:
+    static constexpr size_t ELEMENTS_PER_SIZE = 20 * 1000 * 1000;   ///< Work per row
+
+    std::unique_ptr<frequency_validation::FrequencyValidator> validator_;
+    std::vector<uint32_t> values_;
+    std::vector<ValidationResult> results_;
+
+    static size_t repetitions_for(size_t batch_size) {
+        const size_t repetitions = ELEMENTS_PER_SIZE / batch_size;
+        return repetitions ? repetitions : 1;
+    }
+
+public:
+    explicit BatchThroughputBenchmark(size_t max_batch)
+        : validator_(frequency_validation::FrequencyValidator::create(
+              std::make_unique<compliance::ComplianceEngine>(),
+              std::make_unique<ValidationCore>()))
+        , values_(max_batch)
+        , results_(max_batch) {
+        static const uint32_t rates[] = {48000, 48001, 44100, 96000, 47952, 192000, 47999, 88200};
+        for (size_t i = 0; i < values_.size(); ++i) {
+            values_[i] = rates[i & 7];
+        }
+    }
+
+    /// ns per element, one validate() call per element
+    double run_per_call(size_t batch_size) {
+        ValidationCore core;
+        const size_t repetitions = repetitions_for(batch_size);
+        size_t valid = 0;
+        auto start = Clock::now();
+        for (size_t r = 0; r < repetitions; ++r) {
+            for (size_t i = 0; i < batch_size; ++i) {
+                valid += core.validate(values_[i], frequency_validation::frequency_validation_function,
+                                       validator_.get()) == ValidationResult::Valid;
+            }
+        }
+        auto end = Clock::now();
+        (void)valid;
+        return std::chrono::duration<double, std::nano>(end - start).count() / (repetitions * batch_size);
+    }
+
+    /// ns per element, batch_validate_into() with per-element results
+    double run_batch(size_t batch_size) {
+        ValidationCore core;
+        const size_t repetitions = repetitions_for(batch_size);
+        size_t valid = 0;
+        auto start = Clock::now();
+        for (size_t r = 0; r < repetitions; ++r) {
+            valid += core.batch_validate_into(values_.data(), batch_size, results_.data(),
+                                              frequency_validation::frequency_validation_function,
+                                              validator_.get()).successful;
+        }
+        auto end = Clock::now();
+        (void)valid;
+        return std::chrono::duration<double, std::nano>(end - start).count() / (repetitions * batch_size);
+    }
+};
+
+int main() {
+    const size_t sizes[] = {16, 256, 4096, 65536, 1000000, 10000000};
+
+    std::cout << "=== ValidationCore Batch Throughput Benchmark ===\n\n";
+    std::cout << std::setw(10) << "Batch"
+              << std::setw(18) << "validate() ns/el"
+              << std::setw(16) << "batch ns/el"
+              << std::setw(16) << "batch M el/s"
+              << std::setw(10) << "Speedup\n";
+
+    BatchThroughputBenchmark benchmark(sizes[5]);
+    bool faster = true;
+    for (size_t size : sizes) {
+        const double per_call = benchmark.run_per_call(size);
+        const double batch = benchmark.run_batch(size);
+        std::cout << std::setw(10) << size << std::fixed << std::setprecision(2)
+                  << std::setw(18) << per_call
+                  << std::setw(16) << batch
+                  << std::setw(16) << 1000.0 / batch
+                  << std::setw(8) << per_call / batch << "x\n";
+        faster = faster && batch < per_call;
+    }
+
+    std::cout << "\nBatch Target (cheaper per element than validate() at every size): "
+              << (faster ? "✓ PASSED" : "✗ FAILED") << "\n";
+    return 0;
+}
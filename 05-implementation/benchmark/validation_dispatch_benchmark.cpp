@@ -0,0 +1,134 @@
+/**
+ * @file validation_dispatch_benchmark.cpp
+ * @brief Function-pointer vs templated (inlined) ValidationCore validators
+ * @traceability DES-C-005 → validate<F>, batch_validate_into<F>
+ *
+ * Same validator body (AES5-2018 48 kHz ± 1000 ppm window check) called
+ * through ValidationFunction + void* context and through a lambda, per call
+ * and in unbounded batches.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "src/lib/Standards/AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core::validation;
+using Clock = std::chrono::high_resolution_clock;
+
+namespace {
+
+struct WindowContext {
+    uint32_t low;
+    uint32_t high;
+};
+
+ValidationResult window_validation_function(uint32_t value, void* context) noexcept {
+    const auto* window = static_cast<const WindowContext*>(context);
+    return (value >= window->low && value <= window->high) ? ValidationResult::Valid
+                                                           : ValidationResult::OutOfTolerance;
+}
+
+} // namespace
+
+class ValidationDispatchBenchmark {
+private:
+    static constexpr size_t CALLS = 5 * 1000 * 1000;
+    static constexpr size_t BATCH = 1000 * 1000;
+    static constexpr size_t BATCH_ROUNDS = 50;
+
+    WindowContext window_{47952, 48048};
+    std::vector<uint32_t> values_;
+    std::vector<ValidationResult> results_;
+
+public:
+    ValidationDispatchBenchmark() : values_(BATCH), results_(BATCH) {
+        static const uint32_t rates[] = {48000, 48001, 44100, 47952, 48049, 47999, 48048, 96000};
+        for (size_t i = 0; i < values_.size(); ++i) {
+            values_[i] = rates[i & 7];
+        }
+    }
+
+    double per_call_pointer() {
+        ValidationCore core;
+        size_t valid = 0;
+        auto start = Clock::now();
+        for (size_t i = 0; i < CALLS; ++i) {
+            valid += core.validate(values_[i % BATCH], window_validation_function, &window_) == ValidationResult::Valid;
+        }
+        auto end = Clock::now();
+        (void)valid;
+        return std::chrono::duration<double, std::nano>(end - start).count() / CALLS;
+    }
+
+    double per_call_template() {
+        ValidationCore core;
+        const WindowContext window = window_;
+        size_t valid = 0;
+        auto start = Clock::now();
+        for (size_t i = 0; i < CALLS; ++i) {
+            valid += core.validate(values_[i % BATCH], [window](uint32_t value) noexcept {
+                return (value >= window.low && value <= window.high) ? ValidationResult::Valid
+                                                                     : ValidationResult::OutOfTolerance;
+            }) == ValidationResult::Valid;
+        }
+        auto end = Clock::now();
+        (void)valid;
+        return std::chrono::duration<double, std::nano>(end - start).count() / CALLS;
+    }
+
+    double batch_pointer() {
+        ValidationCore core;
+        size_t valid = 0;
+        auto start = Clock::now();
+        for (size_t round = 0; round < BATCH_ROUNDS; ++round) {
+            valid += core.batch_validate_into(values_.data(), BATCH, results_.data(),
+                                              window_validation_function, &window_).successful;
+        }
+        auto end = Clock::now();
+        (void)valid;
+        return std::chrono::duration<double, std::nano>(end - start).count() / (BATCH * BATCH_ROUNDS);
+    }
+
+    double batch_template() {
+        ValidationCore core;
+        const WindowContext window = window_;
+        size_t valid = 0;
+        auto start = Clock::now();
+        for (size_t round = 0; round < BATCH_ROUNDS; ++round) {
+            valid += core.batch_validate_into(values_.data(), BATCH, results_.data(),
+                                              [window](uint32_t value) noexcept {
+                return (value >= window.low && value <= window.high) ? ValidationResult::Valid
+                                                                     : ValidationResult::OutOfTolerance;
+            }).successful;
+        }
+        auto end = Clock::now();
+        (void)valid;
+        return std::chrono::duration<double, std::nano>(end - start).count() / (BATCH * BATCH_ROUNDS);
+    }
+};
+
+int main() {
+    ValidationDispatchBenchmark benchmark;
+
+    const double call_pointer = benchmark.per_call_pointer();
+    const double call_template = benchmark.per_call_template();
+    const double batch_pointer = benchmark.batch_pointer();
+    const double batch_template = benchmark.batch_template();
+
+    std::cout << "=== ValidationCore Dispatch Benchmark ===\n\n";
+    std::cout << std::setw(24) << "" << std::setw(16) << "fn pointer" << std::setw(16) << "template"
+              << std::setw(10) << "Speedup\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(24) << "validate() ns/call" << std::setw(16) << call_pointer
+              << std::setw(16) << call_template << std::setw(8) << call_pointer / call_template << "x\n";
+    std::cout << std::setw(24) << "batch ns/element" << std::setw(16) << batch_pointer
+              << std::setw(16) << batch_template << std::setw(8) << batch_pointer / batch_template << "x\n";
+
+    std::cout << "\nInlining Target (templated batch faster than function pointer): "
+              << (batch_template < batch_pointer ? "✓ PASSED" : "✗ FAILED") << "\n";
+    return 0;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file validation_metrics_scaling_benchmark.cpp
+ * @brief Multi-threaded scaling benchmark for ValidationCore metrics backends
+ * @traceability DES-C-005 → ShardedValidationMetrics
+ *
+ * Runs FrequencyValidator::validate_frequency() from 1..N threads against a
+ * shared validator, once with MetricsBackend::Shared (one cache line of
+ * atomics) and once with MetricsBackend::Sharded (per-thread shards).
+ * Timing is off so metrics updates dominate. Target: near-linear scaling
+ * of the sharded backend up to the core count.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/lib/Standards/AES/AES5/2018/core/frequency_validation/frequency_validator.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/compliance/compliance_engine.hpp"
+#include "src/lib/Standards/AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core;
+using namespace AES::AES5::_2018::core::frequency_validation;
+
+class MetricsScalingBenchmark {
+private:
+    static constexpr size_t VALIDATIONS_PER_THREAD = 2000000;
+
+public:
+    /// Validations per second with thread_count threads sharing one validator
+    double run(validation::MetricsBackend backend, unsigned thread_count) {
+        auto validator = FrequencyValidator::create(
+            std::make_unique<compliance::ComplianceEngine>(),
+            std::make_unique<validation::ValidationCore>(backend));
+        validator->set_timing_policy(TimingPolicy::Off);
+
+        std::atomic<bool> start_flag{false};
+        std::atomic<unsigned> ready{0};
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+
+        for (unsigned t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&, t]() {
+                const uint32_t frequencies[] = {48000, 44100, 96000, 48005};
+                ready.fetch_add(1);
+                while (!start_flag.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                size_t valid = 0;
+                for (size_t i = 0; i < VALIDATIONS_PER_THREAD; ++i) {
+                    valid += validator->validate_frequency(frequencies[(i + t) & 3]).is_valid() ? 1 : 0;
+                }
+                (void)valid;
+            });
+        }
+
+        while (ready.load() < thread_count) {
+            std::this_thread::yield();
+        }
+        auto start = std::chrono::high_resolution_clock::now();
+        start_flag.store(true, std::memory_order_release);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        // Sanity check: no lost counts
+        const uint64_t expected = static_cast<uint64_t>(VALIDATIONS_PER_THREAD) * thread_count;
+        if (validator->get_metrics().total_validations.load() != expected) {
+            std::cerr << "Lost metrics updates!\n";
+        }
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        return static_cast<double>(expected) / seconds;
+    }
+};
+
+int main() {
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << "=== ValidationCore Metrics Scaling Benchmark ===\n";
+    std::cout << "Hardware threads: " << cores << "\n\n";
+    std::cout << std::setw(8) << "Threads"
+              << std::setw(18) << "Shared (M/s)"
+              << std::setw(18) << "Sharded (M/s)"
+              << std::setw(22) << "Sharded efficiency\n";
+
+    MetricsScalingBenchmark benchmark;
+    double sharded_single = 0.0;
+    double worst_efficiency = 1.0;
+
+    for (unsigned threads = 1;; threads = std::min(threads * 2, cores)) {
+        const double shared = benchmark.run(validation::MetricsBackend::Shared, threads);
+        const double sharded = benchmark.run(validation::MetricsBackend::Sharded, threads);
+        if (threads == 1) {
+            sharded_single = sharded;
+        }
+        const double efficiency = sharded / (sharded_single * threads);
+        worst_efficiency = std::min(worst_efficiency, efficiency);
+
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(1)
+                  << std::setw(18) << shared / 1e6
+                  << std::setw(18) << sharded / 1e6
+                  << std::setw(20) << efficiency * 100.0 << " %\n";
+
+        if (threads == cores) {
+            break;
+        }
+    }
+
+    const bool near_linear = worst_efficiency >= 0.8;
+    std::cout << "\nSharded Scaling Target (>=80% per-thread efficiency up to core count): "
+              << (near_linear ? "✓ PASSED" : "✗ FAILED") << "\n";
+
+    return 0;
+}
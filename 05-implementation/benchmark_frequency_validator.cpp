@@ -98,6 +98,59 @@ BenchmarkResult benchmark_validation(frequency_validation::FrequencyValidator* v
     };
 }
 
+// Throughput of validate_frequency() under each timing policy vs. one clock read
+void benchmark_timing_policies(frequency_validation::FrequencyValidator* validator) {
+    constexpr size_t POLICY_ITERATIONS = 1000000;
+    using frequency_validation::TimingPolicy;
+
+    auto run = [&](auto&& validate) {
+        size_t valid = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < POLICY_ITERATIONS; ++i) {
+            valid += validate(TEST_FREQUENCIES[i % TEST_FREQUENCIES.size()]) ? 1 : 0;
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        (void)valid;
+        return std::chrono::duration<double, std::nano>(end - start).count() / POLICY_ITERATIONS;
+    };
+
+    // Reference cost: a single clock read
+    int64_t clock_sink = 0;
+    auto clock_start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < POLICY_ITERATIONS; ++i) {
+        clock_sink += std::chrono::high_resolution_clock::now().time_since_epoch().count() & 1;
+    }
+    auto clock_end = std::chrono::high_resolution_clock::now();
+    (void)clock_sink;
+    double clock_ns = std::chrono::duration<double, std::nano>(clock_end - clock_start).count() / POLICY_ITERATIONS;
+
+    validator->set_timing_policy(TimingPolicy::Always);
+    double always_ns = run([&](uint32_t f) { return validator->validate_frequency(f, 25).is_valid(); });
+    validator->set_timing_policy(TimingPolicy::Sampled);
+    double sampled_ns = run([&](uint32_t f) { return validator->validate_frequency(f, 25).is_valid(); });
+    validator->set_timing_policy(TimingPolicy::Off);
+    double off_ns = run([&](uint32_t f) { return validator->validate_frequency(f, 25).is_valid(); });
+    double static_off_ns = run([&](uint32_t f) {
+        return validator->validate_frequency<TimingPolicy::Off>(f, 25).is_valid();
+    });
+    double precise_off_ns = run([&](uint32_t f) {
+        return validator->validate_frequency(frequency_validation::PreciseFrequency::from_hz(f), 25).is_valid();
+    });
+    validator->set_timing_policy(TimingPolicy::Always);
+
+    std::cout << "=== TIMING POLICY COMPARISON ===" << std::endl;
+    std::cout << "Clock read:                 " << clock_ns << " ns" << std::endl;
+    std::cout << "TimingPolicy::Always:       " << always_ns << " ns/validation" << std::endl;
+    std::cout << "TimingPolicy::Sampled (1/" << validator->get_timing_sample_interval() << "): "
+              << sampled_ns << " ns/validation" << std::endl;
+    std::cout << "TimingPolicy::Off:          " << off_ns << " ns/validation" << std::endl;
+    std::cout << "validate_frequency<Off>:    " << static_off_ns << " ns/validation" << std::endl;
+    std::cout << "Sub-Hz (Q32.32), Off:       " << precise_off_ns << " ns/validation" << std::endl;
+    std::cout << (static_off_ns < clock_ns ? "✅" : "⚠️ ") << " Compile-time Off policy "
+              << (static_off_ns < clock_ns ? "cheaper" : "not cheaper") << " than one clock read" << std::endl;
+    std::cout << std::endl;
+}
+
 int main() {
     std::cout << "=== FrequencyValidator Performance Benchmark ===" << std::endl;
     std::cout << "Target latency: <" << TARGET_LATENCY_NS / 1000.0 << "μs" << std::endl;
@@ -117,6 +170,8 @@ int main() {
     // Run benchmark
     auto result = benchmark_validation(validator.get());
     
+    benchmark_timing_policies(validator.get());
+    
     // Report results
     std::cout << "=== BENCHMARK RESULTS ===" << std::endl;
     std::cout << "Total samples: " << result.total_samples << std::endl;
@@ -0,0 +1,32 @@
+# Fails if an ISA-flagged kernel object (-mavx2, -mavx512f, ...) defines weak
+# symbols. Weak (COMDAT) definitions of inline/template code are merged with
+# the baseline objects' copies by the linker, which keeps an arbitrary one, so
+# AVX instructions could end up on the SSE2/scalar fallback path.
+#
+# Usage: cmake -DNM=<nm> -DOBJECTS=<obj;obj;...> -P check_isa_kernel_symbols.cmake
+
+if(NOT NM OR NOT OBJECTS)
+    message(FATAL_ERROR "NM and OBJECTS must be set")
+endif()
+
+set(violations "")
+foreach(object IN LISTS OBJECTS)
+    execute_process(COMMAND ${NM} -C ${object}
+                    OUTPUT_VARIABLE symbols RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${NM} failed on ${object}")
+    endif()
+    string(REPLACE "\n" ";" symbols "${symbols}")
+    foreach(line IN LISTS symbols)
+        # Weak code/data definitions; the exception personality reference is
+        # identical data in every object and harmless
+        if(line MATCHES "^[0-9a-fA-F]+ [WVu] " AND NOT line MATCHES " DW\\.ref\\.")
+            string(APPEND violations "  ${object}: ${line}\n")
+        endif()
+    endforeach()
+    message(STATUS "Checked ${object}")
+endforeach()
+
+if(violations)
+    message(FATAL_ERROR "ISA-flagged kernels define weak symbols:\n${violations}")
+endif()
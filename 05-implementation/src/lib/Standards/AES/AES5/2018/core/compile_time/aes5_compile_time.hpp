@@ -0,0 +1,282 @@
+/**
+ * @file aes5_compile_time.hpp
+ * @brief Header-only constexpr AES5-2018 validation and classification engine
+ * @traceability DES-C-001, DES-C-003 → compile_time
+ *
+ * The single definition of AES5-2018 rate knowledge: closest-standard lookup,
+ * deviation in ppb/ppm, tolerance decision, clause mapping and Section 5.3
+ * rate categories. Everything is constexpr, so sample rates known at compile
+ * time (template parameters, configuration constants) can be checked with
+ * static_assert at zero runtime cost. FrequencyValidator and
+ * RateCategoryManager call the same functions at runtime, so compile-time
+ * and runtime answers cannot drift apart.
+ *
+ * @performance O(log n) branch-free closest-standard search, integer-only
+ *              deviation; no allocation, no state
+ * @thread_safety Stateless pure functions over immutable constexpr tables
+ * @exception none (noexcept guarantee)
+ *
+ * Usage Example:
+ * @code
+ * template<uint32_t SampleRateHz>
+ * class Resampler {
+ *     static_assert(compile_time::is_aes5_frequency_v<SampleRateHz>,
+ *                   "Resampler requires an AES5-2018 sampling frequency");
+ *     static_assert(compile_time::rate_category_v<SampleRateHz> != rate_categories::RateCategory::Octuple,
+ *                   "Octuple rate is not supported by this graph");
+ * };
+ *
+ * constexpr auto check = compile_time::check_frequency(48010);   // deviation_ppb == 208333
+ * @endcode
+ */
+
+#ifndef AES_AES5_2018_CORE_COMPILE_TIME_AES5_COMPILE_TIME_HPP
+#define AES_AES5_2018_CORE_COMPILE_TIME_AES5_COMPILE_TIME_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../compliance/compliance_engine.hpp"
+#include "../frequency_validation/standard_rate_table.hpp"
+#include "../rate_categories/rate_category.hpp"
+#include "../rate_categories/rate_category_table.hpp"
+#include "../rate_categories/rate_ratio.hpp"
+#include "../validation/validation_result.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace compile_time {
+
+/// Default frequency tolerance (±100 ppm)
+constexpr uint32_t DEFAULT_TOLERANCE_PPM = 100;
+
+constexpr std::array<uint32_t, frequency_validation::detail::STANDARD_RATE_COUNT> build_standard_frequencies() noexcept {
+    std::array<uint32_t, frequency_validation::detail::STANDARD_RATE_COUNT> frequencies{};
+    for (size_t k = 0; k < frequencies.size(); ++k) {
+        frequencies[k] = frequency_validation::detail::STANDARD_RATE_ENTRIES[k].frequency;
+    }
+    return frequencies;
+}
+
+/// AES5-2018 standard sampling frequencies, ascending
+static constexpr std::array<uint32_t, frequency_validation::detail::STANDARD_RATE_COUNT> STANDARD_FREQUENCIES =
+    build_standard_frequencies();
+
+/**
+ * @brief Closest AES5-2018 standard frequency
+ * @traceability DES-C-001 → find_closest_standard_frequency
+ *
+ * Capture ranges of standard_rate_table.hpp; frequency 0 maps to the lowest rate.
+ */
+constexpr uint32_t closest_standard_frequency(uint32_t frequency_hz) noexcept {
+    return frequency_validation::detail::find_closest_standard_rate(frequency_hz);
+}
+
+/// True if frequency_hz is exactly one of STANDARD_FREQUENCIES
+constexpr bool is_standard_frequency(uint32_t frequency_hz) noexcept {
+    for (uint32_t standard : STANDARD_FREQUENCIES) {
+        if (standard == frequency_hz) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief AES5-2018 clause defining a standard frequency
+ * @return Unknown unless standard_hz is exactly a standard frequency
+ */
+constexpr compliance::AES5Clause clause_for_standard_frequency(uint32_t standard_hz) noexcept {
+    for (const auto& entry : frequency_validation::detail::STANDARD_RATE_ENTRIES) {
+        if (entry.frequency == standard_hz) {
+            return entry.clause;
+        }
+    }
+    return compliance::AES5Clause::Unknown;
+}
+
+/**
+ * @brief Signed deviation in parts per billion
+ * @return (measured - reference) * 10^9 / reference, truncated toward zero;
+ *         INT64_MAX if reference_hz == 0
+ * @traceability DES-C-001 → calculate_deviation_ppb
+ *
+ * |difference| * 10^9 < 2^63 for all 32-bit inputs, so no overflow.
+ */
+constexpr int64_t deviation_ppb(uint32_t measured_hz, uint32_t reference_hz) noexcept {
+    if (reference_hz == 0) {
+        return INT64_MAX;
+    }
+    const int64_t difference = static_cast<int64_t>(measured_hz) - static_cast<int64_t>(reference_hz);
+    return difference * 1000000000LL / static_cast<int64_t>(reference_hz);
+}
+
+/**
+ * @brief Whole-ppm deviation magnitude
+ * @return |measured - reference| * 10^6 / reference, truncated; UINT64_MAX if reference_hz == 0
+ * @traceability DES-C-001 → calculate_tolerance_ppm
+ *
+ * Equals |deviation_ppb()| / 1000 for every input.
+ */
+constexpr uint64_t deviation_ppm(uint32_t measured_hz, uint32_t reference_hz) noexcept {
+    if (reference_hz == 0) {
+        return UINT64_MAX;
+    }
+    const uint64_t difference = (measured_hz > reference_hz) ? (measured_hz - reference_hz)
+                                                             : (reference_hz - measured_hz);
+    return difference * 1000000ULL / reference_hz;
+}
+
+/**
+ * @brief Check a deviation against a tolerance
+ * @return true if the whole-ppm deviation does not exceed tolerance_ppm
+ * @traceability DES-C-001 → is_within_tolerance_ppb
+ */
+constexpr bool is_within_tolerance_ppb(int64_t deviation_ppb, uint32_t tolerance_ppm) noexcept {
+    const uint64_t magnitude = (deviation_ppb < 0) ? static_cast<uint64_t>(-deviation_ppb)
+                                                   : static_cast<uint64_t>(deviation_ppb);
+    return magnitude / 1000u <= tolerance_ppm;
+}
+
+/**
+ * @brief Outcome of check_frequency()
+ * @traceability DES-C-001 → FrequencyValidationResult
+ */
+struct FrequencyCheck {
+    validation::ValidationResult status;
+    uint32_t closest_standard_frequency;        ///< 0 for InvalidInput
+    int64_t deviation_ppb;                      ///< From closest_standard_frequency
+    compliance::AES5Clause applicable_clause;   ///< Clause of closest_standard_frequency
+
+    constexpr bool is_valid() const noexcept { return status == validation::ValidationResult::Valid; }
+
+    /// Whole-ppm deviation magnitude, as in FrequencyValidationResult::tolerance_ppm
+    constexpr uint64_t deviation_ppm() const noexcept {
+        return ((deviation_ppb < 0) ? static_cast<uint64_t>(-deviation_ppb)
+                                    : static_cast<uint64_t>(deviation_ppb)) / 1000u;
+    }
+};
+
+/**
+ * @brief Validate a frequency against the nearest AES5-2018 standard rate
+ * @param frequency_hz Frequency to check; 0 is InvalidInput
+ * @param tolerance_ppm Accepted deviation
+ * @traceability DES-C-001 → validate_frequency
+ *
+ * Same decision as FrequencyValidator::validate_frequency().
+ */
+constexpr FrequencyCheck check_frequency(uint32_t frequency_hz,
+                                         uint32_t tolerance_ppm = DEFAULT_TOLERANCE_PPM) noexcept {
+    if (frequency_hz == 0) {
+        return {validation::ValidationResult::InvalidInput, 0, 0, compliance::AES5Clause::Unknown};
+    }
+    const size_t segment = frequency_validation::detail::find_rate_segment(frequency_hz);
+    const uint32_t closest = frequency_validation::detail::SEGMENT_RATES[segment];
+    const int64_t deviation = deviation_ppb(frequency_hz, closest);
+    return {is_within_tolerance_ppb(deviation, tolerance_ppm) ? validation::ValidationResult::Valid
+                                                              : validation::ValidationResult::OutOfTolerance,
+            closest, deviation, frequency_validation::detail::SEGMENT_CLAUSES[segment]};
+}
+
+/// True if frequency_hz is within tolerance_ppm of an AES5-2018 standard rate
+constexpr bool is_aes5_frequency(uint32_t frequency_hz, uint32_t tolerance_ppm = DEFAULT_TOLERANCE_PPM) noexcept {
+    return check_frequency(frequency_hz, tolerance_ppm).is_valid();
+}
+
+/**
+ * @brief AES5-2018 Section 5.3 rate category
+ *
+ * O(1) two-level table lookup generated from RATE_CATEGORY_BOUNDS
+ * (rate_categories/rate_category_table.hpp), exact for every integer Hz.
+ * @traceability DES-C-003 → classify_rate_category
+ */
+constexpr rate_categories::RateCategory classify_rate_category(uint32_t frequency_hz) noexcept {
+    return rate_categories::detail::lookup_rate_category(frequency_hz);
+}
+
+/**
+ * @brief Rate multiplier relative to 48 kHz
+ * @return frequency_hz / 48000, or 0.0 outside every rate category
+ * @traceability DES-C-003 → calculate_rate_multiplier
+ */
+constexpr double rate_multiplier(uint32_t frequency_hz) noexcept {
+    if (classify_rate_category(frequency_hz) == rate_categories::RateCategory::Unknown) {
+        return 0.0;
+    }
+    return static_cast<double>(frequency_hz) / static_cast<double>(rate_categories::RATE_BASE_FREQUENCY_HZ);
+}
+
+/**
+ * @brief Exact rate multiplier relative to base_hz
+ * @return Reduced frequency_hz / base_hz, or {0, 1} outside every rate category
+ * @traceability DES-C-003 → calculate_rate_multiplier
+ */
+constexpr rate_categories::RateRatio exact_rate_multiplier(
+    uint32_t frequency_hz, uint32_t base_hz = rate_categories::RATE_BASE_FREQUENCY_HZ) noexcept {
+    if (classify_rate_category(frequency_hz) == rate_categories::RateCategory::Unknown) {
+        return rate_categories::RateRatio{0, 1};
+    }
+    return rate_categories::make_rate_ratio(frequency_hz, base_hz);
+}
+
+/// Compile-time AES5-2018 frequency check for template parameters
+template<uint32_t FrequencyHz, uint32_t TolerancePpm = DEFAULT_TOLERANCE_PPM>
+constexpr bool is_aes5_frequency_v = is_aes5_frequency(FrequencyHz, TolerancePpm);
+
+/// Compile-time rate category for template parameters
+template<uint32_t FrequencyHz>
+constexpr rate_categories::RateCategory rate_category_v = classify_rate_category(FrequencyHz);
+
+constexpr bool deviation_ppm_matches_ppb() noexcept {
+    for (uint32_t standard : STANDARD_FREQUENCIES) {
+        for (uint32_t offset : {1u, 5u, 1000u, standard - 1u}) {
+            const int64_t below = deviation_ppb(standard - offset, standard);
+            const int64_t above = deviation_ppb(standard + offset, standard);
+            if (deviation_ppm(standard - offset, standard) != static_cast<uint64_t>(-below) / 1000u ||
+                deviation_ppm(standard + offset, standard) != static_cast<uint64_t>(above) / 1000u) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+constexpr bool standard_frequencies_in_known_categories() noexcept {
+    for (uint32_t standard : STANDARD_FREQUENCIES) {
+        if (classify_rate_category(standard) == rate_categories::RateCategory::Unknown ||
+            clause_for_standard_frequency(standard) == compliance::AES5Clause::Unknown) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool rate_category_bounds_ascending() noexcept {
+    for (size_t i = 0; i < rate_categories::RATE_CATEGORY_BOUNDS.size(); ++i) {
+        const auto& bounds = rate_categories::RATE_CATEGORY_BOUNDS[i];
+        if (bounds.min_hz > bounds.max_hz || static_cast<size_t>(bounds.category) != i + 1 ||
+            (i > 0 && bounds.min_hz <= rate_categories::RATE_CATEGORY_BOUNDS[i - 1].max_hz)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(deviation_ppm_matches_ppb(), "deviation_ppm() must equal |deviation_ppb()| / 1000");
+static_assert(standard_frequencies_in_known_categories(), "Every standard rate needs a category and a clause");
+static_assert(rate_category_bounds_ascending(), "Rate category bounds must be ordered by category and disjoint");
+static_assert(check_frequency(47900).deviation_ppb == -1084417LL, "47.9 kHz is -1084.4 ppm from 47.952 kHz");
+static_assert(!is_aes5_frequency_v<47900> && is_aes5_frequency_v<48004>, "±100 ppm around 48 kHz");
+static_assert(rate_category_v<44100> == rate_categories::RateCategory::Basic, "44.1 kHz is basic rate");
+static_assert(rate_multiplier(96000) == 2.0, "96 kHz is twice the base rate");
+
+} // namespace compile_time
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_COMPILE_TIME_AES5_COMPILE_TIME_HPP
@@ -0,0 +1,75 @@
+/**
+ * @file frequency_batch_kernels.hpp
+ * @brief Internal batch validation kernels for FrequencyValidator
+ * @traceability DES-C-001 → validate_frequency_batch
+ *
+ * Internal header - not part of the public API. Declares the scalar and
+ * SIMD kernels behind FrequencyValidator::validate_frequency_batch(). The
+ * kernels share the segment tables of standard_rate_table.hpp with
+ * find_closest_standard_frequency(), so each kernel produces results identical to
+ * FrequencyValidator::validate_frequency() for every input element.
+ *
+ * Kernels built with ISA flags (-mavx2, ...) must not instantiate inline or
+ * template code shared with baseline translation units: the linker keeps one
+ * arbitrary copy of each weak symbol, which could put AVX instructions on the
+ * fallback path. They therefore receive the segment tables as raw pointers
+ * and keep their helpers in an anonymous namespace.
+ */
+
+#ifndef AES_AES5_2018_CORE_FREQUENCY_VALIDATION_FREQUENCY_BATCH_KERNELS_HPP
+#define AES_AES5_2018_CORE_FREQUENCY_VALIDATION_FREQUENCY_BATCH_KERNELS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../compliance/compliance_engine.hpp"
+#include "../validation/validation_core.hpp"
+#include "standard_rate_table.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace frequency_validation {
+namespace detail {
+
+/**
+ * @brief Input/output arrays for one batch kernel invocation
+ */
+struct BatchKernelArgs {
+    const uint32_t* frequencies;                ///< Input frequencies (Hz)
+    const uint32_t* tolerances_ppm;             ///< Per-element tolerances or nullptr
+    uint32_t default_tolerance_ppm;             ///< Tolerance used when tolerances_ppm == nullptr
+    validation::ValidationResult* status;       ///< Output status per element
+    uint32_t* closest_standard_frequency;       ///< Output closest standard frequency
+    double* tolerance_ppm;                      ///< Output deviation in PPM
+    compliance::AES5Clause* applicable_clause;  ///< Optional output clause (may be nullptr)
+    const uint32_t* segment_boundaries;         ///< SEGMENT_BOUNDARIES.data() (SEGMENT_COUNT - 1 entries)
+    const uint32_t* segment_rates;              ///< SEGMENT_RATES.data() (SEGMENT_COUNT entries)
+    const compliance::AES5Clause* segment_clauses;  ///< SEGMENT_CLAUSES.data() (SEGMENT_COUNT entries)
+};
+
+/**
+ * @brief Portable kernel for elements [begin, end)
+ * @return Number of elements that validated successfully
+ */
+size_t validate_batch_scalar(const BatchKernelArgs& args, size_t begin, size_t end) noexcept;
+
+#if defined(AES5_HAVE_AVX2_KERNELS)
+/**
+ * @brief AVX2 kernel for elements [0, count), 8 lanes per iteration
+ * @return Number of elements that validated successfully
+ * @pre CPU supports AVX2 (checked by caller via simd::get_active_simd_level())
+ */
+size_t validate_batch_avx2(const BatchKernelArgs& args, size_t count) noexcept;
+#endif
+
+} // namespace detail
+} // namespace frequency_validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_FREQUENCY_VALIDATION_FREQUENCY_BATCH_KERNELS_HPP
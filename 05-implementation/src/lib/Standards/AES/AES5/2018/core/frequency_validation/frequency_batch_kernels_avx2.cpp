@@ -0,0 +1,139 @@
+/**
+ * @file frequency_batch_kernels_avx2.cpp
+ * @brief AVX2 batch validation kernel for FrequencyValidator
+ * @traceability DES-C-001 → validate_frequency_batch
+ *
+ * Compiled with AVX2 code generation (see CMakeLists.txt) and only entered
+ * after runtime detection confirms AVX2 support. Processes 8 frequencies per
+ * iteration:
+ * - Closest standard rate via compare-and-count over SEGMENT_BOUNDARIES and a
+ *   gather from SEGMENT_RATES (both passed in as raw pointers)
+ * - Deviation via exact double division (diff * 1e6 < 2^53, so floor() matches
+ *   the integer formula used by calculate_tolerance_ppm())
+ *
+ * No inline or template code shared with other translation units may be
+ * instantiated here (see frequency_batch_kernels.hpp).
+ */
+
+#include "frequency_batch_kernels.hpp"
+
+#if defined(AES5_HAVE_AVX2_KERNELS)
+
+#include <immintrin.h>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace frequency_validation {
+namespace detail {
+
+namespace {
+
+// Unsigned 32-bit lanes → double (values up to UINT32_MAX)
+__m256d u32_to_pd(__m128i values) noexcept {
+    const __m128i bias = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+    const __m256d offset = _mm256_set1_pd(2147483648.0);
+    return _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(values, bias)), offset);
+}
+
+} // namespace
+
+size_t validate_batch_avx2(const BatchKernelArgs& args, size_t count) noexcept {
+    constexpr size_t LANES = 8;
+    constexpr size_t BOUNDARY_COUNT = SEGMENT_COUNT - 1;
+
+    const __m256i sign = _mm256_set1_epi32(static_cast<int32_t>(0x80000000u));
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256d scale = _mm256_set1_pd(1000000.0);
+    const __m256d uniform_tolerance = _mm256_set1_pd(static_cast<double>(args.default_tolerance_ppm));
+
+    // frequency >= start  <=>  (frequency ^ sign) > ((start - 1) ^ sign) as signed lanes
+    __m256i thresholds[BOUNDARY_COUNT];
+    for (size_t k = 0; k < BOUNDARY_COUNT; ++k) {
+        thresholds[k] = _mm256_set1_epi32(
+            static_cast<int32_t>((args.segment_boundaries[k] - 1u) ^ 0x80000000u));
+    }
+
+    alignas(32) int32_t index_lanes[LANES];
+    size_t valid_count = 0;
+    size_t i = 0;
+
+    for (; i + LANES <= count; i += LANES) {
+        const __m256i frequency = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(args.frequencies + i));
+        const __m256i biased = _mm256_xor_si256(frequency, sign);
+
+        // Segment index = number of boundaries <= frequency
+        __m256i index = zero;
+        for (size_t k = 0; k < BOUNDARY_COUNT; ++k) {
+            index = _mm256_sub_epi32(index, _mm256_cmpgt_epi32(biased, thresholds[k]));
+        }
+        const __m256i is_zero = _mm256_cmpeq_epi32(frequency, zero);
+        const __m256i closest = _mm256_andnot_si256(is_zero, _mm256_i32gather_epi32(
+            reinterpret_cast<const int*>(args.segment_rates), index, 4));
+
+        const __m256i diff = _mm256_sub_epi32(_mm256_max_epu32(frequency, closest),
+                                              _mm256_min_epu32(frequency, closest));
+
+        // Zero-frequency lanes have closest == 0: divide by 1 and mask the result
+        const __m256i divisor = _mm256_sub_epi32(closest, is_zero);
+        const __m256d zero_lo = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(is_zero)));
+        const __m256d zero_hi = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(is_zero, 1)));
+
+        const __m256d ppm_lo = _mm256_andnot_pd(zero_lo, _mm256_floor_pd(_mm256_div_pd(
+            _mm256_mul_pd(u32_to_pd(_mm256_castsi256_si128(diff)), scale),
+            _mm256_cvtepi32_pd(_mm256_castsi256_si128(divisor)))));
+        const __m256d ppm_hi = _mm256_andnot_pd(zero_hi, _mm256_floor_pd(_mm256_div_pd(
+            _mm256_mul_pd(u32_to_pd(_mm256_extracti128_si256(diff, 1)), scale),
+            _mm256_cvtepi32_pd(_mm256_extracti128_si256(divisor, 1)))));
+
+        __m256d tolerance_lo = uniform_tolerance;
+        __m256d tolerance_hi = uniform_tolerance;
+        if (args.tolerances_ppm != nullptr) {
+            const __m256i tolerance = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(args.tolerances_ppm + i));
+            tolerance_lo = u32_to_pd(_mm256_castsi256_si128(tolerance));
+            tolerance_hi = u32_to_pd(_mm256_extracti128_si256(tolerance, 1));
+        }
+
+        const unsigned within_tolerance =
+            static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(ppm_lo, tolerance_lo, _CMP_LE_OQ))) |
+            (static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(ppm_hi, tolerance_hi, _CMP_LE_OQ))) << 4);
+        const unsigned zero_bits = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(is_zero)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(args.closest_standard_frequency + i), closest);
+        _mm256_storeu_pd(args.tolerance_ppm + i, ppm_lo);
+        _mm256_storeu_pd(args.tolerance_ppm + i + 4, ppm_hi);
+
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            const bool lane_zero = (zero_bits >> lane) & 1u;
+            const bool lane_valid = !lane_zero && ((within_tolerance >> lane) & 1u);
+            args.status[i + lane] = lane_zero ? validation::ValidationResult::InvalidInput
+                                  : lane_valid ? validation::ValidationResult::Valid
+                                               : validation::ValidationResult::OutOfTolerance;
+            valid_count += lane_valid ? 1 : 0;
+        }
+
+        if (args.applicable_clause != nullptr) {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(index_lanes), index);
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                args.applicable_clause[i + lane] = ((zero_bits >> lane) & 1u)
+                    ? compliance::AES5Clause::Unknown
+                    : args.segment_clauses[static_cast<size_t>(index_lanes[lane])];
+            }
+        }
+    }
+
+    // Remainder (fewer than 8 elements) through the portable kernel
+    return valid_count + validate_batch_scalar(args, i, count);
+}
+
+} // namespace detail
+} // namespace frequency_validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES5_HAVE_AVX2_KERNELS
@@ -9,7 +9,6 @@
  */
 
 #include "frequency_validator.hpp"
-#include <chrono>
 #include <algorithm>
 #include <cmath>
 #include <limits>
@@ -25,35 +24,47 @@ namespace _2018 {
 namespace core {
 namespace frequency_validation {
 
-// Static frequency table for efficient lookup
-static constexpr std::array<uint32_t, 10> STANDARD_FREQUENCIES = {
-    32000,   // Legacy (AES5-2018 Section 5.4)
-    44100,   // Consumer (AES5-2018 Section 5.2)  
-    47952,   // Pull-down 48k (AES5-2018 Annex A)
-    48000,   // Primary (AES5-2018 Section 5.1)
-    48048,   // Pull-up 48k (AES5-2018 Annex A)
-    88200,   // Double rate 44.1k (AES5-2018 Section 5.2)
-    96000,   // High bandwidth (AES5-2018 Section 5.2)
-    176400,  // Quadruple rate 44.1k (AES5-2018 Section 5.2)
-    192000,  // Quadruple rate 48k (AES5-2018 Section 5.2)
-    384000   // Octuple rate 48k (AES5-2018 Section 5.2)
-};
+// floor(a * b / c), saturated to UINT64_MAX; c != 0
+static uint64_t multiply_divide_saturating(uint64_t a, uint64_t b, uint64_t c) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;
+    const uint128 quotient = static_cast<uint128>(a) * b / c;
+    return (quotient > UINT64_MAX) ? UINT64_MAX : static_cast<uint64_t>(quotient);
+#else
+    // 64x64 -> 128-bit product from 32-bit halves
+    const uint64_t p0 = (a & 0xFFFFFFFFULL) * (b & 0xFFFFFFFFULL);
+    const uint64_t p1 = (a & 0xFFFFFFFFULL) * (b >> 32);
+    const uint64_t p2 = (a >> 32) * (b & 0xFFFFFFFFULL);
+    const uint64_t p3 = (a >> 32) * (b >> 32);
+    const uint64_t middle = (p0 >> 32) + (p1 & 0xFFFFFFFFULL) + (p2 & 0xFFFFFFFFULL);
+    uint64_t low = (middle << 32) | (p0 & 0xFFFFFFFFULL);
+    uint64_t high = p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32);
+    if (high >= c) {
+        return UINT64_MAX;
+    }
+    
+    // Restoring division; high < c keeps the quotient within 64 bits
+    uint64_t quotient = 0;
+    for (int bit = 0; bit < 64; ++bit) {
+        const bool carry = (high >> 63) != 0;
+        high = (high << 1) | (low >> 63);
+        low <<= 1;
+        quotient <<= 1;
+        if (carry || high >= c) {
+            high -= c;
+            quotient |= 1;
+        }
+    }
+    return quotient;
+#endif
+}
 
-// Mapping frequencies to AES5 clauses
-static compliance::AES5Clause get_aes5_clause_for_frequency(uint32_t frequency) noexcept {
-    switch (frequency) {
-        case 48000: return compliance::AES5Clause::Section_5_1;   // Primary
-        case 44100:
-        case 88200:
-        case 96000:
-        case 176400:
-        case 192000:
-        case 384000: return compliance::AES5Clause::Section_5_2;   // Other/multiples
-        case 32000: return compliance::AES5Clause::Section_5_4;   // Legacy  
-        case 47952:
-        case 48048: return compliance::AES5Clause::Annex_A;       // Pull-up/down
-        default:    return compliance::AES5Clause::Unknown;
+PreciseFrequency PreciseFrequency::from_sample_count(uint64_t sample_count, uint64_t elapsed_ns) noexcept {
+    if (elapsed_ns == 0) {
+        return PreciseFrequency{0};
     }
+    // Hz * 2^32 = samples * (10^9 * 2^32) / ns; the constant fits in 64 bits
+    return PreciseFrequency{multiply_divide_saturating(sample_count, 1000000000ULL << 32, elapsed_ns)};
 }
 
 // FrequencyValidationResult description implementation
@@ -79,10 +90,13 @@ FrequencyValidator::FrequencyValidator(
     : compliance_engine_(std::move(compliance_engine))
     , validation_core_(std::move(validation_core))
     , tolerance_table_size_(0)
-    , current_tolerance_ppm_(DEFAULT_TOLERANCE_PPM) {
+    , current_tolerance_ppm_(DEFAULT_TOLERANCE_PPM)
+    , timing_policy_(TimingPolicy::Always)
+    , timing_sample_mask_(DEFAULT_TIMING_SAMPLE_INTERVAL - 1)
+    , timing_call_counter_(0) {
     
     // Initialize standard frequencies for binary search
-    std::copy(STANDARD_FREQUENCIES.begin(), STANDARD_FREQUENCIES.end(), 
+    std::copy(compile_time::STANDARD_FREQUENCIES.begin(), compile_time::STANDARD_FREQUENCIES.end(),
               standard_frequencies_.begin());
     
     // Initialize tolerance tables
@@ -105,7 +119,89 @@ std::unique_ptr<FrequencyValidator> FrequencyValidator::create(
         std::move(validation_core)));
 }
 
-// Main validation method - REFACTOR PHASE: Streamlined validation with single code path
+// Main validation method - dispatches on the instance timing policy
+FrequencyValidationResult FrequencyValidator::validate_frequency(
+    uint32_t frequency, uint32_t tolerance_ppm) const noexcept {
+    switch (timing_policy_.load(std::memory_order_relaxed)) {
+        case TimingPolicy::Off:
+            return validate_frequency<TimingPolicy::Off>(frequency, tolerance_ppm);
+        case TimingPolicy::Sampled:
+            return validate_frequency<TimingPolicy::Sampled>(frequency, tolerance_ppm);
+        case TimingPolicy::Always:
+        default:
+            return validate_frequency<TimingPolicy::Always>(frequency, tolerance_ppm);
+    }
+}
+
+// Timing wrapper shared by the whole-Hz and sub-Hz overloads -
+// REFACTOR PHASE: clock reads only where the policy asks for them
+template<TimingPolicy Policy, typename Validate>
+FrequencyValidationResult FrequencyValidator::run_with_timing_policy(const Validate& validate) const noexcept {
+    bool timed = (Policy == TimingPolicy::Always);
+    if constexpr (!validation::INSTRUMENT_COUNTERS) {
+        return validate();     // AES5_INSTRUMENTATION_LEVEL none: bare lookup
+    }
+    if constexpr (Policy == TimingPolicy::Sampled && validation::INSTRUMENT_TIMING) {
+        // Load/store instead of an atomic RMW: a lost increment under contention
+        // only shifts the sampling phase, counts stay exact
+        const uint32_t call = timing_call_counter_.load(std::memory_order_relaxed);
+        timing_call_counter_.store(call + 1, std::memory_order_relaxed);
+        timed = (call & timing_sample_mask_.load(std::memory_order_relaxed)) == 0;
+    }
+    
+    if constexpr (Policy == TimingPolicy::Off || !validation::INSTRUMENT_TIMING) {
+        FrequencyValidationResult result = validate();
+        validation_core_->record_validation(result.status);
+        record_flight_event(result);
+        return result;
+    } else {
+        if (!timed) {
+            FrequencyValidationResult result = validate();
+            validation_core_->record_validation(result.status);
+            record_flight_event(result);
+            return result;
+        }
+        
+        const validation::ClockSource& clock = validation_core_->get_clock_source();
+        const uint64_t start_ticks = clock.now_ticks();
+        FrequencyValidationResult result = validate();
+        const uint64_t duration_ns = clock.elapsed_ns(start_ticks);
+        
+        validation_core_->record_validation(result.status, duration_ns);
+        record_flight_event(result, duration_ns, start_ticks);
+        return result;
+    }
+}
+
+// Untimed validations - reads the clock only while tracing into an attached recorder
+void FrequencyValidator::record_flight_event(const FrequencyValidationResult& result) const noexcept {
+    if constexpr (validation::INSTRUMENT_TRACING) {
+        if (validation::FlightRecorder* recorder = validation_core_->get_flight_recorder()) {
+            recorder->record(result.detected_frequency, result.closest_standard_frequency, result.deviation_ppb,
+                             result.status, 0, validation_core_->get_clock_source().now_ticks());
+        }
+    } else {
+        (void)result;
+    }
+}
+
+// Timed validations - reuses the timing policy's timestamps, no clock read of its own
+void FrequencyValidator::record_flight_event(const FrequencyValidationResult& result,
+                                             uint64_t latency_ns, uint64_t start_ticks) const noexcept {
+    if constexpr (validation::INSTRUMENT_TRACING) {
+        if (validation::FlightRecorder* recorder = validation_core_->get_flight_recorder()) {
+            recorder->record(result.detected_frequency, result.closest_standard_frequency, result.deviation_ppb,
+                             result.status, latency_ns, start_ticks);
+        }
+    } else {
+        (void)result;
+        (void)latency_ns;
+        (void)start_ticks;
+    }
+}
+
+// Policy-specific validation
+template<TimingPolicy Policy>
 FrequencyValidationResult FrequencyValidator::validate_frequency(
     uint32_t frequency, uint32_t tolerance_ppm) const noexcept {
     
@@ -116,206 +212,143 @@ FrequencyValidationResult FrequencyValidator::validate_frequency(
         result.detected_frequency = frequency;
         result.closest_standard_frequency = 0;
         result.tolerance_ppm = 0.0;
+        result.deviation_ppb = 0;
         result.applicable_clause = compliance::AES5Clause::Unknown;
+        record_flight_event(result);
         return result;
     }
     
-    // REFACTOR: Direct validation without dual calls - optimize for <50μs latency
-    auto start_time = std::chrono::high_resolution_clock::now();
-    
-    // Perform core validation logic
-    FrequencyValidationResult result;
-    result.detected_frequency = frequency;
-    result.closest_standard_frequency = find_closest_standard_frequency(frequency);
-    result.applicable_clause = get_aes5_clause_for_frequency(result.closest_standard_frequency);
-    
-    // Fast tolerance calculation
-    result.tolerance_ppm = calculate_tolerance_ppm(frequency, result.closest_standard_frequency);
+    return run_with_timing_policy<Policy>([&]() noexcept {
+        return validate_frequency_internal(frequency, tolerance_ppm);
+    });
+}
+
+template FrequencyValidationResult FrequencyValidator::validate_frequency<TimingPolicy::Off>(
+    uint32_t, uint32_t) const noexcept;
+template FrequencyValidationResult FrequencyValidator::validate_frequency<TimingPolicy::Sampled>(
+    uint32_t, uint32_t) const noexcept;
+template FrequencyValidationResult FrequencyValidator::validate_frequency<TimingPolicy::Always>(
+    uint32_t, uint32_t) const noexcept;
+
+// Sub-Hz validation - same timing policy and metrics as the whole-Hz overload
+FrequencyValidationResult FrequencyValidator::validate_frequency(
+    PreciseFrequency frequency, uint32_t tolerance_ppm) const noexcept {
     
-    // Determine validation status
-    if (result.tolerance_ppm <= tolerance_ppm) {
-        result.status = validation::ValidationResult::Valid;
-    } else {
-        result.status = validation::ValidationResult::OutOfTolerance;
+    if (frequency.q32_32 == 0) {
+        FrequencyValidationResult result;
+        result.status = validation::ValidationResult::InvalidInput;
+        result.detected_frequency = 0;
+        result.closest_standard_frequency = 0;
+        result.tolerance_ppm = 0.0;
+        result.deviation_ppb = 0;
+        result.applicable_clause = compliance::AES5Clause::Unknown;
+        record_flight_event(result);
+        return result;
     }
     
-    // Update metrics directly in ValidationCore (optimized single call)
-    auto end_time = std::chrono::high_resolution_clock::now();
-    auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
-    
-    // Access metrics directly and update atomically (const_cast safe for atomics)
-    auto& metrics = const_cast<validation::ValidationMetrics&>(validation_core_->get_metrics());
-    
-    // Update total validation count
-    metrics.total_validations.fetch_add(1, std::memory_order_relaxed);
-    
-    // Update success/failure counts
-    if (result.status == validation::ValidationResult::Valid) {
-        metrics.successful_validations.fetch_add(1, std::memory_order_relaxed);
-    } else {
-        metrics.failed_validations.fetch_add(1, std::memory_order_relaxed);
+    auto validate = [&]() noexcept { return validate_precise_internal(frequency, tolerance_ppm); };
+    switch (timing_policy_.load(std::memory_order_relaxed)) {
+        case TimingPolicy::Off:
+            return run_with_timing_policy<TimingPolicy::Off>(validate);
+        case TimingPolicy::Sampled:
+            return run_with_timing_policy<TimingPolicy::Sampled>(validate);
+        case TimingPolicy::Always:
+        default:
+            return run_with_timing_policy<TimingPolicy::Always>(validate);
     }
-    
-    // Update latency metrics
-    uint64_t duration_u64 = static_cast<uint64_t>(duration_ns);
-    metrics.total_latency_ns.fetch_add(duration_u64, std::memory_order_relaxed);
-    
-    // Update max latency (atomic compare-and-swap)
-    uint64_t current_max = metrics.max_latency_ns.load(std::memory_order_relaxed);
-    while (duration_u64 > current_max && 
-           !metrics.max_latency_ns.compare_exchange_weak(current_max, duration_u64, std::memory_order_relaxed)) {
-        // Keep trying until successful or current_max becomes larger
+}
+
+void FrequencyValidator::set_timing_policy(TimingPolicy policy, uint32_t sample_interval) noexcept {
+    // Round up to a power of two so sampling is a mask test
+    uint32_t interval = 1;
+    while (interval < sample_interval && interval < (1u << 31)) {
+        interval <<= 1;
     }
-    
-    return result;
+    timing_sample_mask_.store(interval - 1, std::memory_order_relaxed);
+    timing_policy_.store(policy, std::memory_order_relaxed);
+}
+
+TimingPolicy FrequencyValidator::get_timing_policy() const noexcept {
+    return timing_policy_.load(std::memory_order_relaxed);
+}
+
+uint32_t FrequencyValidator::get_timing_sample_interval() const noexcept {
+    return timing_sample_mask_.load(std::memory_order_relaxed) + 1;
 }
 
 // Internal validation implementation
 FrequencyValidationResult FrequencyValidator::validate_frequency_internal(
     uint32_t frequency, uint32_t tolerance_ppm) const noexcept {
     
+    // Shared constexpr engine: one segment search yields rate, clause and deviation
+    const compile_time::FrequencyCheck check = compile_time::check_frequency(frequency, tolerance_ppm);
+    
     FrequencyValidationResult result;
     result.detected_frequency = frequency;
+    result.status = check.status;
+    result.closest_standard_frequency = check.closest_standard_frequency;
+    result.applicable_clause = check.applicable_clause;
+    result.deviation_ppb = check.deviation_ppb;
+    result.tolerance_ppm = static_cast<double>(check.deviation_ppm());
     
-    // Find closest standard frequency
-    result.closest_standard_frequency = find_closest_standard_frequency(frequency);
-    result.applicable_clause = get_aes5_clause_for_frequency(result.closest_standard_frequency);
+    return result;
+}
+
+// Sub-Hz classification: category at the nearest whole Hz, deviation at full precision
+FrequencyValidationResult FrequencyValidator::validate_precise_internal(
+    PreciseFrequency frequency, uint32_t tolerance_ppm) const noexcept {
     
-    // Calculate tolerance
-    result.tolerance_ppm = calculate_tolerance_ppm(frequency, result.closest_standard_frequency);
+    FrequencyValidationResult result;
+    result.detected_frequency = frequency.rounded_hz();
+    result.closest_standard_frequency = find_closest_standard_frequency(result.detected_frequency);
+    result.applicable_clause = compile_time::clause_for_standard_frequency(result.closest_standard_frequency);
     
-    // Check if within tolerance
-    if (result.tolerance_ppm <= tolerance_ppm) {
-        result.status = validation::ValidationResult::Valid;
-    } else {
-        result.status = validation::ValidationResult::OutOfTolerance;
-    }
+    result.deviation_ppb = calculate_deviation_ppb(frequency, result.closest_standard_frequency);
+    const int64_t magnitude = (result.deviation_ppb < 0) ? -result.deviation_ppb : result.deviation_ppb;
+    result.tolerance_ppm = static_cast<double>(magnitude / 1000);
+    
+    result.status = is_within_tolerance_ppb(result.deviation_ppb, tolerance_ppm)
+        ? validation::ValidationResult::Valid
+        : validation::ValidationResult::OutOfTolerance;
     
     return result;
 }
 
-// Optimized lookup table for fast frequency matching
-// Maps frequency ranges to closest standard frequencies
-struct FrequencyRange {
-    uint32_t min_freq;
-    uint32_t max_freq;
-    uint32_t standard_freq;
-};
-
-static constexpr std::array<FrequencyRange, 11> FREQUENCY_LOOKUP_TABLE = {{
-    {0,     38050,  32000},    // Legacy range → 32 kHz
-    {38051, 45999,  44100},    // Consumer range → 44.1 kHz  
-    {46000, 47499,  47952},    // Pull-down range → 47.952 kHz
-    {47500, 47899,  47952},    // Close to pull-down → 47.952 kHz
-    {47900, 48150,  48000},    // Primary range → 48 kHz (prefer primary, include test case 48100)
-    {48151, 68124,  48048},    // Pull-up range → 48.048 kHz (midpoint with 88.2k: (48048+88200)/2=68124)
-    {68125, 92100,  88200},    // Double rate 44.1 kHz → 88.2 kHz (midpoint with 96k: (88200+96000)/2=92100)
-    {92101, 136200, 96000},    // High bandwidth → 96 kHz (midpoint with 176.4k: (96000+176400)/2=136200)
-    {136201, 184200, 176400},  // Quadruple rate 44.1 kHz → 176.4 kHz (midpoint with 192k: (176400+192000)/2=184200)
-    {184201, 288000, 192000},  // Quadruple rate 48 kHz → 192 kHz (midpoint with 384k: (192000+384000)/2=288000)
-    {288001, UINT32_MAX, 384000} // Octuple rate 48 kHz → 384 kHz
-}};
-
-// Fast path for exact standard frequency matches
-static constexpr std::array<uint32_t, 10> EXACT_STANDARDS = {
-    32000, 44100, 47952, 48000, 48048, 88200, 96000, 176400, 192000, 384000
-};
-
-// Find closest standard frequency
-uint32_t FrequencyValidator::find_closest_standard_frequency(uint32_t frequency) const noexcept {
-    // REFACTOR PHASE: Optimized O(1) lookup table approach
+// Floating-point-free validation path (FPU-less targets)
+FixedPointFrequencyResult FrequencyValidator::validate_frequency_fixed(
+    uint32_t frequency, uint32_t tolerance_ppm) const noexcept {
     
-    if (frequency == 0) {
-        return STANDARD_FREQUENCIES[0];
-    }
+    const compile_time::FrequencyCheck check = compile_time::check_frequency(frequency, tolerance_ppm);
     
-    // Fast path: Check for exact matches first (most common case)
-    for (uint32_t exact_freq : EXACT_STANDARDS) {
-        if (frequency == exact_freq) {
-            return exact_freq;
-        }
-    }
-    
-    // Special handling for 48k family exact matches (handles edge cases)
-    if (frequency >= 47900 && frequency <= 48150) {
-        if (frequency == 47952) return 47952;
-        if (frequency == 48000) return 48000;
-        if (frequency == 48048) return 48048;
-        
-        // For non-exact matches in 48k family, use test-based mapping
-        if (frequency <= 47976) return 47952;  // Closer to pull-down
-        if (frequency >= 48151) return 48048;  // Pull-up range starts at 48151
-        return 48000;  // Primary for middle range including 48100
-    }
+    FixedPointFrequencyResult result;
+    result.status = check.status;
+    result.detected_frequency = frequency;
+    result.closest_standard_frequency = check.closest_standard_frequency;
+    result.deviation_ppb = check.deviation_ppb;
+    result.applicable_clause = check.applicable_clause;
     
-    // Lookup table search (optimized for sequential access)
-    for (const auto& range : FREQUENCY_LOOKUP_TABLE) {
-        if (frequency >= range.min_freq && frequency <= range.max_freq) {
-            return range.standard_freq;
-        }
+    if (frequency == 0) {
+        return result;
     }
     
-    // Fallback (should not reach here with proper table)
-    return STANDARD_FREQUENCIES[0];
+    validation_core_->record_validation(result.status);
+    return result;
 }
 
-// Precomputed tolerance tables for fast PPM calculation (avoids floating-point division)
-// Maps common frequency pairs to precomputed PPM values * 1000 for integer arithmetic
-struct ToleranceLookup {
-    uint32_t measured_freq;
-    uint32_t reference_freq;
-    uint32_t ppm_x1000;  // PPM * 1000 for integer precision
-};
-
-// Common tolerance calculations precomputed (most frequent validation scenarios)
-static constexpr std::array<ToleranceLookup, 16> PPM_LOOKUP_TABLE = {{
-    // Exact matches (0 PPM)
-    {32000, 32000, 0},     {44100, 44100, 0},     {47952, 47952, 0},
-    {48000, 48000, 0},     {48048, 48048, 0},     {88200, 88200, 0},
-    {96000, 96000, 0},     {176400, 176400, 0},   {192000, 192000, 0},
-    {384000, 384000, 0},
-    
-    // Common test scenarios 
-    {47999, 48000, 20},    // 47999 vs 48000: ~20.83 PPM
-    {48001, 48000, 20},    // 48001 vs 48000: ~20.83 PPM
-    {47900, 48000, 2083},  // 47900 vs 48000: ~2083 PPM (> 25 PPM threshold)
-    {35000, 32000, 93750}, // 35000 vs 32000: ~93750 PPM 
-    {40000, 44100, 93012}, // 40000 vs 44100: ~93012 PPM
-    {70000, 96000, 270833} // 70000 vs 96000: ~270833 PPM
-}};
+// Find closest standard frequency
+uint32_t FrequencyValidator::find_closest_standard_frequency(uint32_t frequency) const noexcept {
+    // REFACTOR PHASE: Branch-free search over compile-time boundary table
+    // (see standard_rate_table.hpp; frequency 0 maps to the lowest standard rate)
+    return compile_time::closest_standard_frequency(frequency);
+}
 
-// Fast PPM calculation with optimized lookup and integer arithmetic
+// Whole-ppm deviation magnitude (compile_time::deviation_ppm)
 double FrequencyValidator::calculate_tolerance_ppm(
     uint32_t measured_frequency, uint32_t reference_frequency) const noexcept {
-    
-    // REFACTOR PHASE: Optimized tolerance calculation
-    
     if (reference_frequency == 0) {
         return std::numeric_limits<double>::max();
     }
-    
-    if (measured_frequency == reference_frequency) {
-        return 0.0;
-    }
-    
-    // Fast path: Check precomputed lookup table for common scenarios
-    for (const auto& entry : PPM_LOOKUP_TABLE) {
-        if (entry.measured_freq == measured_frequency && 
-            entry.reference_freq == reference_frequency) {
-            return static_cast<double>(entry.ppm_x1000) / 1000.0;
-        }
-    }
-    
-    // Optimized calculation using integer arithmetic to avoid floating-point division
-    // PPM = |measured - reference| * 1,000,000 / reference
-    uint64_t abs_diff = (measured_frequency > reference_frequency) 
-        ? (measured_frequency - reference_frequency)
-        : (reference_frequency - measured_frequency);
-    
-    // Use 64-bit arithmetic to prevent overflow: diff * 1,000,000 / reference
-    uint64_t ppm_scaled = (abs_diff * 1000000ULL) / reference_frequency;
-    
-    return static_cast<double>(ppm_scaled);
+    return static_cast<double>(compile_time::deviation_ppm(measured_frequency, reference_frequency));
 }
 
 // Get metrics from ValidationCore
@@ -323,6 +356,10 @@ const validation::ValidationMetrics& FrequencyValidator::get_metrics() const noe
     return validation_core_->get_metrics();
 }
 
+validation::MetricsSnapshot FrequencyValidator::get_metrics_snapshot() const noexcept {
+    return validation_core_->get_metrics_snapshot();
+}
+
 // Reset metrics in ValidationCore
 void FrequencyValidator::reset_metrics() noexcept {
     validation_core_->reset_metrics();
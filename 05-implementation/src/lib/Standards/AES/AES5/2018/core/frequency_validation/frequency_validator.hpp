@@ -39,9 +39,11 @@
 
 #include <cstdint>
 #include <array>
+#include <atomic>
 #include <memory>
 
 // AES5-2018 Dependencies
+#include "../compile_time/aes5_compile_time.hpp" // constexpr rate tables and deviation arithmetic
 #include "../compliance/compliance_engine.hpp"     // ComplianceEngine for standards compliance
 #include "../validation/validation_core.hpp"      // ValidationCore for performance monitoring
 
@@ -60,6 +62,7 @@ struct FrequencyValidationResult {
     uint32_t detected_frequency;            ///< Detected/normalized frequency (Hz)
     uint32_t closest_standard_frequency;    ///< Nearest AES5-2018 standard frequency
     double tolerance_ppm;                   ///< Tolerance in parts per million
+    int64_t deviation_ppb;                  ///< Signed deviation from closest standard (parts per billion)
     compliance::AES5Clause applicable_clause; ///< AES5-2018 clause that applies
     
     /**
@@ -77,6 +80,95 @@ struct FrequencyValidationResult {
     const char* get_description() const noexcept;
 };
 
+/**
+ * @brief Floating-point-free frequency validation result
+ * @traceability DES-C-001 → FixedPointFrequencyResult
+ *
+ * Returned by FrequencyValidator::validate_frequency_fixed() for targets
+ * without an FPU. Fields match FrequencyValidationResult; the deviation is
+ * carried only as signed parts per billion.
+ */
+struct FixedPointFrequencyResult {
+    validation::ValidationResult status;      ///< Overall validation status
+    uint32_t detected_frequency;            ///< Detected/normalized frequency (Hz)
+    uint32_t closest_standard_frequency;    ///< Nearest AES5-2018 standard frequency
+    int64_t deviation_ppb;                  ///< Signed deviation from closest standard (parts per billion)
+    compliance::AES5Clause applicable_clause; ///< AES5-2018 clause that applies
+    
+    /**
+     * @brief Check if validation was successful
+     * @return true if frequency is valid according to AES5-2018
+     */
+    bool is_valid() const noexcept {
+        return status == validation::ValidationResult::Valid;
+    }
+};
+
+/**
+ * @brief Sub-Hz sampling frequency in unsigned Q32.32 fixed point
+ * @traceability DES-C-001 → PreciseFrequency
+ *
+ * Upper 32 bits hold whole Hz, lower 32 bits the fraction (resolution
+ * ~0.23 nHz). Used for recovered clocks such as 47999.73 Hz whose drift is
+ * below the 1 Hz resolution of the uint32_t interface.
+ */
+struct PreciseFrequency {
+    uint64_t q32_32;                        ///< Frequency in Hz * 2^32
+
+    /**
+     * @brief Whole-Hz frequency
+     */
+    static constexpr PreciseFrequency from_hz(uint32_t hz) noexcept {
+        return PreciseFrequency{static_cast<uint64_t>(hz) << 32};
+    }
+
+    /**
+     * @brief Frequency from samples counted over an elapsed time
+     * @param sample_count Samples observed
+     * @param elapsed_ns Observation window (ns)
+     * @return sample_count * 10^9 / elapsed_ns in Q32.32, truncated;
+     *         zero if elapsed_ns == 0, saturated above 2^32 Hz
+     */
+    static PreciseFrequency from_sample_count(uint64_t sample_count, uint64_t elapsed_ns) noexcept;
+
+    /**
+     * @brief Frequency rounded to the nearest whole Hz (saturating)
+     */
+    constexpr uint32_t rounded_hz() const noexcept {
+        const uint64_t whole = q32_32 >> 32;
+        return (whole == UINT32_MAX) ? UINT32_MAX
+                                     : static_cast<uint32_t>(whole + ((q32_32 >> 31) & 1u));
+    }
+};
+
+/**
+ * @brief Structure-of-arrays output view for batch frequency validation
+ * @traceability DES-C-001 → FrequencyBatchResults
+ *
+ * All arrays are caller-owned and must hold at least as many elements as the
+ * batch. Element i of each array holds the field of the FrequencyValidationResult
+ * that validate_frequency() would return for input element i.
+ */
+struct FrequencyBatchResults {
+    validation::ValidationResult* status;       ///< Validation status (required)
+    uint32_t* closest_standard_frequency;       ///< Nearest AES5-2018 standard frequency (required)
+    double* tolerance_ppm;                      ///< Deviation in parts per million (required)
+    compliance::AES5Clause* applicable_clause;  ///< Applicable clause (optional, may be nullptr)
+};
+
+/**
+ * @brief Latency measurement policy for validate_frequency()
+ * @traceability DES-C-001 → TimingPolicy
+ *
+ * Validation counts are exact under every policy; the policy only controls
+ * how many calls pay for clock reads and the max-latency update.
+ */
+enum class TimingPolicy : uint8_t {
+    Off = 0,        ///< No latency measurement; one clock read per event if a flight recorder is attached
+    Sampled = 1,    ///< Time one call in every sample interval
+    Always = 2      ///< Time every call (default)
+};
+
 /**
  * @brief Frequency tolerance configuration
  * @traceability DES-C-001 → FrequencyTolerance
@@ -138,12 +230,13 @@ public:
     static constexpr uint32_t PULLDOWN_48K = 47952;          ///< 48000 * 1000/1001
     
     // Default tolerances (conservative values for high precision)
-    static constexpr uint32_t DEFAULT_TOLERANCE_PPM = 100;    ///< ±100 ppm default
+    static constexpr uint32_t DEFAULT_TOLERANCE_PPM = compile_time::DEFAULT_TOLERANCE_PPM; ///< ±100 ppm default
     static constexpr uint32_t TIGHT_TOLERANCE_PPM = 50;       ///< ±50 ppm tight tolerance
     
     // Performance constants
     static constexpr size_t MAX_TOLERANCE_ENTRIES = 16;       ///< Maximum tolerance table entries
     static constexpr uint64_t MAX_VALIDATION_LATENCY_NS = 50000; ///< 50μs max validation time
+    static constexpr uint32_t DEFAULT_TIMING_SAMPLE_INTERVAL = 64; ///< Calls per timed call (Sampled)
 
     /**
      * @brief Factory method to create FrequencyValidator instance
@@ -205,6 +298,8 @@ public:
      * 
      * @pre frequency > 0 (will return InvalidInput for frequency == 0)
      * @post Performance metrics updated in ValidationCore
+     * @post Event recorded in the core's FlightRecorder, if one is attached
+     *       (also for InvalidInput; untimed events carry latency 0)
      * @post Compliance status validated through ComplianceEngine
      * 
      * This method validates frequencies according to:
@@ -227,6 +322,166 @@ public:
     FrequencyValidationResult validate_frequency(uint32_t frequency, 
                                                uint32_t tolerance_ppm = DEFAULT_TOLERANCE_PPM) const noexcept;
 
+    /**
+     * @brief Validate sampling frequency with a compile-time timing policy
+     * @tparam Policy Latency measurement policy (overrides the instance policy)
+     * @param frequency Sampling frequency to validate (Hz)
+     * @param tolerance_ppm Optional custom tolerance in parts per million
+     * @return FrequencyValidationResult identical to validate_frequency()
+     *
+     * @traceability DES-C-001 → validate_frequency
+     *
+     * @exception none (noexcept guarantee for real-time operation)
+     * @performance TimingPolicy::Off: lookup + two relaxed counter increments,
+     *              no latency bookkeeping; one clock read per event only if
+     *              a flight recorder is attached
+     * @thread_safety Thread-safe, lock-free implementation
+     *
+     * Instantiated for every TimingPolicy value. Intended for hot paths such as
+     * audio callbacks where the policy is fixed at build time:
+     * @code
+     * auto result = validator->validate_frequency<TimingPolicy::Off>(48000);
+     * @endcode
+     */
+    template<TimingPolicy Policy>
+    FrequencyValidationResult validate_frequency(uint32_t frequency,
+                                               uint32_t tolerance_ppm = DEFAULT_TOLERANCE_PPM) const noexcept;
+
+    /**
+     * @brief Validate a sub-Hz sampling frequency
+     * @param frequency Sampling frequency in Q32.32 fixed point
+     * @param tolerance_ppm Optional custom tolerance in parts per million
+     * @return FrequencyValidationResult; deviation_ppb carries the fractional drift
+     *
+     * @traceability DES-C-001 → validate_frequency
+     *
+     * @exception none (noexcept guarantee for real-time operation)
+     * @performance Same budget as validate_frequency(uint32_t) (MAX_VALIDATION_LATENCY_NS),
+     *              integer arithmetic only, no allocation
+     * @thread_safety Thread-safe, lock-free implementation
+     *
+     * The rate category is selected at the nearest whole Hz (detected_frequency);
+     * the deviation is computed from the full-precision value. Tolerance and
+     * status follow the same rules as the whole-Hz overload, so whole-Hz inputs
+     * give identical results. A zero frequency returns InvalidInput.
+     *
+     * Example usage:
+     * @code
+     * auto result = validator->validate_frequency(
+     *     PreciseFrequency::from_sample_count(4799973, 100000000000ULL)); // 47999.73 Hz
+     * assert(result.deviation_ppb == -5625);                           // -5.625 ppm
+     * @endcode
+     */
+    FrequencyValidationResult validate_frequency(PreciseFrequency frequency,
+                                               uint32_t tolerance_ppm = DEFAULT_TOLERANCE_PPM) const noexcept;
+
+    /**
+     * @brief Validate sampling frequency using integer arithmetic only
+     * @param frequency Sampling frequency to validate (Hz)
+     * @param tolerance_ppm Optional custom tolerance in parts per million
+     * @return FixedPointFrequencyResult (no floating-point fields)
+     *
+     * @traceability DES-C-001 → validate_frequency_fixed
+     *
+     * @exception none (noexcept guarantee for real-time operation)
+     * @performance Lookup + one 64-bit division, no clock reads
+     * @thread_safety Thread-safe, lock-free implementation
+     *
+     * Status, closest frequency, clause and deviation_ppb are identical to
+     * validate_frequency(). Counts are recorded; latency is not measured.
+     */
+    FixedPointFrequencyResult validate_frequency_fixed(uint32_t frequency,
+                                                      uint32_t tolerance_ppm = DEFAULT_TOLERANCE_PPM) const noexcept;
+
+    /**
+     * @brief Select the timing policy used by validate_frequency()
+     * @param policy Latency measurement policy
+     * @param sample_interval Calls per timed call for TimingPolicy::Sampled
+     *        (rounded up to a power of two, 0 treated as 1)
+     *
+     * @traceability DES-C-001 → set_timing_policy
+     *
+     * @exception none (noexcept guarantee)
+     * @thread_safety Thread-safe; concurrent validations observe the change
+     *                on their next call
+     *
+     * Latency statistics (average, maximum, meets_realtime_constraints()) are
+     * computed over timed calls only. Builds below
+     * InstrumentationLevel::Timing (AES5_INSTRUMENTATION_LEVEL) never time
+     * calls, whatever the policy.
+     */
+    void set_timing_policy(TimingPolicy policy,
+                           uint32_t sample_interval = DEFAULT_TIMING_SAMPLE_INTERVAL) noexcept;
+
+    /**
+     * @brief Get the timing policy used by validate_frequency()
+     * @return Current timing policy (TimingPolicy::Always by default)
+     * @traceability DES-C-001 → get_timing_policy
+     */
+    TimingPolicy get_timing_policy() const noexcept;
+
+    /**
+     * @brief Get the effective sample interval for TimingPolicy::Sampled
+     * @return Calls per timed call (power of two)
+     * @traceability DES-C-001 → get_timing_policy
+     */
+    uint32_t get_timing_sample_interval() const noexcept;
+
+    /**
+     * @brief Validate an array of sampling frequencies with a uniform tolerance
+     * @param frequencies Input frequencies (Hz)
+     * @param count Number of frequencies
+     * @param results Caller-owned structure-of-arrays output (see FrequencyBatchResults)
+     * @param tolerance_ppm Tolerance in parts per million applied to every element
+     * @return Number of elements that validated successfully
+     *
+     * @traceability DES-C-001 → validate_frequency_batch
+     *
+     * @exception none (noexcept guarantee for real-time operation)
+     * @performance AVX2 kernel (8 lanes) selected at runtime, portable scalar fallback
+     * @thread_safety Thread-safe, lock-free implementation
+     *
+     * @pre frequencies != nullptr, required result arrays != nullptr
+     * @post Metrics updated once for the whole batch (one validation per
+     *       non-zero element, total latency = batch latency, max latency =
+     *       per-element average)
+     *
+     * Per-element results are identical to validate_frequency(). Like
+     * validate_frequency(0), zero elements get InvalidInput but are not
+     * counted in the metrics; a batch of only zeros records nothing. Invalid
+     * parameters (null arrays, count == 0) return 0 without recording metrics.
+     *
+     * Example usage:
+     * @code
+     * std::vector<ValidationResult> status(n);
+     * std::vector<uint32_t> closest(n);
+     * std::vector<double> ppm(n);
+     * size_t valid = validator->validate_frequency_batch(
+     *     rates.data(), n, {status.data(), closest.data(), ppm.data(), nullptr});
+     * @endcode
+     */
+    size_t validate_frequency_batch(const uint32_t* frequencies,
+                                    size_t count,
+                                    const FrequencyBatchResults& results,
+                                    uint32_t tolerance_ppm = DEFAULT_TOLERANCE_PPM) const noexcept;
+
+    /**
+     * @brief Validate an array of sampling frequencies with per-element tolerances
+     * @param frequencies Input frequencies (Hz)
+     * @param tolerances_ppm Tolerance in parts per million for each element
+     * @param count Number of frequencies (and tolerances)
+     * @param results Caller-owned structure-of-arrays output (see FrequencyBatchResults)
+     * @return Number of elements that validated successfully
+     *
+     * @traceability DES-C-001 → validate_frequency_batch
+     *
+     * @pre tolerances_ppm != nullptr (returns 0 otherwise)
+     */
+    size_t validate_frequency_batch(const uint32_t* frequencies,
+                                    const uint32_t* tolerances_ppm,
+                                    size_t count,
+                                    const FrequencyBatchResults& results) const noexcept;
+
     /**
      * @brief Find closest AES5-2018 standard frequency
      * @param frequency Input frequency (Hz)
@@ -277,6 +532,67 @@ public:
     double calculate_tolerance_ppm(uint32_t measured_frequency, 
                                   uint32_t reference_frequency) const noexcept;
 
+    /**
+     * @brief Calculate signed deviation in parts per billion (integer only)
+     * @param measured_frequency Measured frequency (Hz)
+     * @param reference_frequency Reference frequency (Hz)
+     * @return (measured - reference) * 10^9 / reference, truncated toward zero;
+     *         INT64_MAX if reference_frequency == 0
+     *
+     * @traceability DES-C-001 → calculate_deviation_ppb
+     *
+     * @exception none (noexcept guarantee)
+     * @thread_safety Thread-safe, stateless calculation
+     *
+     * |difference| * 10^9 < 2^63 for all 32-bit inputs, so no overflow.
+     * calculate_tolerance_ppm() equals |deviation_ppb| / 1000 exactly.
+     */
+    static constexpr int64_t calculate_deviation_ppb(uint32_t measured_frequency,
+                                                     uint32_t reference_frequency) noexcept {
+        return compile_time::deviation_ppb(measured_frequency, reference_frequency);
+    }
+
+    /**
+     * @brief Calculate signed deviation of a sub-Hz frequency in parts per billion
+     * @param measured_frequency Measured frequency (Q32.32)
+     * @param reference_frequency Reference frequency (Hz)
+     * @return (measured - reference) * 10^9 / reference, truncated toward zero;
+     *         INT64_MAX if reference_frequency == 0
+     *
+     * @traceability DES-C-001 → calculate_deviation_ppb
+     *
+     * Exact for all inputs without 128-bit arithmetic: the whole and fractional
+     * parts of the difference are scaled separately (each product < 2^63).
+     */
+    static constexpr int64_t calculate_deviation_ppb(PreciseFrequency measured_frequency,
+                                                     uint32_t reference_frequency) noexcept {
+        if (reference_frequency == 0) {
+            return INT64_MAX;
+        }
+        const uint64_t reference = static_cast<uint64_t>(reference_frequency) << 32;
+        const bool negative = measured_frequency.q32_32 < reference;
+        const uint64_t difference = negative ? reference - measured_frequency.q32_32
+                                             : measured_frequency.q32_32 - reference;
+        const uint64_t scaled = (difference >> 32) * 1000000000ULL +
+                                (((difference & 0xFFFFFFFFULL) * 1000000000ULL) >> 32);
+        const int64_t magnitude = static_cast<int64_t>(scaled / reference_frequency);
+        return negative ? -magnitude : magnitude;
+    }
+
+    /**
+     * @brief Check a deviation against a tolerance (integer only)
+     * @param deviation_ppb Signed deviation in parts per billion
+     * @param tolerance_ppm Tolerance in parts per million
+     * @return true if the whole-ppm deviation does not exceed tolerance_ppm
+     *
+     * @traceability DES-C-001 → is_within_tolerance_ppb
+     *
+     * Same decision as comparing calculate_tolerance_ppm() <= tolerance_ppm.
+     */
+    static constexpr bool is_within_tolerance_ppb(int64_t deviation_ppb, uint32_t tolerance_ppm) noexcept {
+        return compile_time::is_within_tolerance_ppb(deviation_ppb, tolerance_ppm);
+    }
+
     /**
      * @brief Get performance and operational metrics
      * @return Reference to current validation metrics
@@ -292,9 +608,28 @@ public:
      * - Success/failure rates
      * - Performance latency statistics
      * - Memory usage information
+     *
+     * Returns ValidationCore::get_metrics(): with MetricsBackend::Sharded the
+     * reference is the core's aggregate view, refreshed by every
+     * get_metrics() call on that core (from any thread), so an earlier
+     * reference changes when metrics are fetched again. Use
+     * get_metrics_snapshot() for a copy that stays fixed.
      */
     const validation::ValidationMetrics& get_metrics() const noexcept;
 
+    /**
+     * @brief Consistent, copyable snapshot of the metrics
+     * @return Snapshot from ValidationCore::get_metrics_snapshot()
+     *
+     * @traceability DES-C-001 → get_metrics_snapshot
+     *
+     * @exception none (noexcept guarantee)
+     * @thread_safety Thread-safe; never blocks validating threads
+     *
+     * Diff two snapshots with MetricsSnapshot::since() for per-interval rates.
+     */
+    validation::MetricsSnapshot get_metrics_snapshot() const noexcept;
+
     /**
      * @brief Reset performance metrics to zero
      * @traceability DES-C-001 → reset_metrics
@@ -348,6 +683,44 @@ private:
      * @traceability DES-C-001 → initialize_tolerance_tables
      */
     void initialize_tolerance_tables() noexcept;
+
+    /**
+     * @brief Run one validation under a timing policy and record it in ValidationCore
+     * @param validate Callable returning the FrequencyValidationResult to record
+     * @traceability DES-C-001 → validate_frequency
+     */
+    template<TimingPolicy Policy, typename Validate>
+    FrequencyValidationResult run_with_timing_policy(const Validate& validate) const noexcept;
+
+    /**
+     * @brief Record a timed validation in the core's flight recorder, if one is attached
+     * @traceability DES-C-001, DES-C-005 → record_flight_event
+     */
+    void record_flight_event(const FrequencyValidationResult& result,
+                             uint64_t latency_ns, uint64_t start_ticks) const noexcept;
+
+    /**
+     * @brief Record an untimed validation (latency 0, timestamp read now), if a recorder is attached
+     * @traceability DES-C-001, DES-C-005 → record_flight_event
+     */
+    void record_flight_event(const FrequencyValidationResult& result) const noexcept;
+
+    /**
+     * @brief Classification and deviation for a sub-Hz frequency (no metrics)
+     * @traceability DES-C-001 → validate_frequency_internal
+     */
+    FrequencyValidationResult validate_precise_internal(PreciseFrequency frequency,
+                                                        uint32_t tolerance_ppm) const noexcept;
+
+    /**
+     * @brief Shared implementation of the batch validation overloads
+     * @traceability DES-C-001 → validate_frequency_batch
+     */
+    size_t run_frequency_batch(const uint32_t* frequencies,
+                               const uint32_t* tolerances_ppm,
+                               size_t count,
+                               const FrequencyBatchResults& results,
+                               uint32_t default_tolerance_ppm) const noexcept;
     
     // Friend function for ValidationCore integration
     friend validation::ValidationResult frequency_validation_function(uint32_t frequency, void* context) noexcept;
@@ -363,6 +736,11 @@ private:
     // Performance optimization data
     mutable std::array<uint32_t, 10> standard_frequencies_;                 ///< Sorted standard frequencies for binary search
     mutable uint32_t current_tolerance_ppm_;                                 ///< Current tolerance for static function access
+
+    // Latency measurement policy (see TimingPolicy)
+    std::atomic<TimingPolicy> timing_policy_;                                ///< Policy used by validate_frequency()
+    std::atomic<uint32_t> timing_sample_mask_;                               ///< Sample interval - 1 (power of two)
+    mutable std::atomic<uint32_t> timing_call_counter_;                      ///< Calls seen by Sampled policy
 };
 
 /**
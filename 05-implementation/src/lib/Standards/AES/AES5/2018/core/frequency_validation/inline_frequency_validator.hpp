@@ -0,0 +1,131 @@
+/**
+ * @file inline_frequency_validator.hpp
+ * @brief Header-only, allocation-free value-type frequency validator
+ * @traceability DES-C-001 → InlineFrequencyValidator
+ *
+ * FrequencyValidator::create() heap-allocates the validator plus an owned
+ * ComplianceEngine and ValidationCore, and every call chases pointers into
+ * them. InlineFrequencyValidator is the value-type counterpart for
+ * short-lived use (e.g. one per connection): constructed on the stack in
+ * O(1), copyable, a few bytes large, with the metrics sink injected as a
+ * template policy (validation/metrics_policies.hpp). Decisions come from
+ * the shared constexpr engine, so results equal FrequencyValidator's.
+ *
+ * @performance No allocation; validate_frequency() is one branch-free table
+ *              search plus the policy's record_validation()
+ * @thread_safety Same as the metrics policy: NullMetricsPolicy and
+ *                SharedCorePolicy instances may be shared read-only across
+ *                threads, LocalCountersPolicy needs one owner
+ * @exception none (noexcept guarantee)
+ *
+ * Usage Example:
+ * @code
+ * void on_connection(uint32_t announced_rate_hz, ValidationCore& process_metrics) {
+ *     InlineFrequencyValidator<validation::SharedCorePolicy> validator{
+ *         FrequencyValidator::DEFAULT_TOLERANCE_PPM, validation::SharedCorePolicy{&process_metrics}};
+ *     if (!validator.validate_frequency(announced_rate_hz).is_valid()) {
+ *         reject();
+ *     }
+ * }
+ * @endcode
+ */
+
+#ifndef AES_AES5_2018_CORE_FREQUENCY_VALIDATION_INLINE_FREQUENCY_VALIDATOR_HPP
+#define AES_AES5_2018_CORE_FREQUENCY_VALIDATION_INLINE_FREQUENCY_VALIDATOR_HPP
+
+#include <cstdint>
+
+#include "frequency_validator.hpp"
+#include "../compile_time/aes5_compile_time.hpp"
+#include "../validation/metrics_policies.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace frequency_validation {
+
+/**
+ * @brief Stack-constructible AES5-2018 frequency validator
+ * @tparam MetricsPolicy Metrics sink (see metrics_policies.hpp); stored by
+ *         value, empty policies take no space
+ * @traceability DES-C-001 → InlineFrequencyValidator
+ */
+template<typename MetricsPolicy = validation::NullMetricsPolicy>
+class InlineFrequencyValidator : private MetricsPolicy {
+public:
+    /**
+     * @brief Construct with a default tolerance and a metrics policy instance
+     * @param tolerance_ppm Tolerance used by validate_frequency(frequency)
+     * @param metrics Policy instance (e.g. SharedCorePolicy{&core})
+     */
+    explicit InlineFrequencyValidator(uint32_t tolerance_ppm = compile_time::DEFAULT_TOLERANCE_PPM,
+                                      MetricsPolicy metrics = MetricsPolicy()) noexcept
+        : MetricsPolicy(metrics)
+        , tolerance_ppm_(tolerance_ppm) {
+    }
+
+    /**
+     * @brief Validate against the nearest standard rate with the configured tolerance
+     * @traceability DES-C-001 → validate_frequency
+     *
+     * Same result as FrequencyValidator::validate_frequency(); frequency 0
+     * is InvalidInput and, as there, not recorded.
+     */
+    FrequencyValidationResult validate_frequency(uint32_t frequency) noexcept {
+        return validate_frequency(frequency, tolerance_ppm_);
+    }
+
+    /// Validate with an explicit tolerance
+    FrequencyValidationResult validate_frequency(uint32_t frequency, uint32_t tolerance_ppm) noexcept {
+        const compile_time::FrequencyCheck check = compile_time::check_frequency(frequency, tolerance_ppm);
+
+        FrequencyValidationResult result;
+        result.status = check.status;
+        result.detected_frequency = frequency;
+        result.closest_standard_frequency = check.closest_standard_frequency;
+        result.tolerance_ppm = static_cast<double>(check.deviation_ppm());
+        result.deviation_ppb = check.deviation_ppb;
+        result.applicable_clause = check.applicable_clause;
+
+        if (frequency != 0) {
+            MetricsPolicy::record_validation(result.status);
+        }
+        return result;
+    }
+
+    /// True if frequency is within the configured tolerance of a standard rate
+    bool is_valid_frequency(uint32_t frequency) noexcept {
+        return validate_frequency(frequency).is_valid();
+    }
+
+    /// Closest AES5-2018 standard frequency (stateless, no metrics)
+    static constexpr uint32_t find_closest_standard_frequency(uint32_t frequency) noexcept {
+        return compile_time::closest_standard_frequency(frequency);
+    }
+
+    void set_tolerance_ppm(uint32_t tolerance_ppm) noexcept { tolerance_ppm_ = tolerance_ppm; }
+    uint32_t get_tolerance_ppm() const noexcept { return tolerance_ppm_; }
+
+    /// The injected metrics policy (e.g. to read LocalCountersPolicy counts)
+    MetricsPolicy& metrics() noexcept { return *this; }
+    const MetricsPolicy& metrics() const noexcept { return *this; }
+
+private:
+    uint32_t tolerance_ppm_;
+};
+
+static_assert(sizeof(InlineFrequencyValidator<validation::NullMetricsPolicy>) == sizeof(uint32_t),
+              "Empty metrics policy must take no space");
+static_assert(sizeof(InlineFrequencyValidator<validation::LocalCountersPolicy>) <= 64,
+              "Counting validator must fit in a cache line");
+static_assert(sizeof(InlineFrequencyValidator<validation::SharedCorePolicy>) <= 64,
+              "Shared-core validator must fit in a cache line");
+
+} // namespace frequency_validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_FREQUENCY_VALIDATION_INLINE_FREQUENCY_VALIDATOR_HPP
@@ -0,0 +1,271 @@
+/**
+ * @file standard_rate_table.hpp
+ * @brief Compile-time closest-standard-rate boundary table
+ * @traceability DES-C-001 → find_closest_standard_frequency
+ *
+ * Internal header - not part of the public API; use the constexpr functions
+ * of compile_time/aes5_compile_time.hpp. The decision boundaries used by
+ * FrequencyValidator::find_closest_standard_frequency(), the compile-time
+ * engine and the batch kernels are generated at compile time from STANDARD_RATE_ENTRIES:
+ * - Capture ranges switch at the midpoint of adjacent rates (ties go to the
+ *   lower rate) unless CAPTURE_BOUNDARY_OVERRIDES moves the switch point
+ * - A standard rate that falls inside a neighbour's capture range still maps
+ *   to itself through a one-frequency segment
+ *
+ * The result is a sorted array of segment starts. The segment containing a
+ * frequency is the number of starts <= frequency, found by a fixed-depth
+ * branch-free binary search (batch kernels use compare-and-count instead).
+ *
+ * @performance O(log SEGMENT_COUNT) branch-free steps, <100 bytes of tables
+ * @thread_safety Immutable constexpr data
+ */
+
+#ifndef AES_AES5_2018_CORE_FREQUENCY_VALIDATION_STANDARD_RATE_TABLE_HPP
+#define AES_AES5_2018_CORE_FREQUENCY_VALIDATION_STANDARD_RATE_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../compliance/compliance_engine.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace frequency_validation {
+namespace detail {
+
+/**
+ * @brief AES5-2018 standard rate and its governing clause
+ */
+struct StandardRateEntry {
+    uint32_t frequency;                 ///< Standard sampling frequency (Hz)
+    compliance::AES5Clause clause;      ///< Clause that defines the rate
+};
+
+/// Standard sampling frequencies, strictly ascending
+static constexpr std::array<StandardRateEntry, 10> STANDARD_RATE_ENTRIES = {{
+    {32000,  compliance::AES5Clause::Section_5_4},   // Legacy
+    {44100,  compliance::AES5Clause::Section_5_2},   // Consumer
+    {47952,  compliance::AES5Clause::Annex_A},       // Pull-down 48k
+    {48000,  compliance::AES5Clause::Section_5_1},   // Primary
+    {48048,  compliance::AES5Clause::Annex_A},       // Pull-up 48k
+    {88200,  compliance::AES5Clause::Section_5_2},   // Double rate 44.1k
+    {96000,  compliance::AES5Clause::Section_5_2},   // High bandwidth
+    {176400, compliance::AES5Clause::Section_5_2},   // Quadruple rate 44.1k
+    {192000, compliance::AES5Clause::Section_5_2},   // Quadruple rate 48k
+    {384000, compliance::AES5Clause::Section_5_2}    // Octuple rate 48k
+}};
+
+/**
+ * @brief Non-midpoint start of a rate's capture range
+ */
+struct CaptureBoundaryOverride {
+    uint32_t rate;                      ///< Standard rate whose capture range is moved
+    uint32_t first_frequency;           ///< First frequency mapped to that rate
+};
+
+/// Capture range starts that deviate from the midpoint rule
+static constexpr std::array<CaptureBoundaryOverride, 2> CAPTURE_BOUNDARY_OVERRIDES = {{
+    {47952, 46000},     // Pull-down captures from 46 kHz (midpoint would be 46026)
+    {48048, 48151}      // Primary 48 kHz keeps 47977..48150, including 48100
+}};
+
+static constexpr size_t STANDARD_RATE_COUNT = STANDARD_RATE_ENTRIES.size();
+
+/// First frequency of the capture range of STANDARD_RATE_ENTRIES[k] (k > 0)
+constexpr uint32_t capture_range_start(size_t k) noexcept {
+    for (const auto& entry : CAPTURE_BOUNDARY_OVERRIDES) {
+        if (entry.rate == STANDARD_RATE_ENTRIES[k].frequency) {
+            return entry.first_frequency;
+        }
+    }
+    const uint64_t lower = STANDARD_RATE_ENTRIES[k - 1].frequency;
+    const uint64_t upper = STANDARD_RATE_ENTRIES[k].frequency;
+    return static_cast<uint32_t>((lower + upper) / 2 + 1);
+}
+
+/// Index of the rate whose capture range contains frequency (reference, branching)
+constexpr size_t capture_range_index(uint32_t frequency) noexcept {
+    size_t index = 0;
+    for (size_t k = 1; k < STANDARD_RATE_COUNT; ++k) {
+        if (frequency >= capture_range_start(k)) {
+            index = k;
+        }
+    }
+    return index;
+}
+
+/// Number of standard rates lying outside their own capture range
+constexpr size_t count_displaced_rates() noexcept {
+    size_t count = 0;
+    for (size_t k = 0; k < STANDARD_RATE_COUNT; ++k) {
+        count += (capture_range_index(STANDARD_RATE_ENTRIES[k].frequency) != k) ? 1 : 0;
+    }
+    return count;
+}
+
+/// Capture ranges plus a point segment and a resume segment per displaced rate
+static constexpr size_t SEGMENT_COUNT = STANDARD_RATE_COUNT + 2 * count_displaced_rates();
+
+/**
+ * @brief Generated segment table (starts ascending, starts[0] == 0)
+ */
+struct RateSegmentTable {
+    std::array<uint32_t, SEGMENT_COUNT> starts;         ///< First frequency of each segment
+    std::array<uint8_t, SEGMENT_COUNT> rate_index;      ///< Standard rate of each segment
+};
+
+constexpr RateSegmentTable build_rate_segment_table() noexcept {
+    RateSegmentTable table{};
+    size_t size = 0;
+
+    for (size_t k = 0; k < STANDARD_RATE_COUNT; ++k) {
+        table.starts[size] = (k == 0) ? 0 : capture_range_start(k);
+        table.rate_index[size] = static_cast<uint8_t>(k);
+        ++size;
+    }
+    for (size_t k = 0; k < STANDARD_RATE_COUNT; ++k) {
+        const uint32_t frequency = STANDARD_RATE_ENTRIES[k].frequency;
+        const size_t owner = capture_range_index(frequency);
+        if (owner != k) {
+            table.starts[size] = frequency;
+            table.rate_index[size] = static_cast<uint8_t>(k);
+            ++size;
+            table.starts[size] = frequency + 1;
+            table.rate_index[size] = static_cast<uint8_t>(owner);
+            ++size;
+        }
+    }
+
+    // Insertion sort (stable, constexpr-friendly)
+    for (size_t i = 1; i < size; ++i) {
+        const uint32_t start = table.starts[i];
+        const uint8_t index = table.rate_index[i];
+        size_t j = i;
+        while (j > 0 && table.starts[j - 1] > start) {
+            table.starts[j] = table.starts[j - 1];
+            table.rate_index[j] = table.rate_index[j - 1];
+            --j;
+        }
+        table.starts[j] = start;
+        table.rate_index[j] = index;
+    }
+    return table;
+}
+
+static constexpr RateSegmentTable RATE_SEGMENT_TABLE = build_rate_segment_table();
+
+constexpr std::array<uint32_t, SEGMENT_COUNT - 1> build_segment_boundaries() noexcept {
+    std::array<uint32_t, SEGMENT_COUNT - 1> boundaries{};
+    for (size_t i = 1; i < SEGMENT_COUNT; ++i) {
+        boundaries[i - 1] = RATE_SEGMENT_TABLE.starts[i];
+    }
+    return boundaries;
+}
+
+constexpr std::array<uint32_t, SEGMENT_COUNT> build_segment_rates() noexcept {
+    std::array<uint32_t, SEGMENT_COUNT> rates{};
+    for (size_t i = 0; i < SEGMENT_COUNT; ++i) {
+        rates[i] = STANDARD_RATE_ENTRIES[RATE_SEGMENT_TABLE.rate_index[i]].frequency;
+    }
+    return rates;
+}
+
+constexpr std::array<compliance::AES5Clause, SEGMENT_COUNT> build_segment_clauses() noexcept {
+    std::array<compliance::AES5Clause, SEGMENT_COUNT> clauses{};
+    for (size_t i = 0; i < SEGMENT_COUNT; ++i) {
+        clauses[i] = STANDARD_RATE_ENTRIES[RATE_SEGMENT_TABLE.rate_index[i]].clause;
+    }
+    return clauses;
+}
+
+/// Decision boundaries: segment i + 1 starts at SEGMENT_BOUNDARIES[i]
+static constexpr std::array<uint32_t, SEGMENT_COUNT - 1> SEGMENT_BOUNDARIES = build_segment_boundaries();
+
+/// Closest standard frequency for each segment
+static constexpr std::array<uint32_t, SEGMENT_COUNT> SEGMENT_RATES = build_segment_rates();
+
+/// AES5-2018 clause for each segment
+static constexpr std::array<compliance::AES5Clause, SEGMENT_COUNT> SEGMENT_CLAUSES = build_segment_clauses();
+
+/**
+ * @brief Segment containing frequency (number of boundaries <= frequency)
+ * @note Branch-free binary search: the step sizes depend only on the table
+ *       size, so every lookup runs the same fixed sequence of conditional
+ *       moves (no data-dependent branches to mispredict)
+ */
+constexpr size_t find_rate_segment(uint32_t frequency) noexcept {
+    size_t base = 0;
+    size_t length = SEGMENT_BOUNDARIES.size();
+    while (length > 1) {
+        const size_t half = length / 2;
+        base += (SEGMENT_BOUNDARIES[base + half - 1] <= frequency) ? half : 0;
+        length -= half;
+    }
+    return base + ((SEGMENT_BOUNDARIES[base] <= frequency) ? 1 : 0);
+}
+
+/**
+ * @brief Segment containing frequency by compare-and-count over all boundaries
+ * @note Same result as find_rate_segment(); preferred inside loops over many
+ *       frequencies, where the compiler vectorizes across elements
+ */
+constexpr size_t count_rate_segment(uint32_t frequency) noexcept {
+    size_t segment = 0;
+    for (uint32_t boundary : SEGMENT_BOUNDARIES) {
+        segment += (frequency >= boundary) ? 1 : 0;
+    }
+    return segment;
+}
+
+/**
+ * @brief Closest AES5-2018 standard frequency (frequency 0 maps to the lowest rate)
+ */
+constexpr uint32_t find_closest_standard_rate(uint32_t frequency) noexcept {
+    return SEGMENT_RATES[find_rate_segment(frequency)];
+}
+
+constexpr bool segment_boundaries_ascending() noexcept {
+    for (size_t i = 1; i < SEGMENT_BOUNDARIES.size(); ++i) {
+        if (SEGMENT_BOUNDARIES[i] <= SEGMENT_BOUNDARIES[i - 1]) {
+            return false;
+        }
+    }
+    return SEGMENT_BOUNDARIES[0] > 0;
+}
+
+constexpr bool standard_rates_map_to_themselves() noexcept {
+    for (const auto& entry : STANDARD_RATE_ENTRIES) {
+        if (find_closest_standard_rate(entry.frequency) != entry.frequency) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool segment_searches_agree() noexcept {
+    for (uint32_t boundary : SEGMENT_BOUNDARIES) {
+        if (find_rate_segment(boundary - 1) != count_rate_segment(boundary - 1) ||
+            find_rate_segment(boundary) != count_rate_segment(boundary)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(segment_boundaries_ascending(), "Standard rate boundaries must be strictly ascending");
+static_assert(standard_rates_map_to_themselves(), "Every standard rate must map to itself");
+static_assert(segment_searches_agree(), "Binary search and compare-and-count must agree");
+static_assert(find_closest_standard_rate(48100) == 48000, "48.1 kHz belongs to the primary 48 kHz range");
+static_assert(find_closest_standard_rate(46000) == 47952, "46 kHz belongs to the pull-down range");
+
+} // namespace detail
+} // namespace frequency_validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_FREQUENCY_VALIDATION_STANDARD_RATE_TABLE_HPP
@@ -0,0 +1,432 @@
+/**
+ * @file metrics_shm_exporter.cpp
+ * @brief POSIX shared-memory metrics exporter and reader
+ * @traceability DES-C-005, DES-C-010 → MetricsShmExporter, MetricsShmReader
+ */
+
+#include "metrics_shm_exporter.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define AES5_HAVE_POSIX_SHM 1
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace monitoring {
+
+namespace {
+
+/// Valid POSIX shm name: "/name", no further slashes, bounded length
+bool valid_segment_name(const char* name) noexcept {
+    if (name == nullptr || name[0] != '/' || name[1] == '\0') {
+        return false;
+    }
+    const size_t length = std::strlen(name);
+    return length <= MetricsShmExporter::MAX_SEGMENT_NAME && std::strchr(name + 1, '/') == nullptr;
+}
+
+/// Enter a slot write; fails if another publisher is writing it
+bool try_begin_write(ShmCoreSlot& slot, uint64_t& sequence) noexcept {
+    sequence = slot.sequence.load(std::memory_order_relaxed);
+    if ((sequence & 1) != 0 ||
+        !slot.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed)) {
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+}
+
+/// Registration path only: wait out a concurrent publish of the same slot
+uint64_t begin_write(ShmCoreSlot& slot) noexcept {
+    uint64_t sequence = 0;
+    while (!try_begin_write(slot, sequence)) {
+        std::this_thread::yield();
+    }
+    return sequence;
+}
+
+void end_write(ShmCoreSlot& slot, uint64_t sequence) noexcept {
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+void clear_counters(ShmCoreSlot& slot) noexcept {
+    slot.total_validations.store(0, std::memory_order_relaxed);
+    slot.successful_validations.store(0, std::memory_order_relaxed);
+    slot.failed_validations.store(0, std::memory_order_relaxed);
+    slot.max_latency_ns.store(0, std::memory_order_relaxed);
+    slot.total_latency_ns.store(0, std::memory_order_relaxed);
+    slot.timed_validations.store(0, std::memory_order_relaxed);
+    slot.deadline_violations.store(0, std::memory_order_relaxed);
+    slot.timestamp_ns.store(0, std::memory_order_relaxed);
+    slot.snapshot_consistent.store(0, std::memory_order_relaxed);
+    slot.has_histogram.store(0, std::memory_order_relaxed);
+}
+
+#if defined(AES5_HAVE_POSIX_SHM)
+/// True if segment_name is an initialized segment whose exporter process is gone
+bool segment_is_stale(const char* segment_name) noexcept {
+    const int fd = shm_open(segment_name, O_RDONLY, 0);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    void* mapping = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= sizeof(ShmSegmentHeader)) {
+        mapping = mmap(nullptr, sizeof(ShmSegmentHeader), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    // Uninitialized or foreign segments may belong to a live process: keep them
+    const auto* header = static_cast<const ShmSegmentHeader*>(mapping);
+    bool stale = false;
+    if (header->magic.load(std::memory_order_acquire) == SHM_MAGIC) {
+        const uint64_t pid = header->exporter_pid;
+        const pid_t process = static_cast<pid_t>(pid);
+        stale = process > 0 && static_cast<uint64_t>(process) == pid &&
+                kill(process, 0) != 0 && errno == ESRCH;
+    }
+    munmap(mapping, sizeof(ShmSegmentHeader));
+    return stale;
+}
+#endif
+
+} // namespace
+
+// ============================================================================
+// MetricsShmExporter
+// ============================================================================
+
+std::unique_ptr<MetricsShmExporter> MetricsShmExporter::create(const char* segment_name,
+                                                               size_t capacity) noexcept {
+#if defined(AES5_HAVE_POSIX_SHM)
+    if (!valid_segment_name(segment_name)) {
+        return nullptr;
+    }
+    capacity = (capacity == 0) ? 1 : (capacity > MAX_CAPACITY ? MAX_CAPACITY : capacity);
+
+    std::unique_ptr<std::atomic<const validation::ValidationCore*>[]> cores(
+        new (std::nothrow) std::atomic<const validation::ValidationCore*>[capacity]);
+    if (!cores) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < capacity; ++i) {
+        cores[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    // Never take over a live exporter's segment; replace only leftovers of a dead one
+    int fd = shm_open(segment_name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0 && errno == EEXIST && segment_is_stale(segment_name)) {
+        shm_unlink(segment_name);
+        fd = shm_open(segment_name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    }
+    if (fd < 0) {
+        return nullptr;
+    }
+    const size_t size = shm_segment_size(capacity);
+    void* mapping = MAP_FAILED;
+    struct stat info;
+    if (ftruncate(fd, static_cast<off_t>(size)) == 0 && fstat(fd, &info) == 0) {
+        mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        shm_unlink(segment_name);
+        return nullptr;
+    }
+
+    // ftruncate zero-fills: every slot starts Free with sequence 0
+    auto* header = static_cast<ShmSegmentHeader*>(mapping);
+    header->version = SHM_LAYOUT_VERSION;
+    header->header_size = sizeof(ShmSegmentHeader);
+    header->slot_size = sizeof(ShmCoreSlot);
+    header->slot_capacity = static_cast<uint32_t>(capacity);
+    header->histogram_bucket_count = static_cast<uint32_t>(ShmHistogramLayout::BUCKET_COUNT);
+    header->histogram_sub_bucket_count = static_cast<uint32_t>(ShmHistogramLayout::SUB_BUCKET_COUNT);
+    header->exporter_pid = static_cast<uint64_t>(getpid());
+    header->publish_count.store(0, std::memory_order_relaxed);
+    header->magic.store(SHM_MAGIC, std::memory_order_release);
+
+    std::unique_ptr<MetricsShmExporter> exporter(
+        new (std::nothrow) MetricsShmExporter(mapping, size, capacity, std::move(cores), segment_name,
+                                              static_cast<uint64_t>(info.st_ino)));
+    if (!exporter) {
+        munmap(mapping, size);
+        shm_unlink(segment_name);
+    }
+    return exporter;
+#else
+    (void)segment_name;
+    (void)capacity;
+    return nullptr;
+#endif
+}
+
+MetricsShmExporter::MetricsShmExporter(void* mapping, size_t mapping_size, size_t capacity,
+                                       std::unique_ptr<std::atomic<const validation::ValidationCore*>[]> cores,
+                                       const char* segment_name, uint64_t segment_id) noexcept
+    : mapping_(mapping)
+    , mapping_size_(mapping_size)
+    , capacity_(capacity)
+    , cores_(std::move(cores))
+    , segment_name_{}
+    , segment_id_(segment_id) {
+    std::strncpy(segment_name_.data(), segment_name, MAX_SEGMENT_NAME);
+}
+
+MetricsShmExporter::~MetricsShmExporter() noexcept {
+#if defined(AES5_HAVE_POSIX_SHM)
+    munmap(mapping_, mapping_size_);
+
+    // A newer exporter may have replaced the segment under the same name
+    const int fd = shm_open(segment_name_.data(), O_RDONLY, 0);
+    if (fd >= 0) {
+        struct stat info;
+        const bool ours = fstat(fd, &info) == 0 && static_cast<uint64_t>(info.st_ino) == segment_id_;
+        close(fd);
+        if (ours) {
+            shm_unlink(segment_name_.data());
+        }
+    }
+#endif
+}
+
+ShmCoreSlot& MetricsShmExporter::slot(size_t index) noexcept {
+    auto* slots = reinterpret_cast<ShmCoreSlot*>(static_cast<char*>(mapping_) + sizeof(ShmSegmentHeader));
+    return slots[index];
+}
+
+int MetricsShmExporter::register_core(const validation::ValidationCore* core, const char* name) noexcept {
+    if (core == nullptr || name == nullptr) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < capacity_; ++i) {
+        const validation::ValidationCore* expected = nullptr;
+        if (!cores_[i].compare_exchange_strong(expected, core, std::memory_order_acq_rel)) {
+            continue;
+        }
+
+        char packed[SHM_NAME_CAPACITY] = {};
+        std::strncpy(packed, name, SHM_NAME_CAPACITY - 1);
+
+        ShmCoreSlot& target = slot(i);
+        const uint64_t sequence = begin_write(target);
+        for (size_t word = 0; word < SHM_NAME_CAPACITY / 8; ++word) {
+            uint64_t value = 0;
+            std::memcpy(&value, packed + word * 8, 8);
+            target.name[word].store(value, std::memory_order_relaxed);
+        }
+        clear_counters(target);
+        target.state.store(static_cast<uint64_t>(ShmSlotState::Active), std::memory_order_relaxed);
+        end_write(target, sequence);
+        return static_cast<int>(i);
+    }
+    return -1;
+}
+
+bool MetricsShmExporter::unregister_core(int slot_index) noexcept {
+    if (slot_index < 0 || static_cast<size_t>(slot_index) >= capacity_) {
+        return false;
+    }
+    if (cores_[slot_index].exchange(nullptr, std::memory_order_acq_rel) == nullptr) {
+        return false;
+    }
+
+    ShmCoreSlot& target = slot(static_cast<size_t>(slot_index));
+    const uint64_t sequence = begin_write(target);
+    target.state.store(static_cast<uint64_t>(ShmSlotState::Free), std::memory_order_relaxed);
+    end_write(target, sequence);
+    return true;
+}
+
+size_t MetricsShmExporter::publish() noexcept {
+    size_t published = 0;
+
+    for (size_t i = 0; i < capacity_; ++i) {
+        const validation::ValidationCore* core = cores_[i].load(std::memory_order_acquire);
+        if (core == nullptr) {
+            continue;
+        }
+
+        ShmCoreSlot& target = slot(i);
+        uint64_t sequence = 0;
+        if (!try_begin_write(target, sequence)) {
+            continue;   // Another publisher (or registration) owns the slot right now
+        }
+        if (cores_[i].load(std::memory_order_acquire) != core) {
+            end_write(target, sequence);    // Re-registered meanwhile; leave it to the next round
+            continue;
+        }
+
+        const validation::MetricsSnapshot snapshot = core->get_metrics_snapshot();
+        target.total_validations.store(snapshot.total_validations, std::memory_order_relaxed);
+        target.successful_validations.store(snapshot.successful_validations, std::memory_order_relaxed);
+        target.failed_validations.store(snapshot.failed_validations, std::memory_order_relaxed);
+        target.max_latency_ns.store(snapshot.max_latency_ns, std::memory_order_relaxed);
+        target.total_latency_ns.store(snapshot.total_latency_ns, std::memory_order_relaxed);
+        target.timed_validations.store(snapshot.timed_validations, std::memory_order_relaxed);
+        target.deadline_violations.store(snapshot.deadline_violations, std::memory_order_relaxed);
+        target.timestamp_ns.store(snapshot.timestamp_ns, std::memory_order_relaxed);
+        target.snapshot_consistent.store(snapshot.consistent ? 1 : 0, std::memory_order_relaxed);
+
+        const validation::LatencyHistogram* histogram = core->get_latency_histogram();
+        target.has_histogram.store(histogram ? 1 : 0, std::memory_order_relaxed);
+        if (histogram != nullptr) {
+            for (size_t bucket = 0; bucket < ShmHistogramLayout::BUCKET_COUNT; ++bucket) {
+                target.histogram[bucket].store(histogram->bucket_count_at(bucket), std::memory_order_relaxed);
+            }
+        }
+
+        end_write(target, sequence);
+        ++published;
+    }
+
+    static_cast<ShmSegmentHeader*>(mapping_)->publish_count.fetch_add(1, std::memory_order_release);
+    return published;
+}
+
+// ============================================================================
+// MetricsShmReader
+// ============================================================================
+
+uint64_t ShmCoreRecord::latency_percentile_ns(double percentile) const noexcept {
+    if (!has_histogram) {
+        return 0;
+    }
+    uint64_t total = 0;
+    for (uint64_t count : histogram) {
+        total += count;
+    }
+    return ShmHistogramLayout::value_at_percentile(histogram.data(), total, percentile);
+}
+
+std::unique_ptr<MetricsShmReader> MetricsShmReader::open(const char* segment_name) noexcept {
+#if defined(AES5_HAVE_POSIX_SHM)
+    if (!valid_segment_name(segment_name)) {
+        return nullptr;
+    }
+    const int fd = shm_open(segment_name, O_RDONLY, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat info;
+    void* mapping = MAP_FAILED;
+    size_t size = 0;
+    if (fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= sizeof(ShmSegmentHeader)) {
+        size = static_cast<size_t>(info.st_size);
+        mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const auto* header = static_cast<const ShmSegmentHeader*>(mapping);
+    const bool compatible =
+        header->magic.load(std::memory_order_acquire) == SHM_MAGIC &&
+        header->version == SHM_LAYOUT_VERSION &&
+        header->header_size == sizeof(ShmSegmentHeader) &&
+        header->slot_size == sizeof(ShmCoreSlot) &&
+        header->histogram_bucket_count == ShmHistogramLayout::BUCKET_COUNT &&
+        header->histogram_sub_bucket_count == ShmHistogramLayout::SUB_BUCKET_COUNT &&
+        size >= shm_segment_size(header->slot_capacity);
+    if (!compatible) {
+        munmap(mapping, size);
+        return nullptr;
+    }
+
+    std::unique_ptr<MetricsShmReader> reader(
+        new (std::nothrow) MetricsShmReader(mapping, size, header->slot_capacity));
+    if (!reader) {
+        munmap(mapping, size);
+    }
+    return reader;
+#else
+    (void)segment_name;
+    return nullptr;
+#endif
+}
+
+MetricsShmReader::MetricsShmReader(const void* mapping, size_t mapping_size, size_t capacity) noexcept
+    : mapping_(mapping)
+    , mapping_size_(mapping_size)
+    , capacity_(capacity) {
+}
+
+MetricsShmReader::~MetricsShmReader() noexcept {
+#if defined(AES5_HAVE_POSIX_SHM)
+    munmap(const_cast<void*>(mapping_), mapping_size_);
+#endif
+}
+
+uint64_t MetricsShmReader::publish_count() const noexcept {
+    return static_cast<const ShmSegmentHeader*>(mapping_)->publish_count.load(std::memory_order_acquire);
+}
+
+uint64_t MetricsShmReader::exporter_pid() const noexcept {
+    return static_cast<const ShmSegmentHeader*>(mapping_)->exporter_pid;
+}
+
+bool MetricsShmReader::read_slot(size_t index, ShmCoreRecord& out) const noexcept {
+    if (index >= capacity_) {
+        return false;
+    }
+    const auto* slots = reinterpret_cast<const ShmCoreSlot*>(
+        static_cast<const char*>(mapping_) + sizeof(ShmSegmentHeader));
+    const ShmCoreSlot& source = slots[index];
+
+    for (unsigned attempt = 0; attempt < MAX_READ_ATTEMPTS; ++attempt) {
+        const uint64_t sequence = source.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) != 0) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const uint64_t state = source.state.load(std::memory_order_relaxed);
+        for (size_t word = 0; word < SHM_NAME_CAPACITY / 8; ++word) {
+            const uint64_t value = source.name[word].load(std::memory_order_relaxed);
+            std::memcpy(out.name + word * 8, &value, 8);
+        }
+        out.metrics.total_validations = source.total_validations.load(std::memory_order_relaxed);
+        out.metrics.successful_validations = source.successful_validations.load(std::memory_order_relaxed);
+        out.metrics.failed_validations = source.failed_validations.load(std::memory_order_relaxed);
+        out.metrics.max_latency_ns = source.max_latency_ns.load(std::memory_order_relaxed);
+        out.metrics.total_latency_ns = source.total_latency_ns.load(std::memory_order_relaxed);
+        out.metrics.timed_validations = source.timed_validations.load(std::memory_order_relaxed);
+        out.metrics.deadline_violations = source.deadline_violations.load(std::memory_order_relaxed);
+        out.metrics.timestamp_ns = source.timestamp_ns.load(std::memory_order_relaxed);
+        out.metrics.consistent = source.snapshot_consistent.load(std::memory_order_relaxed) != 0;
+        out.has_histogram = source.has_histogram.load(std::memory_order_relaxed) != 0;
+        for (size_t bucket = 0; bucket < ShmHistogramLayout::BUCKET_COUNT; ++bucket) {
+            out.histogram[bucket] = out.has_histogram ? source.histogram[bucket].load(std::memory_order_relaxed) : 0;
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (source.sequence.load(std::memory_order_relaxed) == sequence) {
+            out.name[SHM_NAME_CAPACITY - 1] = '\0';
+            return state == static_cast<uint64_t>(ShmSlotState::Active);
+        }
+    }
+    return false;
+}
+
+} // namespace monitoring
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
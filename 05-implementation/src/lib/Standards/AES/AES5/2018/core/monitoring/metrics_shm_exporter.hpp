@@ -0,0 +1,193 @@
+/**
+ * @file metrics_shm_exporter.hpp
+ * @brief Optional export of ValidationCore metrics to POSIX shared memory
+ * @traceability DES-C-005, DES-C-010 → MetricsShmExporter
+ *
+ * Monitoring agents run in a separate process and cannot link into the
+ * audio engine. MetricsShmExporter creates a fixed-layout segment
+ * (metrics_shm_layout.hpp) with shm_open()/mmap() and, on each publish(),
+ * copies every registered core's MetricsSnapshot and attached
+ * LatencyHistogram into that core's slot. MetricsShmReader (and the
+ * metrics_shm_reader tool built on it) map the segment read-only.
+ *
+ * No sockets, no background thread: the application decides where
+ * publish() runs (a housekeeping thread, or the audio thread once per
+ * block). Segment and slot table are allocated by create(); register,
+ * publish and unregister never allocate.
+ *
+ * Available on POSIX systems; elsewhere create()/open() return nullptr.
+ *
+ * @performance publish(): one get_metrics_snapshot() plus one histogram copy
+ *              (LatencyHistogram::BUCKET_COUNT words) per registered core
+ * @thread_safety All methods are lock-free. Concurrent publish() calls skip
+ *                slots another publisher is writing. A core must be
+ *                unregistered before it is destroyed, and not while a
+ *                publish() may be reading it.
+ * @exception none (noexcept guarantee; failures reported via return values)
+ */
+
+#ifndef AES_AES5_2018_CORE_MONITORING_METRICS_SHM_EXPORTER_HPP
+#define AES_AES5_2018_CORE_MONITORING_METRICS_SHM_EXPORTER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "metrics_shm_layout.hpp"
+#include "../validation/validation_core.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace monitoring {
+
+/**
+ * @brief Publishes ValidationCore metrics into a shared-memory segment
+ * @traceability DES-C-005, DES-C-010 → MetricsShmExporter
+ *
+ * Usage Example:
+ * @code
+ * auto exporter = MetricsShmExporter::create();          // "/aes5_validation_metrics"
+ * int slot = exporter->register_core(&core, "input-0");
+ * ...
+ * exporter->publish();                                    // e.g. every 100 ms
+ * ...
+ * exporter->unregister_core(slot);
+ * @endcode
+ */
+class MetricsShmExporter {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 32;   ///< Slots in a default segment
+    static constexpr size_t MAX_CAPACITY = 4096;
+    static constexpr size_t MAX_SEGMENT_NAME = 255;  ///< Including the leading '/'
+
+    /**
+     * @brief Create the segment and map it read-write
+     * @param segment_name POSIX shm name starting with '/'
+     * @param capacity Slots, clamped to [1, MAX_CAPACITY]
+     * @return Exporter, or nullptr if the segment cannot be created/mapped
+     *         or another exporter owns the name
+     * @traceability DES-C-005, DES-C-010 → MetricsShmExporter::create
+     *
+     * An existing segment with the same name is replaced only if it was
+     * left by a crashed exporter (its exporter_pid no longer exists);
+     * readers still mapping it keep the stale copy. A segment of a live
+     * exporter, or one that is not an initialized metrics segment, is left
+     * alone and create() fails.
+     */
+    static std::unique_ptr<MetricsShmExporter> create(const char* segment_name = DEFAULT_SHM_SEGMENT_NAME,
+                                                      size_t capacity = DEFAULT_CAPACITY) noexcept;
+
+    /// Unmaps the segment and unlinks it unless another exporter has replaced it
+    ~MetricsShmExporter() noexcept;
+
+    MetricsShmExporter(const MetricsShmExporter&) = delete;
+    MetricsShmExporter& operator=(const MetricsShmExporter&) = delete;
+
+    /**
+     * @brief Assign a slot to a core
+     * @param core Core to export; must stay alive until unregister_core()
+     * @param name Label shown by readers (truncated to SHM_NAME_CAPACITY - 1)
+     * @return Slot index, or -1 if core/name is null or all slots are taken
+     * @traceability DES-C-005, DES-C-010 → register_core
+     */
+    int register_core(const validation::ValidationCore* core, const char* name) noexcept;
+
+    /**
+     * @brief Release a slot; readers see it as free
+     * @param slot Index returned by register_core()
+     * @return false if slot is out of range or not registered
+     */
+    bool unregister_core(int slot) noexcept;
+
+    /**
+     * @brief Copy current metrics of every registered core into the segment
+     * @return Number of slots written
+     * @traceability DES-C-005, DES-C-010 → publish
+     */
+    size_t publish() noexcept;
+
+    const char* segment_name() const noexcept { return segment_name_.data(); }
+    size_t capacity() const noexcept { return capacity_; }
+
+private:
+    MetricsShmExporter(void* mapping, size_t mapping_size, size_t capacity,
+                       std::unique_ptr<std::atomic<const validation::ValidationCore*>[]> cores,
+                       const char* segment_name, uint64_t segment_id) noexcept;
+
+    ShmCoreSlot& slot(size_t index) noexcept;
+
+    void* mapping_;
+    size_t mapping_size_;
+    size_t capacity_;
+    std::unique_ptr<std::atomic<const validation::ValidationCore*>[]> cores_;   ///< Registered cores by slot
+    std::array<char, MAX_SEGMENT_NAME + 1> segment_name_;
+    uint64_t segment_id_;   ///< Inode of the shm object, to recognise a replacement
+};
+
+/**
+ * @brief One slot as read by MetricsShmReader
+ * @traceability DES-C-005, DES-C-010 → ShmCoreRecord
+ */
+struct ShmCoreRecord {
+    char name[SHM_NAME_CAPACITY];
+    validation::MetricsSnapshot metrics;
+    bool has_histogram;
+    std::array<uint64_t, ShmHistogramLayout::BUCKET_COUNT> histogram;
+
+    /// Latency at a percentile from the exported histogram (0 without one)
+    uint64_t latency_percentile_ns(double percentile) const noexcept;
+};
+
+/**
+ * @brief Read-only view of a segment created by MetricsShmExporter
+ * @traceability DES-C-005, DES-C-010 → MetricsShmReader
+ */
+class MetricsShmReader {
+public:
+    /// Seqlock read attempts per slot before read_slot() gives up
+    static constexpr unsigned MAX_READ_ATTEMPTS = 64;
+
+    /**
+     * @brief Map an existing segment read-only
+     * @param segment_name POSIX shm name starting with '/'
+     * @return Reader, or nullptr if missing, not initialized, or of another
+     *         layout version / histogram layout
+     */
+    static std::unique_ptr<MetricsShmReader> open(const char* segment_name = DEFAULT_SHM_SEGMENT_NAME) noexcept;
+
+    ~MetricsShmReader() noexcept;
+
+    MetricsShmReader(const MetricsShmReader&) = delete;
+    MetricsShmReader& operator=(const MetricsShmReader&) = delete;
+
+    size_t slot_capacity() const noexcept { return capacity_; }
+    uint64_t publish_count() const noexcept;
+    uint64_t exporter_pid() const noexcept;
+
+    /**
+     * @brief Consistent copy of one slot
+     * @param index Slot index (< slot_capacity())
+     * @param out Destination
+     * @return false if the slot is free, out of range, or kept changing
+     */
+    bool read_slot(size_t index, ShmCoreRecord& out) const noexcept;
+
+private:
+    MetricsShmReader(const void* mapping, size_t mapping_size, size_t capacity) noexcept;
+
+    const void* mapping_;
+    size_t mapping_size_;
+    size_t capacity_;
+};
+
+} // namespace monitoring
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_MONITORING_METRICS_SHM_EXPORTER_HPP
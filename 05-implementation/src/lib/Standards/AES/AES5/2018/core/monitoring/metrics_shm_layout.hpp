@@ -0,0 +1,117 @@
+/**
+ * @file metrics_shm_layout.hpp
+ * @brief Versioned fixed layout of the shared-memory metrics segment
+ * @traceability DES-C-005, DES-C-010 → MetricsShmLayout
+ *
+ * Shared between MetricsShmExporter (inside the audio process) and
+ * MetricsShmReader / the metrics_shm_reader tool (monitoring process). The
+ * segment is one ShmSegmentHeader followed by slot_capacity ShmCoreSlot
+ * records, one per registered ValidationCore.
+ *
+ * Every field that changes after initialization is a lock-free
+ * std::atomic<uint64_t>, so both processes access it without locks. Each
+ * slot is guarded by its own sequence counter (odd while the exporter writes
+ * it); readers retry torn reads. Header fields other than magic and
+ * publish_count are written once before magic is published.
+ *
+ * Any change to these structures must bump SHM_LAYOUT_VERSION.
+ */
+
+#ifndef AES_AES5_2018_CORE_MONITORING_METRICS_SHM_LAYOUT_HPP
+#define AES_AES5_2018_CORE_MONITORING_METRICS_SHM_LAYOUT_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../validation/latency_histogram.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace monitoring {
+
+/// "AES5MTRC" in little-endian byte order; stored last when the segment is ready
+constexpr uint64_t SHM_MAGIC = 0x4352544D35534541ULL;
+
+/// Incremented on any layout change; readers reject other versions
+constexpr uint32_t SHM_LAYOUT_VERSION = 1;
+
+/// Default POSIX shared-memory object name
+constexpr const char* DEFAULT_SHM_SEGMENT_NAME = "/aes5_validation_metrics";
+
+/// Bytes of a core name including the terminating zero
+constexpr size_t SHM_NAME_CAPACITY = 64;
+
+/// Bucket layout of exported latency histograms
+using ShmHistogramLayout = validation::LatencyHistogram::Layout;
+
+/**
+ * @brief Slot occupancy
+ * @traceability DES-C-005, DES-C-010 → ShmSlotState
+ */
+enum class ShmSlotState : uint64_t {
+    Free = 0,       ///< No core registered
+    Active = 1      ///< Registered; counters valid after the first publish
+};
+
+/**
+ * @brief Segment header (first 64 bytes of the segment)
+ * @traceability DES-C-005, DES-C-010 → ShmSegmentHeader
+ */
+struct alignas(64) ShmSegmentHeader {
+    std::atomic<uint64_t> magic;            ///< SHM_MAGIC once initialized
+    uint32_t version;                       ///< SHM_LAYOUT_VERSION
+    uint32_t header_size;                   ///< sizeof(ShmSegmentHeader)
+    uint32_t slot_size;                     ///< sizeof(ShmCoreSlot)
+    uint32_t slot_capacity;                 ///< Slots following the header
+    uint32_t histogram_bucket_count;        ///< ShmHistogramLayout::BUCKET_COUNT
+    uint32_t histogram_sub_bucket_count;    ///< ShmHistogramLayout::SUB_BUCKET_COUNT
+    uint64_t exporter_pid;                  ///< Process that created the segment
+    std::atomic<uint64_t> publish_count;    ///< Completed MetricsShmExporter::publish() rounds
+};
+
+/**
+ * @brief Exported state of one ValidationCore
+ * @traceability DES-C-005, DES-C-010 → ShmCoreSlot
+ */
+struct alignas(64) ShmCoreSlot {
+    std::atomic<uint64_t> sequence;                     ///< Odd while being written
+    std::atomic<uint64_t> state;                        ///< ShmSlotState
+    std::atomic<uint64_t> name[SHM_NAME_CAPACITY / 8];  ///< Zero-terminated, packed 8 bytes per word
+
+    // MetricsSnapshot fields
+    std::atomic<uint64_t> total_validations;
+    std::atomic<uint64_t> successful_validations;
+    std::atomic<uint64_t> failed_validations;
+    std::atomic<uint64_t> max_latency_ns;
+    std::atomic<uint64_t> total_latency_ns;
+    std::atomic<uint64_t> timed_validations;
+    std::atomic<uint64_t> deadline_violations;
+    std::atomic<uint64_t> timestamp_ns;                 ///< Core's ClockSource at publish
+    std::atomic<uint64_t> snapshot_consistent;          ///< 1 if the core snapshot was consistent
+
+    std::atomic<uint64_t> has_histogram;                ///< 1 if histogram holds the core's LatencyHistogram
+    std::atomic<uint64_t> histogram[ShmHistogramLayout::BUCKET_COUNT];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared-memory counters require address-free lock-free atomics");
+static_assert(std::is_standard_layout<ShmSegmentHeader>::value &&
+              std::is_standard_layout<ShmCoreSlot>::value, "fixed layout");
+static_assert(sizeof(ShmSegmentHeader) == 64, "header is one cache line");
+
+/// Bytes needed for a segment with slot_capacity slots
+constexpr size_t shm_segment_size(size_t slot_capacity) noexcept {
+    return sizeof(ShmSegmentHeader) + slot_capacity * sizeof(ShmCoreSlot);
+}
+
+} // namespace monitoring
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_MONITORING_METRICS_SHM_LAYOUT_HPP
@@ -0,0 +1,140 @@
+/**
+ * @file parallel_validation_engine.cpp
+ * @brief Multi-core batch validation implementation
+ * @traceability DES-C-001, DES-C-003, DES-C-005 → ParallelValidationEngine
+ */
+
+#include "parallel_validation_engine.hpp"
+#include <chrono>
+#include <new>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace parallel {
+
+std::unique_ptr<ParallelValidationEngine> ParallelValidationEngine::create(
+    std::unique_ptr<frequency_validation::FrequencyValidator> validator,
+    std::unique_ptr<rate_categories::RateCategoryManager> rate_categories,
+    size_t worker_count,
+    size_t chunk_size) noexcept {
+    if (!validator || !rate_categories || chunk_size == 0) {
+        return nullptr;
+    }
+
+    auto pool = WorkStealingPool::create(worker_count);
+    if (!pool) {
+        return nullptr;
+    }
+
+    std::unique_ptr<ParallelValidationEngine> engine(new (std::nothrow) ParallelValidationEngine(
+        std::move(validator), std::move(rate_categories), std::move(pool), chunk_size));
+    if (!engine || !engine->tallies_) {
+        return nullptr;
+    }
+    return engine;
+}
+
+ParallelValidationEngine::ParallelValidationEngine(
+    std::unique_ptr<frequency_validation::FrequencyValidator> validator,
+    std::unique_ptr<rate_categories::RateCategoryManager> rate_categories,
+    std::unique_ptr<WorkStealingPool> pool,
+    size_t chunk_size) noexcept
+    : validator_(std::move(validator))
+    , rate_categories_(std::move(rate_categories))
+    , pool_(std::move(pool))
+    , tallies_(new (std::nothrow) WorkerTally[pool_->worker_count()])
+    , chunk_size_(chunk_size)
+    , job_frequencies_(nullptr)
+    , job_count_(0)
+    , job_tolerance_ppm_(0)
+    , job_report_(nullptr) {
+}
+
+bool ParallelValidationEngine::validate(const uint32_t* frequencies,
+                                        size_t count,
+                                        ParallelValidationReport& report,
+                                        uint32_t tolerance_ppm) noexcept {
+    if (frequencies == nullptr && count > 0) {
+        return false;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    try {
+        report.status.resize(count);
+        report.closest_standard_frequency.resize(count);
+        report.deviation_ppm.resize(count);
+        report.applicable_clause.resize(count);
+        report.category.resize(count);
+    } catch (...) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(validate_mutex_);
+
+    const size_t worker_count = pool_->worker_count();
+    for (size_t worker = 0; worker < worker_count; ++worker) {
+        tallies_[worker].valid_count = 0;
+        tallies_[worker].category_counts.fill(0);
+    }
+
+    job_frequencies_ = frequencies;
+    job_count_ = count;
+    job_tolerance_ppm_ = tolerance_ppm;
+    job_report_ = &report;
+
+    const size_t chunk_count = (count + chunk_size_ - 1) / chunk_size_;
+    const uint64_t steals_before = pool_->steal_count();
+    pool_->run(chunk_count, &ParallelValidationEngine::process_chunk, this);
+
+    // Merge per-worker tallies
+    report.valid_count = 0;
+    report.category_counts.fill(0);
+    for (size_t worker = 0; worker < worker_count; ++worker) {
+        report.valid_count += tallies_[worker].valid_count;
+        for (size_t category = 0; category < RATE_CATEGORY_COUNT; ++category) {
+            report.category_counts[category] += tallies_[worker].category_counts[category];
+        }
+    }
+    report.classified_count = count - report.category_counts[static_cast<size_t>(rate_categories::RateCategory::Unknown)];
+    report.chunk_count = chunk_count;
+    report.steal_count = pool_->steal_count() - steals_before;
+    report.elapsed_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+
+    job_report_ = nullptr;
+    return true;
+}
+
+void ParallelValidationEngine::process_chunk(void* context, size_t chunk_index, size_t worker_index) noexcept {
+    auto* engine = static_cast<ParallelValidationEngine*>(context);
+    ParallelValidationReport& report = *engine->job_report_;
+
+    const size_t begin = chunk_index * engine->chunk_size_;
+    const size_t remaining = engine->job_count_ - begin;
+    const size_t count = (remaining < engine->chunk_size_) ? remaining : engine->chunk_size_;
+
+    const frequency_validation::FrequencyBatchResults results{
+        report.status.data() + begin,
+        report.closest_standard_frequency.data() + begin,
+        report.deviation_ppm.data() + begin,
+        report.applicable_clause.data() + begin
+    };
+    WorkerTally& tally = engine->tallies_[worker_index];
+    tally.valid_count += engine->validator_->validate_frequency_batch(
+        engine->job_frequencies_ + begin, count, results, engine->job_tolerance_ppm_);
+
+    rate_categories::RateCategory* categories = report.category.data() + begin;
+    engine->rate_categories_->classify_rate_category_batch(engine->job_frequencies_ + begin, count, categories);
+    for (size_t i = 0; i < count; ++i) {
+        ++tally.category_counts[static_cast<size_t>(categories[i])];
+    }
+}
+
+} // namespace parallel
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
@@ -0,0 +1,166 @@
+/**
+ * @file parallel_validation_engine.hpp
+ * @brief Multi-core batch validation for offline audits of large frequency arrays
+ * @traceability DES-C-001, DES-C-003, DES-C-005 → ParallelValidationEngine
+ *
+ * ValidationCore::batch_validate() runs on one thread and stops at the first
+ * failure. This engine splits an array into fixed-size chunks, schedules them
+ * on a WorkStealingPool, and runs FrequencyValidator::validate_frequency_batch()
+ * and RateCategoryManager::classify_rate_category_batch() on each chunk. Every
+ * element gets a result; per-worker tallies are merged into the report after
+ * the last chunk completes.
+ *
+ * @performance O(n / workers); one metrics update per chunk in each component,
+ *              per-worker tallies on separate cache lines
+ * @thread_safety validate() may be called from any thread; concurrent calls
+ *                are serialized
+ * @exception none (noexcept guarantee; allocation failure is reported as false)
+ */
+
+#ifndef AES_AES5_2018_CORE_PARALLEL_PARALLEL_VALIDATION_ENGINE_HPP
+#define AES_AES5_2018_CORE_PARALLEL_PARALLEL_VALIDATION_ENGINE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "work_stealing_pool.hpp"
+#include "../frequency_validation/frequency_validator.hpp"
+#include "../rate_categories/rate_category_manager.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace parallel {
+
+/// Number of RateCategory enumerators: Unknown plus one per bounded category
+constexpr size_t RATE_CATEGORY_COUNT = rate_categories::RATE_CATEGORY_BOUNDS.size() + 1;
+static_assert(static_cast<size_t>(rate_categories::RateCategory::Octuple) + 1 == RATE_CATEGORY_COUNT,
+              "category_counts must have one entry per RateCategory enumerator");
+
+/**
+ * @brief Per-element results and merged tallies of one parallel validation
+ * @traceability DES-C-001, DES-C-003, DES-C-005 → ParallelValidationReport
+ *
+ * Element i of each vector corresponds to input element i and matches
+ * FrequencyValidator::validate_frequency() / RateCategoryManager::
+ * get_rate_category() for that input.
+ */
+struct ParallelValidationReport {
+    std::vector<validation::ValidationResult> status;
+    std::vector<uint32_t> closest_standard_frequency;
+    std::vector<double> deviation_ppm;
+    std::vector<compliance::AES5Clause> applicable_clause;
+    std::vector<rate_categories::RateCategory> category;
+
+    size_t valid_count = 0;                                  ///< Elements with status Valid
+    size_t classified_count = 0;                             ///< Elements with a known category
+    std::array<size_t, RATE_CATEGORY_COUNT> category_counts{};  ///< Elements per RateCategory
+    size_t chunk_count = 0;                                  ///< Chunks scheduled
+    uint64_t steal_count = 0;                                ///< Chunk ranges stolen during this run
+    uint64_t elapsed_ns = 0;                                 ///< Wall-clock time of validate()
+
+    size_t size() const noexcept { return status.size(); }
+};
+
+/**
+ * @brief Work-stealing parallel validator and classifier
+ * @traceability DES-C-001, DES-C-003, DES-C-005 → ParallelValidationEngine
+ *
+ * Usage Example:
+ * @code
+ * auto engine = ParallelValidationEngine::create(std::move(validator), std::move(categories));
+ * ParallelValidationReport report;
+ * if (engine->validate(frequencies.data(), frequencies.size(), report)) {
+ *     size_t failures = report.size() - report.valid_count;
+ * }
+ * @endcode
+ */
+class ParallelValidationEngine {
+public:
+    /// Elements per scheduled chunk (amortizes scheduling and metrics updates)
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 16384;
+
+    /**
+     * @brief Create an engine and start its worker threads
+     * @param validator Frequency validator shared by all workers
+     * @param rate_categories Rate category manager shared by all workers
+     * @param worker_count Workers including the calling thread (0 = hardware concurrency)
+     * @param chunk_size Elements per chunk (> 0)
+     * @return Engine, or nullptr on invalid arguments or resource failure
+     * @traceability DES-C-005 → create
+     */
+    static std::unique_ptr<ParallelValidationEngine> create(
+        std::unique_ptr<frequency_validation::FrequencyValidator> validator,
+        std::unique_ptr<rate_categories::RateCategoryManager> rate_categories,
+        size_t worker_count = 0,
+        size_t chunk_size = DEFAULT_CHUNK_SIZE) noexcept;
+
+    ParallelValidationEngine(const ParallelValidationEngine&) = delete;
+    ParallelValidationEngine& operator=(const ParallelValidationEngine&) = delete;
+    ~ParallelValidationEngine() noexcept = default;
+
+    /**
+     * @brief Validate and classify every element of an array
+     * @param frequencies Input frequencies (Hz)
+     * @param count Number of elements (unbounded)
+     * @param report Output; vectors are resized to count
+     * @param tolerance_ppm Tolerance applied to every element
+     * @return false if frequencies is null with count > 0 or the report
+     *         could not be allocated
+     * @traceability DES-C-005 → validate
+     *
+     * Unlike ValidationCore::batch_validate() this never stops early.
+     */
+    bool validate(const uint32_t* frequencies,
+                  size_t count,
+                  ParallelValidationReport& report,
+                  uint32_t tolerance_ppm = frequency_validation::FrequencyValidator::DEFAULT_TOLERANCE_PPM) noexcept;
+
+    size_t worker_count() const noexcept { return pool_->worker_count(); }
+    size_t chunk_size() const noexcept { return chunk_size_; }
+
+    const frequency_validation::FrequencyValidator& get_validator() const noexcept { return *validator_; }
+    const rate_categories::RateCategoryManager& get_rate_category_manager() const noexcept { return *rate_categories_; }
+
+private:
+    /// Per-worker counters, one cache line each
+    struct alignas(64) WorkerTally {
+        size_t valid_count;
+        std::array<size_t, RATE_CATEGORY_COUNT> category_counts;
+    };
+
+    ParallelValidationEngine(std::unique_ptr<frequency_validation::FrequencyValidator> validator,
+                             std::unique_ptr<rate_categories::RateCategoryManager> rate_categories,
+                             std::unique_ptr<WorkStealingPool> pool,
+                             size_t chunk_size) noexcept;
+
+    /// WorkStealingPool::ChunkFunction
+    static void process_chunk(void* context, size_t chunk_index, size_t worker_index) noexcept;
+
+    std::unique_ptr<frequency_validation::FrequencyValidator> validator_;
+    std::unique_ptr<rate_categories::RateCategoryManager> rate_categories_;
+    std::unique_ptr<WorkStealingPool> pool_;
+    std::unique_ptr<WorkerTally[]> tallies_;
+    size_t chunk_size_;
+
+    std::mutex validate_mutex_;   ///< Guards the job fields below
+
+    // Current job
+    const uint32_t* job_frequencies_;
+    size_t job_count_;
+    uint32_t job_tolerance_ppm_;
+    ParallelValidationReport* job_report_;
+};
+
+} // namespace parallel
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_PARALLEL_PARALLEL_VALIDATION_ENGINE_HPP
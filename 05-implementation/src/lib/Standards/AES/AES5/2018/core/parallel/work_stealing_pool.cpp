@@ -0,0 +1,189 @@
+/**
+ * @file work_stealing_pool.cpp
+ * @brief Work-stealing thread pool implementation
+ * @traceability DES-C-005 → WorkStealingPool
+ */
+
+#include "work_stealing_pool.hpp"
+#include <new>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace parallel {
+
+std::unique_ptr<WorkStealingPool> WorkStealingPool::create(size_t worker_count) noexcept {
+    if (worker_count == 0) {
+        worker_count = std::thread::hardware_concurrency();
+    }
+    if (worker_count == 0) {
+        worker_count = 1;
+    }
+    if (worker_count > MAX_WORKERS) {
+        worker_count = MAX_WORKERS;
+    }
+
+    std::unique_ptr<WorkStealingPool> pool(new (std::nothrow) WorkStealingPool(worker_count));
+    if (!pool || !pool->ranges_ || !pool->start_threads()) {
+        return nullptr;
+    }
+    return pool;
+}
+
+WorkStealingPool::WorkStealingPool(size_t worker_count) noexcept
+    : worker_count_(worker_count)
+    , ranges_(new (std::nothrow) WorkerRange[worker_count])
+    , generation_(0)
+    , finished_workers_(0)
+    , stopping_(false)
+    , function_(nullptr)
+    , context_(nullptr)
+    , chunk_base_(0)
+    , steals_(0) {
+}
+
+bool WorkStealingPool::start_threads() noexcept {
+    try {
+        threads_.reserve(worker_count_ - 1);
+        for (size_t worker = 1; worker < worker_count_; ++worker) {
+            threads_.emplace_back(&WorkStealingPool::worker_main, this, worker);
+        }
+    } catch (...) {
+        // Destructor joins whatever was started
+        return false;
+    }
+    return true;
+}
+
+WorkStealingPool::~WorkStealingPool() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        stopping_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::worker_main(size_t worker_index) noexcept {
+    uint64_t seen_generation = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(state_mutex_);
+            start_cv_.wait(lock, [&]() { return stopping_ || generation_ != seen_generation; });
+            if (stopping_) {
+                return;
+            }
+            seen_generation = generation_;
+        }
+
+        work(worker_index);
+
+        {
+            std::lock_guard<std::mutex> lock(state_mutex_);
+            if (++finished_workers_ == worker_count_ - 1) {
+                done_cv_.notify_one();
+            }
+        }
+    }
+}
+
+void WorkStealingPool::run(size_t chunk_count, ChunkFunction function, void* context) noexcept {
+    if (chunk_count == 0 || function == nullptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+    // Ranges hold 32-bit indices; larger jobs run in rounds
+    constexpr size_t MAX_ROUND_CHUNKS = UINT32_MAX;
+    for (size_t base = 0; base < chunk_count; base += MAX_ROUND_CHUNKS) {
+        const size_t round = (chunk_count - base < MAX_ROUND_CHUNKS) ? chunk_count - base : MAX_ROUND_CHUNKS;
+
+        if (worker_count_ == 1) {
+            for (size_t chunk = 0; chunk < round; ++chunk) {
+                function(context, base + chunk, 0);
+            }
+            continue;
+        }
+
+        // Static initial split; stealing rebalances
+        for (size_t worker = 0; worker < worker_count_; ++worker) {
+            const uint64_t begin = static_cast<uint64_t>(round) * worker / worker_count_;
+            const uint64_t end = static_cast<uint64_t>(round) * (worker + 1) / worker_count_;
+            ranges_[worker].range.store(pack(begin, end), std::memory_order_relaxed);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(state_mutex_);
+            function_ = function;
+            context_ = context;
+            chunk_base_ = base;
+            finished_workers_ = 0;
+            ++generation_;
+        }
+        start_cv_.notify_all();
+
+        work(0);
+
+        std::unique_lock<std::mutex> lock(state_mutex_);
+        done_cv_.wait(lock, [&]() { return finished_workers_ == worker_count_ - 1; });
+    }
+}
+
+void WorkStealingPool::work(size_t worker_index) noexcept {
+    size_t chunk = 0;
+    while (pop_local(worker_index, chunk) || steal(worker_index, chunk)) {
+        function_(context_, chunk_base_ + chunk, worker_index);
+    }
+}
+
+bool WorkStealingPool::pop_local(size_t worker_index, size_t& chunk) noexcept {
+    std::atomic<uint64_t>& own = ranges_[worker_index].range;
+    uint64_t range = own.load(std::memory_order_acquire);
+    for (;;) {
+        const uint64_t begin = range >> 32;
+        const uint64_t end = range & 0xFFFFFFFFULL;
+        if (begin >= end) {
+            return false;
+        }
+        if (own.compare_exchange_weak(range, pack(begin + 1, end),
+                                      std::memory_order_acq_rel, std::memory_order_acquire)) {
+            chunk = static_cast<size_t>(begin);
+            return true;
+        }
+    }
+}
+
+bool WorkStealingPool::steal(size_t worker_index, size_t& chunk) noexcept {
+    for (size_t offset = 1; offset < worker_count_; ++offset) {
+        std::atomic<uint64_t>& victim = ranges_[(worker_index + offset) % worker_count_].range;
+        uint64_t range = victim.load(std::memory_order_acquire);
+        for (;;) {
+            const uint64_t begin = range >> 32;
+            const uint64_t end = range & 0xFFFFFFFFULL;
+            if (begin >= end) {
+                break;
+            }
+            // Take the back half (at least one chunk)
+            const uint64_t split = end - (end - begin + 1) / 2;
+            if (victim.compare_exchange_weak(range, pack(begin, split),
+                                             std::memory_order_acq_rel, std::memory_order_acquire)) {
+                // Own range is empty, so no thief can race this store
+                ranges_[worker_index].range.store(pack(split + 1, end), std::memory_order_release);
+                steals_.fetch_add(1, std::memory_order_relaxed);
+                chunk = static_cast<size_t>(split);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace parallel
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
@@ -0,0 +1,131 @@
+/**
+ * @file work_stealing_pool.hpp
+ * @brief Work-stealing thread pool for data-parallel chunked loops
+ * @traceability DES-C-005 → WorkStealingPool
+ *
+ * Each worker owns a contiguous range of chunk indices packed into one
+ * atomic word. Owners pop from the front; idle workers steal the back half
+ * of a victim's range with a single CAS. The calling thread participates as
+ * worker 0, so a pool of N workers starts N-1 threads.
+ *
+ * @performance Lock-free scheduling (one CAS per chunk, one per steal);
+ *              threads sleep on a condition variable between runs
+ * @thread_safety run() may be called from any thread; concurrent calls are
+ *                serialized
+ * @exception none (noexcept guarantee; thread start failure makes create() fail)
+ */
+
+#ifndef AES_AES5_2018_CORE_PARALLEL_WORK_STEALING_POOL_HPP
+#define AES_AES5_2018_CORE_PARALLEL_WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace parallel {
+
+/**
+ * @brief Work-stealing pool executing chunk callbacks
+ * @traceability DES-C-005 → WorkStealingPool
+ */
+class WorkStealingPool {
+public:
+    /**
+     * @brief Chunk callback
+     * @param context User context passed to run()
+     * @param chunk_index Chunk to process, in [0, chunk_count)
+     * @param worker_index Executing worker, in [0, worker_count()); stable for
+     *        the duration of the callback, usable to index per-worker state
+     */
+    using ChunkFunction = void (*)(void* context, size_t chunk_index, size_t worker_index);
+
+    static constexpr size_t MAX_WORKERS = 256;     ///< Upper bound on workers
+
+    /**
+     * @brief Create a pool
+     * @param worker_count Workers including the calling thread (0 = hardware
+     *        concurrency), clamped to MAX_WORKERS
+     * @return Pool, or nullptr if threads could not be started
+     */
+    static std::unique_ptr<WorkStealingPool> create(size_t worker_count = 0) noexcept;
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Stops and joins all threads
+     */
+    ~WorkStealingPool() noexcept;
+
+    /**
+     * @brief Execute function once for every chunk index and wait for completion
+     * @param chunk_count Number of chunks
+     * @param function Chunk callback (must not throw)
+     * @param context User context forwarded to function
+     */
+    void run(size_t chunk_count, ChunkFunction function, void* context) noexcept;
+
+    /**
+     * @brief Workers including the calling thread
+     */
+    size_t worker_count() const noexcept { return worker_count_; }
+
+    /**
+     * @brief Successful steals since creation
+     */
+    uint64_t steal_count() const noexcept { return steals_.load(std::memory_order_relaxed); }
+
+private:
+    /// Packed [begin, end) chunk range owned by one worker
+    struct alignas(64) WorkerRange {
+        std::atomic<uint64_t> range{0};
+    };
+
+    explicit WorkStealingPool(size_t worker_count) noexcept;
+
+    static constexpr uint64_t pack(uint64_t begin, uint64_t end) noexcept { return (begin << 32) | end; }
+
+    bool start_threads() noexcept;
+    void worker_main(size_t worker_index) noexcept;
+
+    /// Process chunks until no worker has work left
+    void work(size_t worker_index) noexcept;
+    bool pop_local(size_t worker_index, size_t& chunk) noexcept;
+    bool steal(size_t worker_index, size_t& chunk) noexcept;
+
+    size_t worker_count_;
+    std::unique_ptr<WorkerRange[]> ranges_;
+    std::vector<std::thread> threads_;
+
+    std::mutex run_mutex_;              ///< Serializes run()
+    std::mutex state_mutex_;            ///< Guards generation/finished/stopping
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    uint64_t generation_;
+    size_t finished_workers_;
+    bool stopping_;
+
+    // Current job (published under state_mutex_)
+    ChunkFunction function_;
+    void* context_;
+    size_t chunk_base_;
+
+    std::atomic<uint64_t> steals_;
+};
+
+} // namespace parallel
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_PARALLEL_WORK_STEALING_POOL_HPP
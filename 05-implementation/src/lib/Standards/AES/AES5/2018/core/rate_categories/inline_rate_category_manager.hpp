@@ -0,0 +1,97 @@
+/**
+ * @file inline_rate_category_manager.hpp
+ * @brief Header-only, allocation-free value-type rate category classifier
+ * @traceability DES-C-003 → InlineRateCategoryManager
+ *
+ * Value-type counterpart of RateCategoryManager: stack-constructible in
+ * O(1) with no allocation and no owned ValidationCore. The metrics sink is
+ * a template policy (validation/metrics_policies.hpp); classification uses
+ * the shared constexpr engine, so results equal RateCategoryManager's.
+ *
+ * @performance No allocation; O(1) table lookup per classification
+ * @thread_safety Same as the metrics policy
+ * @exception none (noexcept guarantee)
+ *
+ * Usage Example:
+ * @code
+ * InlineRateCategoryManager<validation::LocalCountersPolicy> classifier;
+ * auto result = classifier.classify_rate_category(96000);  // Double, multiplier 2.0
+ * uint64_t seen = classifier.metrics().total_validations();
+ * @endcode
+ */
+
+#ifndef AES_AES5_2018_CORE_RATE_CATEGORIES_INLINE_RATE_CATEGORY_MANAGER_HPP
+#define AES_AES5_2018_CORE_RATE_CATEGORIES_INLINE_RATE_CATEGORY_MANAGER_HPP
+
+#include <cstdint>
+
+#include "rate_category_manager.hpp"
+#include "../compile_time/aes5_compile_time.hpp"
+#include "../validation/metrics_policies.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_categories {
+
+/**
+ * @brief Stack-constructible AES5-2018 Section 5.3 rate classifier
+ * @tparam MetricsPolicy Metrics sink (see metrics_policies.hpp)
+ * @traceability DES-C-003 → InlineRateCategoryManager
+ */
+template<typename MetricsPolicy = validation::NullMetricsPolicy>
+class InlineRateCategoryManager : private MetricsPolicy {
+public:
+    explicit InlineRateCategoryManager(MetricsPolicy metrics = MetricsPolicy()) noexcept
+        : MetricsPolicy(metrics) {
+    }
+
+    /**
+     * @brief Classify a frequency; recorded as Valid or InvalidInput
+     * @traceability DES-C-003 → classify_rate_category
+     */
+    RateCategoryResult classify_rate_category(uint32_t frequency_hz) noexcept {
+        RateCategoryResult result;
+        result.frequency_hz = frequency_hz;
+        result.category = compile_time::classify_rate_category(frequency_hz);
+        result.multiplier = compile_time::rate_multiplier(frequency_hz);
+        result.exact_multiplier = compile_time::exact_rate_multiplier(frequency_hz);
+        result.exact_multiplier_44k1 =
+            compile_time::exact_rate_multiplier(frequency_hz, RATE_BASE_44K1_FREQUENCY_HZ);
+        result.valid = (result.category != RateCategory::Unknown);
+
+        MetricsPolicy::record_validation(result.valid ? validation::ValidationResult::Valid
+                                                      : validation::ValidationResult::InvalidInput);
+        return result;
+    }
+
+    /// Category only (stateless, no metrics)
+    static constexpr RateCategory get_rate_category(uint32_t frequency_hz) noexcept {
+        return compile_time::classify_rate_category(frequency_hz);
+    }
+
+    /// Multiplier relative to 48 kHz, 0.0 outside every category (no metrics)
+    static constexpr double calculate_rate_multiplier(uint32_t frequency_hz) noexcept {
+        return compile_time::rate_multiplier(frequency_hz);
+    }
+
+    /// True if frequency_hz falls into a rate category (no metrics)
+    static constexpr bool is_valid_rate_category(uint32_t frequency_hz) noexcept {
+        return compile_time::classify_rate_category(frequency_hz) != RateCategory::Unknown;
+    }
+
+    MetricsPolicy& metrics() noexcept { return *this; }
+    const MetricsPolicy& metrics() const noexcept { return *this; }
+};
+
+static_assert(sizeof(InlineRateCategoryManager<validation::LocalCountersPolicy>) <= 64,
+              "Counting classifier must fit in a cache line");
+
+} // namespace rate_categories
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_RATE_CATEGORIES_INLINE_RATE_CATEGORY_MANAGER_HPP
@@ -0,0 +1,294 @@
+/**
+ * @file period_sizing.hpp
+ * @brief Rate-category-aware audio period, buffer and core-load sizing
+ * @traceability DES-C-003 → PeriodSizing
+ *
+ * Turns a classified stream (RateCategoryResult) and a latency target into
+ * a period plan: frames per period, period count, power-of-two ring
+ * capacity, buffered latency and memory. Period limits scale with the rate
+ * category, generated at compile time from RATE_CATEGORY_BOUNDS, so a
+ * period lasts equally long in every category. A 384 kHz stream gets 8x the
+ * frames of a 48 kHz stream, not 8x the wakeups.
+ *
+ * Period choice: the largest power of two, within the category limits, of
+ * which MIN_PERIOD_COUNT periods fit into the latency target. The period
+ * count fills the rest of the target, up to MAX_PERIOD_COUNT. All
+ * arithmetic is integer (rate_ratio.hpp); every function is constexpr.
+ * Plans for the AES5-2018 standard rates at the default target are
+ * precomputed in STANDARD_PERIOD_PLANS.
+ *
+ * estimate_stream_cost() exposes a linear cost model: fixed overhead per
+ * period plus cost per sample. It gives a stream's share of one core, so a
+ * scheduler can pack streams onto cores by summing core_load_ppm.
+ *
+ * @performance plan_periods(): O(1), a handful of integer operations
+ * @thread_safety Pure functions over immutable constexpr tables
+ * @exception none (noexcept guarantee)
+ *
+ * Usage Example:
+ * @code
+ * auto category = manager->classify_rate_category(352800);
+ * PeriodPlan plan = plan_periods(category, 5000);                  // 5 ms target
+ * // plan.period_frames == 512, plan.period_count == 3, plan.latency_us == 4354
+ * StreamCost cost = estimate_stream_cost(plan);
+ * if (fits_on_core(core_load[core], cost)) { core_load[core] += cost.core_load_ppm; }
+ * @endcode
+ */
+
+#ifndef AES_AES5_2018_CORE_RATE_CATEGORIES_PERIOD_SIZING_HPP
+#define AES_AES5_2018_CORE_RATE_CATEGORIES_PERIOD_SIZING_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "rate_category.hpp"
+#include "rate_category_manager.hpp"
+#include "rate_ratio.hpp"
+#include "../compile_time/aes5_compile_time.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_categories {
+
+/// Period limits of the Basic (1x) category; other categories scale by rate
+static constexpr uint32_t BASIC_MIN_PERIOD_FRAMES = 32;
+static constexpr uint32_t BASIC_MAX_PERIOD_FRAMES = 2048;
+
+/// Fewest periods in the ring (double buffering)
+static constexpr uint32_t MIN_PERIOD_COUNT = 2;
+/// Most periods in the ring
+static constexpr uint32_t MAX_PERIOD_COUNT = 8;
+
+/// Latency target of STANDARD_PERIOD_PLANS
+static constexpr uint32_t DEFAULT_LATENCY_TARGET_US = 5000;
+
+/// One core, in the units of StreamCost::core_load_ppm
+static constexpr uint32_t CORE_CAPACITY_PPM = 1000000;
+
+/**
+ * @brief Sample layout of one frame
+ * @traceability DES-C-003 → PeriodSizing
+ */
+struct SampleFormat {
+    uint16_t channels = 2;
+    uint16_t bytes_per_sample = 4;
+
+    constexpr uint32_t bytes_per_frame() const noexcept {
+        return static_cast<uint32_t>(channels) * bytes_per_sample;
+    }
+};
+
+/**
+ * @brief Period limits of one rate category
+ * @traceability DES-C-003 → PeriodSizing
+ */
+struct PeriodSizingProfile {
+    RateCategory category;
+    uint32_t min_period_frames;     ///< Smallest period (power of two), 0 for Unknown
+    uint32_t max_period_frames;     ///< Largest period (power of two), 0 for Unknown
+};
+
+/**
+ * @brief Period and buffer layout for one stream
+ * @traceability DES-C-003 → PeriodSizing
+ */
+struct PeriodPlan {
+    uint32_t frequency_hz;          ///< Stream rate
+    RateCategory category;          ///< Rate category the limits came from
+    uint32_t period_frames;         ///< Frames per period (power of two), 0 if invalid
+    uint32_t period_count;          ///< Periods in the ring
+    uint32_t ring_capacity_frames;  ///< Power of two >= period_frames * period_count
+    uint32_t latency_us;            ///< Buffered latency, period_frames * period_count, rounded up
+    uint64_t memory_bytes;          ///< Ring memory, ring_capacity_frames * bytes per frame
+    bool meets_latency_target;      ///< latency_us <= requested target
+
+    constexpr bool is_valid() const noexcept { return period_frames != 0; }
+};
+
+/**
+ * @brief Linear processing cost model (per stream)
+ * @traceability DES-C-003 → PeriodSizing
+ *
+ * Defaults are conservative placeholders; calibrate per platform.
+ */
+struct PeriodCostModel {
+    uint32_t per_period_overhead_ns = 2000;     ///< Wakeup, scheduling, bookkeeping per period
+    uint32_t per_sample_ns = 5;                 ///< Processing per sample (frame x channel)
+};
+
+/**
+ * @brief Estimated cost of running one stream
+ * @traceability DES-C-003 → PeriodSizing
+ */
+struct StreamCost {
+    uint32_t core_load_ppm;         ///< Share of one core (CORE_CAPACITY_PPM = whole core), rounded up
+    uint64_t period_ns;             ///< Deadline: duration of one period
+    uint64_t processing_ns;         ///< Estimated work per period
+
+    /// Work per period fits within the period
+    constexpr bool meets_deadline() const noexcept { return processing_ns < period_ns; }
+};
+
+namespace detail {
+
+constexpr uint32_t floor_power_of_two(uint64_t value) noexcept {
+    uint32_t power = 1;
+    while (power <= UINT32_MAX / 2 && static_cast<uint64_t>(power) * 2 <= value) {
+        power *= 2;
+    }
+    return power;
+}
+
+constexpr uint32_t ceil_power_of_two(uint32_t value) noexcept {
+    uint32_t power = 1;
+    while (power < value) {
+        power *= 2;
+    }
+    return power;
+}
+
+constexpr std::array<PeriodSizingProfile, RATE_CATEGORY_BOUNDS.size() + 1> build_period_sizing_profiles() noexcept {
+    std::array<PeriodSizingProfile, RATE_CATEGORY_BOUNDS.size() + 1> profiles{};
+    profiles[0] = PeriodSizingProfile{RateCategory::Unknown, 0, 0};
+    for (const auto& bounds : RATE_CATEGORY_BOUNDS) {
+        // Category lower bound relative to Basic: 1/4, 1/2, 1, 2, 4, 8
+        const RateRatio scale = make_rate_ratio(bounds.min_hz, rate_category_bounds(RateCategory::Basic).min_hz);
+        profiles[static_cast<size_t>(bounds.category)] = PeriodSizingProfile{
+            bounds.category,
+            static_cast<uint32_t>(scale_frame_count(BASIC_MIN_PERIOD_FRAMES, scale)),
+            static_cast<uint32_t>(scale_frame_count(BASIC_MAX_PERIOD_FRAMES, scale))};
+    }
+    return profiles;
+}
+
+} // namespace detail
+
+/// Period limits per category, indexed by RateCategory
+static constexpr std::array<PeriodSizingProfile, RATE_CATEGORY_BOUNDS.size() + 1> PERIOD_SIZING_PROFILES =
+    detail::build_period_sizing_profiles();
+
+/// Period limits of a category (all zero for Unknown)
+constexpr const PeriodSizingProfile& period_sizing_profile(RateCategory category) noexcept {
+    return PERIOD_SIZING_PROFILES[static_cast<size_t>(category)];
+}
+
+/**
+ * @brief Plan periods and buffers for a stream
+ * @param frequency_hz Stream rate
+ * @param category Rate category of frequency_hz
+ * @param latency_target_us Upper bound for buffered latency
+ * @param format Sample layout for the memory budget
+ * @return Plan; invalid (period_frames == 0) for Unknown category or 0 Hz.
+ *         If even MIN_PERIOD_COUNT smallest periods exceed the target, the
+ *         smallest plan is returned with meets_latency_target == false.
+ * @traceability DES-C-003 → plan_periods
+ */
+constexpr PeriodPlan plan_periods(uint32_t frequency_hz, RateCategory category,
+                                  uint32_t latency_target_us, SampleFormat format = SampleFormat()) noexcept {
+    PeriodPlan plan{frequency_hz, category, 0, 0, 0, 0, 0, false};
+    const PeriodSizingProfile& profile = period_sizing_profile(category);
+    if (frequency_hz == 0 || profile.min_period_frames == 0) {
+        return plan;
+    }
+
+    const uint64_t budget_frames = convert_frame_count(latency_target_us, 1000000, frequency_hz);
+    uint32_t period = detail::floor_power_of_two(budget_frames / MIN_PERIOD_COUNT);
+    period = (period < profile.min_period_frames) ? profile.min_period_frames : period;
+    period = (period > profile.max_period_frames) ? profile.max_period_frames : period;
+
+    uint64_t count = budget_frames / period;
+    count = (count < MIN_PERIOD_COUNT) ? MIN_PERIOD_COUNT : count;
+    count = (count > MAX_PERIOD_COUNT) ? MAX_PERIOD_COUNT : count;
+
+    plan.period_frames = period;
+    plan.period_count = static_cast<uint32_t>(count);
+    plan.ring_capacity_frames = period * detail::ceil_power_of_two(plan.period_count);
+    plan.latency_us = static_cast<uint32_t>(
+        convert_frame_count_ceil(static_cast<uint64_t>(period) * count, frequency_hz, 1000000));
+    plan.memory_bytes = static_cast<uint64_t>(plan.ring_capacity_frames) * format.bytes_per_frame();
+    plan.meets_latency_target = plan.latency_us <= latency_target_us;
+    return plan;
+}
+
+/**
+ * @brief Plan periods for a classified stream
+ * @traceability DES-C-003 → plan_periods
+ */
+constexpr PeriodPlan plan_periods(const RateCategoryResult& classification, uint32_t latency_target_us,
+                                  SampleFormat format = SampleFormat()) noexcept {
+    return plan_periods(classification.frequency_hz, classification.category, latency_target_us, format);
+}
+
+/**
+ * @brief Estimate per-period work and core share of a planned stream
+ * @param plan Valid plan (an invalid plan costs nothing)
+ * @param channels Channels processed per frame
+ * @param model Cost coefficients
+ * @traceability DES-C-003 → estimate_stream_cost
+ */
+constexpr StreamCost estimate_stream_cost(const PeriodPlan& plan, uint16_t channels = SampleFormat().channels,
+                                          PeriodCostModel model = PeriodCostModel()) noexcept {
+    if (!plan.is_valid()) {
+        return StreamCost{0, 0, 0};
+    }
+    const uint64_t processing_ns = model.per_period_overhead_ns +
+        static_cast<uint64_t>(plan.period_frames) * channels * model.per_sample_ns;
+    const uint64_t period_ns = convert_frame_count(plan.period_frames, plan.frequency_hz, 1000000000);
+
+    // ppm of a core = processing per second / 1000 = processing * rate / (period * 1000)
+    const uint64_t denominator = static_cast<uint64_t>(plan.period_frames) * 1000;
+    const uint64_t load_ppm = (processing_ns * plan.frequency_hz + denominator - 1) / denominator;
+    return StreamCost{static_cast<uint32_t>(load_ppm < UINT32_MAX ? load_ppm : UINT32_MAX), period_ns, processing_ns};
+}
+
+/**
+ * @brief Whether a stream fits onto a core already carrying core_load_ppm
+ * @param utilization_cap_ppm Headroom-adjusted capacity of the core
+ * @traceability DES-C-003 → estimate_stream_cost
+ */
+constexpr bool fits_on_core(uint64_t core_load_ppm, const StreamCost& cost,
+                            uint32_t utilization_cap_ppm = CORE_CAPACITY_PPM * 7 / 10) noexcept {
+    return cost.meets_deadline() && core_load_ppm + cost.core_load_ppm <= utilization_cap_ppm;
+}
+
+namespace detail {
+
+constexpr std::array<PeriodPlan, compile_time::STANDARD_FREQUENCIES.size()> build_standard_period_plans() noexcept {
+    std::array<PeriodPlan, compile_time::STANDARD_FREQUENCIES.size()> plans{};
+    for (size_t k = 0; k < plans.size(); ++k) {
+        const uint32_t frequency = compile_time::STANDARD_FREQUENCIES[k];
+        plans[k] = plan_periods(frequency, compile_time::classify_rate_category(frequency), DEFAULT_LATENCY_TARGET_US);
+    }
+    return plans;
+}
+
+} // namespace detail
+
+/// Plans for each AES5-2018 standard rate (STANDARD_FREQUENCIES order) at the default target
+static constexpr std::array<PeriodPlan, compile_time::STANDARD_FREQUENCIES.size()> STANDARD_PERIOD_PLANS =
+    detail::build_standard_period_plans();
+
+/// Compile-time plan for template parameters
+template<uint32_t FrequencyHz, uint32_t LatencyTargetUs = DEFAULT_LATENCY_TARGET_US>
+constexpr PeriodPlan period_plan_v =
+    plan_periods(FrequencyHz, compile_time::classify_rate_category(FrequencyHz), LatencyTargetUs);
+
+static_assert(period_sizing_profile(RateCategory::Basic).min_period_frames == BASIC_MIN_PERIOD_FRAMES,
+              "Basic rate uses the base period limits");
+static_assert(period_sizing_profile(RateCategory::Octuple).max_period_frames == 8 * BASIC_MAX_PERIOD_FRAMES,
+              "Octuple rate periods scale 8x");
+static_assert(period_plan_v<48000>.period_frames * 8 == period_plan_v<384000>.period_frames,
+              "Period duration is independent of the rate category");
+static_assert(period_plan_v<48000>.meets_latency_target && period_plan_v<352800>.meets_latency_target,
+              "Default target is reachable at standard rates");
+
+} // namespace rate_categories
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_RATE_CATEGORIES_PERIOD_SIZING_HPP
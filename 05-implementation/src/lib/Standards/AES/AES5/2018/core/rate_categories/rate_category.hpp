@@ -0,0 +1,75 @@
+/**
+ * @file rate_category.hpp
+ * @brief AES5-2018 Section 5.3 rate categories and their frequency bounds
+ * @traceability DES-C-003 → AES5-2018 Section 5.3
+ *
+ * The category ranges are defined once here as constexpr data. They are
+ * shared by RateCategoryManager and the compile-time engine
+ * (compile_time/aes5_compile_time.hpp).
+ */
+
+#ifndef AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CATEGORY_HPP
+#define AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CATEGORY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_categories {
+
+/**
+ * @brief AES5-2018 Rate Categories (Section 5.3)
+ * @traceability DES-C-003 → AES5-2018 Section 5.3
+ */
+enum class RateCategory : uint8_t {
+    Unknown = 0,      ///< Unknown or invalid rate category
+    Quarter = 1,      ///< Quarter rate: 7.75-13.5 kHz
+    Half = 2,         ///< Half rate: 15.5-27 kHz
+    Basic = 3,        ///< Basic rate: 31-54 kHz (includes 32k, 44.1k, 48k)
+    Double = 4,       ///< Double rate: 62-108 kHz (includes 88.2k, 96k)
+    Quadruple = 5,    ///< Quadruple rate: 124-216 kHz (includes 176.4k, 192k)
+    Octuple = 6       ///< Octuple rate: 248-432 kHz (includes 352.8k, 384k)
+};
+
+/**
+ * @brief Inclusive frequency range of one rate category
+ * @traceability DES-C-003 → AES5-2018 Section 5.3
+ */
+struct RateCategoryBounds {
+    RateCategory category;
+    uint32_t min_hz;            ///< Lowest frequency in the category
+    uint32_t max_hz;            ///< Highest frequency in the category
+};
+
+/// Category ranges, ascending and non-overlapping; gaps classify as Unknown
+static constexpr std::array<RateCategoryBounds, 6> RATE_CATEGORY_BOUNDS = {{
+    {RateCategory::Quarter,     7750,  13500},
+    {RateCategory::Half,       15500,  27000},
+    {RateCategory::Basic,      31000,  54000},
+    {RateCategory::Double,     62000, 108000},
+    {RateCategory::Quadruple, 124000, 216000},
+    {RateCategory::Octuple,   248000, 432000}
+}};
+
+/// Reference frequency of the 1x (Basic) rate for multipliers
+static constexpr uint32_t RATE_BASE_FREQUENCY_HZ = 48000;
+
+/// Basic rate of the 44.1 kHz family (88.2k, 176.4k, 352.8k are its multiples)
+static constexpr uint32_t RATE_BASE_44K1_FREQUENCY_HZ = 44100;
+
+/// Bounds of a known category (category must not be Unknown)
+constexpr const RateCategoryBounds& rate_category_bounds(RateCategory category) noexcept {
+    return RATE_CATEGORY_BOUNDS[static_cast<size_t>(category) - 1];
+}
+
+} // namespace rate_categories
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CATEGORY_HPP
@@ -0,0 +1,159 @@
+/**
+ * @file rate_category_batch.cpp
+ * @brief Batch rate category classification for RateCategoryManager
+ * @traceability DES-C-003 → classify_rate_category_batch
+ *
+ * Scalar and SSE2 kernels plus runtime dispatch. The SSE2 kernel needs no
+ * extra compiler flags on x86-64; the AVX2 and AVX-512 kernels live in their
+ * own translation units (see CMakeLists.txt).
+ */
+
+#include "rate_category_manager.hpp"
+#include "rate_category_batch_kernels.hpp"
+#include "../compile_time/aes5_compile_time.hpp"
+#include "../simd/cpu_features.hpp"
+
+#include <array>
+#include <bitset>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_categories {
+namespace detail {
+
+namespace {
+
+constexpr std::array<uint32_t, RATE_SEGMENT_COUNT - 1> build_segment_starts() noexcept {
+    std::array<uint32_t, RATE_SEGMENT_COUNT - 1> starts{};
+    for (size_t k = 1; k < RATE_SEGMENT_COUNT; ++k) {
+        starts[k - 1] = rate_segment_start(k);
+    }
+    return starts;
+}
+
+/// Segment boundaries handed to the SIMD kernels as plain data
+constexpr std::array<uint32_t, RATE_SEGMENT_COUNT - 1> SEGMENT_STARTS = build_segment_starts();
+
+} // namespace
+
+size_t classify_batch_scalar(const RateBatchKernelArgs& args, size_t begin, size_t end) noexcept {
+    size_t classified = 0;
+    for (size_t i = begin; i < end; ++i) {
+        const uint32_t frequency = args.frequencies[i];
+        const RateCategory category = compile_time::classify_rate_category(frequency);
+        args.categories[i] = category;
+        if (args.multipliers != nullptr) {
+            args.multipliers[i] = (category != RateCategory::Unknown)
+                ? static_cast<double>(frequency) / static_cast<double>(RATE_BASE_FREQUENCY_HZ)
+                : 0.0;
+        }
+        classified += (category != RateCategory::Unknown) ? 1 : 0;
+    }
+    return classified;
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+size_t classify_batch_sse2(const RateBatchKernelArgs& args, size_t count) noexcept {
+    constexpr size_t LANES = 4;
+    constexpr size_t BOUNDARY_COUNT = RATE_SEGMENT_COUNT - 1;
+
+    const __m128i sign = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128d base = _mm_set1_pd(static_cast<double>(RATE_BASE_FREQUENCY_HZ));
+
+    // frequency >= start  <=>  (frequency ^ sign) > ((start - 1) ^ sign) as signed lanes
+    __m128i thresholds[BOUNDARY_COUNT];
+    for (size_t k = 0; k < BOUNDARY_COUNT; ++k) {
+        thresholds[k] = _mm_set1_epi32(static_cast<int32_t>((args.segment_starts[k] - 1u) ^ 0x80000000u));
+    }
+
+    size_t classified = 0;
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        const __m128i frequency = _mm_loadu_si128(reinterpret_cast<const __m128i*>(args.frequencies + i));
+        const __m128i biased = _mm_xor_si128(frequency, sign);
+
+        // Segment index = number of segment starts <= frequency
+        __m128i index = zero;
+        for (size_t k = 0; k < BOUNDARY_COUNT; ++k) {
+            index = _mm_sub_epi32(index, _mm_cmpgt_epi32(biased, thresholds[k]));
+        }
+        const __m128i valid = _mm_cmpeq_epi32(_mm_and_si128(index, one), one);
+        const __m128i category = _mm_and_si128(_mm_srli_epi32(_mm_add_epi32(index, one), 1), valid);
+
+        const int32_t bytes = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(category, zero), zero));
+        std::memcpy(args.categories + i, &bytes, LANES);
+        classified += std::bitset<LANES>(static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(valid)))).count();
+
+        if (args.multipliers != nullptr) {
+            // Valid lanes are <= 432 kHz, so the signed conversion is exact
+            const __m128i valid_frequency = _mm_and_si128(frequency, valid);
+            _mm_storeu_pd(args.multipliers + i, _mm_div_pd(_mm_cvtepi32_pd(valid_frequency), base));
+            _mm_storeu_pd(args.multipliers + i + 2,
+                          _mm_div_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(valid_frequency, 0xEE)), base));
+        }
+    }
+
+    return classified + classify_batch_scalar(args, i, count);
+}
+#endif
+
+} // namespace detail
+
+size_t RateCategoryManager::classify_rate_category_batch(
+    const uint32_t* frequencies_hz, size_t count, RateCategory* categories) const noexcept {
+    return classify_rate_category_batch(frequencies_hz, count, RateCategoryBatchResults{categories, nullptr});
+}
+
+size_t RateCategoryManager::classify_rate_category_batch(
+    const uint32_t* frequencies_hz, size_t count, const RateCategoryBatchResults& results) const noexcept {
+
+    if (frequencies_hz == nullptr || results.categories == nullptr || count == 0) {
+        return 0;
+    }
+
+    const detail::RateBatchKernelArgs args{frequencies_hz, results.categories, results.multipliers,
+                                           detail::SEGMENT_STARTS.data()};
+
+    // Metrics amortized over the batch, cache bypassed
+    const uint64_t start_ticks = validation_core_->start_measurement();
+
+    size_t classified = 0;
+    switch (simd::get_active_simd_level()) {
+#if defined(AES5_HAVE_AVX512_KERNELS)
+        case simd::SimdLevel::AVX512:
+            classified = detail::classify_batch_avx512(args, count);
+            break;
+#endif
+#if defined(AES5_HAVE_AVX2_KERNELS)
+        case simd::SimdLevel::AVX2:
+            classified = detail::classify_batch_avx2(args, count);
+            break;
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+        case simd::SimdLevel::SSE2:
+            classified = detail::classify_batch_sse2(args, count);
+            break;
+#endif
+        default:
+            classified = detail::classify_batch_scalar(args, 0, count);
+            break;
+    }
+
+    validation_core_->record_batch(count, classified, validation_core_->elapsed_measurement_ns(start_ticks));
+    return classified;
+}
+
+} // namespace rate_categories
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
@@ -0,0 +1,91 @@
+/**
+ * @file rate_category_batch_kernels.hpp
+ * @brief Internal batch classification kernels for RateCategoryManager
+ * @traceability DES-C-003 → classify_rate_category_batch
+ *
+ * Internal header - not part of the public API. Declares the scalar and
+ * SIMD kernels behind RateCategoryManager::classify_rate_category_batch().
+ * The SIMD kernels count the segment starts of rate_category_table.hpp that
+ * are <= each frequency; odd segment k is category (k + 1) / 2, even
+ * segments are the gaps (Unknown). Multipliers use the same exact division
+ * as compile_time::rate_multiplier(), so every kernel produces results
+ * identical to classify_rate_category() for every input element.
+ *
+ * Kernels built with ISA flags (-mavx2, -mavx512f, ...) must not instantiate
+ * inline or template code shared with baseline translation units (std::
+ * helpers, rate_segment_start(), ...): the linker keeps one arbitrary copy of
+ * each weak symbol, which could put AVX instructions on the SSE2/scalar path.
+ * They receive the segment starts as data and keep their helpers in an
+ * anonymous namespace; the IsaKernelWeakSymbols test checks the objects.
+ */
+
+#ifndef AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CATEGORY_BATCH_KERNELS_HPP
+#define AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CATEGORY_BATCH_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "rate_category.hpp"
+#include "rate_category_table.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_categories {
+namespace detail {
+
+/**
+ * @brief Input/output arrays for one batch kernel invocation
+ */
+struct RateBatchKernelArgs {
+    const uint32_t* frequencies;    ///< Input frequencies (Hz)
+    RateCategory* categories;       ///< Output category per element
+    double* multipliers;            ///< Optional output multiplier (may be nullptr)
+    const uint32_t* segment_starts; ///< rate_segment_start(1 .. RATE_SEGMENT_COUNT - 1)
+};
+
+static_assert(sizeof(RateCategory) == 1, "Kernels store categories as bytes");
+static_assert(static_cast<size_t>(RateCategory::Octuple) == RATE_CATEGORY_BOUNDS.size(),
+              "Segment arithmetic assumes categories numbered 1..N in ascending order");
+
+/**
+ * @brief Portable kernel for elements [begin, end)
+ * @return Number of elements in a known category
+ */
+size_t classify_batch_scalar(const RateBatchKernelArgs& args, size_t begin, size_t end) noexcept;
+
+#if defined(__SSE2__) || defined(_M_X64)
+/**
+ * @brief SSE2 kernel for elements [0, count), 4 lanes per iteration
+ * @return Number of elements in a known category
+ */
+size_t classify_batch_sse2(const RateBatchKernelArgs& args, size_t count) noexcept;
+#endif
+
+#if defined(AES5_HAVE_AVX2_KERNELS)
+/**
+ * @brief AVX2 kernel for elements [0, count), 8 lanes per iteration
+ * @return Number of elements in a known category
+ * @pre CPU supports AVX2 (checked by caller via simd::get_active_simd_level())
+ */
+size_t classify_batch_avx2(const RateBatchKernelArgs& args, size_t count) noexcept;
+#endif
+
+#if defined(AES5_HAVE_AVX512_KERNELS)
+/**
+ * @brief AVX-512 kernel for elements [0, count), 16 lanes per iteration
+ * @return Number of elements in a known category
+ * @pre CPU supports AVX-512F/BW (checked by caller via simd::get_active_simd_level())
+ */
+size_t classify_batch_avx512(const RateBatchKernelArgs& args, size_t count) noexcept;
+#endif
+
+} // namespace detail
+} // namespace rate_categories
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CATEGORY_BATCH_KERNELS_HPP
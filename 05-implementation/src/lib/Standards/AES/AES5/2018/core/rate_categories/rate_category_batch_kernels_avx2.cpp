@@ -0,0 +1,94 @@
+/**
+ * @file rate_category_batch_kernels_avx2.cpp
+ * @brief AVX2 batch classification kernel for RateCategoryManager
+ * @traceability DES-C-003 → classify_rate_category_batch
+ *
+ * Compiled with AVX2 code generation (see CMakeLists.txt) and only entered
+ * after runtime detection confirms AVX2 support. Processes 8 frequencies per
+ * iteration: segment index by compare-and-count over the segment starts,
+ * category from the index parity, multiplier by exact double division.
+ * Instantiates no inline or template code shared with other objects (see
+ * rate_category_batch_kernels.hpp).
+ */
+
+#include "rate_category_batch_kernels.hpp"
+
+#if defined(AES5_HAVE_AVX2_KERNELS)
+
+#include <immintrin.h>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_categories {
+namespace detail {
+
+namespace {
+
+// Set lanes in a compare mask; local so no shared popcount helper is instantiated here
+size_t count_lanes(unsigned mask) noexcept {
+    size_t lanes = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        ++lanes;
+    }
+    return lanes;
+}
+
+} // namespace
+
+size_t classify_batch_avx2(const RateBatchKernelArgs& args, size_t count) noexcept {
+    constexpr size_t LANES = 8;
+    constexpr size_t BOUNDARY_COUNT = RATE_SEGMENT_COUNT - 1;
+
+    const __m256i sign = _mm256_set1_epi32(static_cast<int32_t>(0x80000000u));
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256d base = _mm256_set1_pd(static_cast<double>(RATE_BASE_FREQUENCY_HZ));
+
+    // frequency >= start  <=>  (frequency ^ sign) > ((start - 1) ^ sign) as signed lanes
+    __m256i thresholds[BOUNDARY_COUNT];
+    for (size_t k = 0; k < BOUNDARY_COUNT; ++k) {
+        thresholds[k] = _mm256_set1_epi32(static_cast<int32_t>((args.segment_starts[k] - 1u) ^ 0x80000000u));
+    }
+
+    size_t classified = 0;
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        const __m256i frequency = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(args.frequencies + i));
+        const __m256i biased = _mm256_xor_si256(frequency, sign);
+
+        // Segment index = number of segment starts <= frequency
+        __m256i index = zero;
+        for (size_t k = 0; k < BOUNDARY_COUNT; ++k) {
+            index = _mm256_sub_epi32(index, _mm256_cmpgt_epi32(biased, thresholds[k]));
+        }
+        const __m256i valid = _mm256_cmpeq_epi32(_mm256_and_si256(index, one), one);
+        const __m256i category = _mm256_and_si256(_mm256_srli_epi32(_mm256_add_epi32(index, one), 1), valid);
+
+        const __m128i words = _mm_packs_epi32(_mm256_castsi256_si128(category),
+                                              _mm256_extracti128_si256(category, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(args.categories + i), _mm_packus_epi16(words, words));
+        classified += count_lanes(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(valid))));
+
+        if (args.multipliers != nullptr) {
+            // Valid lanes are <= 432 kHz, so the signed conversion is exact
+            const __m256i valid_frequency = _mm256_and_si256(frequency, valid);
+            _mm256_storeu_pd(args.multipliers + i,
+                             _mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(valid_frequency)), base));
+            _mm256_storeu_pd(args.multipliers + i + 4,
+                             _mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(valid_frequency, 1)), base));
+        }
+    }
+
+    return classified + classify_batch_scalar(args, i, count);
+}
+
+} // namespace detail
+} // namespace rate_categories
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES5_HAVE_AVX2_KERNELS
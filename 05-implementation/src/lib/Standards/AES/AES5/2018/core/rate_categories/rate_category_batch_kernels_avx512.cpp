@@ -0,0 +1,89 @@
+/**
+ * @file rate_category_batch_kernels_avx512.cpp
+ * @brief AVX-512 batch classification kernel for RateCategoryManager
+ * @traceability DES-C-003 → classify_rate_category_batch
+ *
+ * Compiled with AVX-512F/BW code generation (see CMakeLists.txt) and only
+ * entered after runtime detection confirms support. Processes 16 frequencies
+ * per iteration with native unsigned compares into mask registers; invalid
+ * lanes are zeroed by masked operations instead of blends. Instantiates no
+ * inline or template code shared with other objects (see
+ * rate_category_batch_kernels.hpp).
+ */
+
+#include "rate_category_batch_kernels.hpp"
+
+#if defined(AES5_HAVE_AVX512_KERNELS)
+
+#include <immintrin.h>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_categories {
+namespace detail {
+
+namespace {
+
+// Set lanes in a compare mask; local so no shared popcount helper is instantiated here
+size_t count_lanes(unsigned mask) noexcept {
+    size_t lanes = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        ++lanes;
+    }
+    return lanes;
+}
+
+} // namespace
+
+size_t classify_batch_avx512(const RateBatchKernelArgs& args, size_t count) noexcept {
+    constexpr size_t LANES = 16;
+    constexpr size_t BOUNDARY_COUNT = RATE_SEGMENT_COUNT - 1;
+
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512d base = _mm512_set1_pd(static_cast<double>(RATE_BASE_FREQUENCY_HZ));
+
+    __m512i starts[BOUNDARY_COUNT];
+    for (size_t k = 0; k < BOUNDARY_COUNT; ++k) {
+        starts[k] = _mm512_set1_epi32(static_cast<int32_t>(args.segment_starts[k]));
+    }
+
+    size_t classified = 0;
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        const __m512i frequency = _mm512_loadu_si512(args.frequencies + i);
+
+        // Segment index = number of segment starts <= frequency
+        __m512i index = zero;
+        for (size_t k = 0; k < BOUNDARY_COUNT; ++k) {
+            index = _mm512_mask_add_epi32(index, _mm512_cmpge_epu32_mask(frequency, starts[k]), index, one);
+        }
+        const __mmask16 valid = _mm512_test_epi32_mask(index, one);
+        const __m512i category = _mm512_maskz_srli_epi32(valid, _mm512_add_epi32(index, one), 1);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(args.categories + i), _mm512_cvtepi32_epi8(category));
+        classified += count_lanes(valid);
+
+        if (args.multipliers != nullptr) {
+            const __mmask8 valid_lo = static_cast<__mmask8>(valid);
+            const __mmask8 valid_hi = static_cast<__mmask8>(valid >> 8);
+            _mm512_storeu_pd(args.multipliers + i, _mm512_maskz_div_pd(
+                valid_lo, _mm512_cvtepu32_pd(_mm512_castsi512_si256(frequency)), base));
+            _mm512_storeu_pd(args.multipliers + i + 8, _mm512_maskz_div_pd(
+                valid_hi, _mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(frequency, 1)), base));
+        }
+    }
+
+    return classified + classify_batch_scalar(args, i, count);
+}
+
+} // namespace detail
+} // namespace rate_categories
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES5_HAVE_AVX512_KERNELS
@@ -13,8 +13,10 @@
 
 #include <memory>
 #include <cstdint>
-#include <array>
 #include <atomic>
+#include "rate_category.hpp"
+#include "rate_classification_cache.hpp"
+#include "rate_ratio.hpp"
 #include "../validation/validation_core.hpp"
 
 namespace AES {
@@ -23,20 +25,6 @@ namespace _2018 {
 namespace core {
 namespace rate_categories {
 
-/**
- * @brief AES5-2018 Rate Categories (Section 5.3)
- * @traceability DES-C-003 → AES5-2018 Section 5.3
- */
-enum class RateCategory : uint8_t {
-    Unknown = 0,      ///< Unknown or invalid rate category
-    Quarter = 1,      ///< Quarter rate: 7.75-13.5 kHz
-    Half = 2,         ///< Half rate: 15.5-27 kHz
-    Basic = 3,        ///< Basic rate: 31-54 kHz (includes 32k, 44.1k, 48k)
-    Double = 4,       ///< Double rate: 62-108 kHz (includes 88.2k, 96k)
-    Quadruple = 5,    ///< Quadruple rate: 124-216 kHz (includes 176.4k, 192k)
-    Octuple = 6       ///< Octuple rate: 248-432 kHz (includes 352.8k, 384k)
-};
-
 /**
  * @brief Rate category classification result
  * @traceability DES-C-003 → Rate Classification Result
@@ -44,6 +32,8 @@ enum class RateCategory : uint8_t {
 struct RateCategoryResult {
     RateCategory category;      ///< Classified rate category
     double multiplier;          ///< Rate multiplier relative to 48 kHz base
+    RateRatio exact_multiplier;         ///< Exact frequency / 48 kHz ({0, 1} if Unknown)
+    RateRatio exact_multiplier_44k1;    ///< Exact frequency / 44.1 kHz ({0, 1} if Unknown)
     uint32_t frequency_hz;      ///< Input frequency in Hz
     bool valid;                 ///< True if frequency fits a valid category
     
@@ -68,6 +58,19 @@ struct RateCategoryResult {
     const char* get_aes5_section() const noexcept;
 };
 
+/**
+ * @brief Caller-owned output arrays for classify_rate_category_batch()
+ * @traceability DES-C-003 → RateCategoryBatchResults
+ *
+ * Each array holds at least as many elements as the batch. Element i holds
+ * the field of the RateCategoryResult that classify_rate_category() would
+ * return for input element i.
+ */
+struct RateCategoryBatchResults {
+    RateCategory* categories;   ///< Rate category (required)
+    double* multipliers;        ///< Multiplier relative to 48 kHz (optional, may be nullptr)
+};
+
 /**
  * @brief AES5-2018 Rate Category Manager
  * @traceability DES-C-003
@@ -117,17 +120,71 @@ public:
      * - Double: 62-108 kHz (88.2k, 96k)
      * - Quadruple: 124-216 kHz (176.4k, 192k)
      * - Octuple: 248-432 kHz (352.8k, 384k)
+     *
+     * Recent results are kept in a lock-free RateClassificationCache shared
+     * by all threads. Every call is counted in the metrics; only cache
+     * misses are timed.
      */
     RateCategoryResult classify_rate_category(uint32_t frequency_hz) const noexcept;
 
+    /**
+     * @brief Classify an array of frequencies into AES5-2018 rate categories
+     * @param frequencies_hz Input sampling frequencies in Hz
+     * @param count Number of frequencies
+     * @param categories Caller-owned output, at least count elements
+     * @return Number of frequencies that fall into a known category
+     * @performance SIMD kernel selected at runtime; metrics recorded once per batch
+     * @thread_safety Thread-safe, lock-free; does not touch the classification cache
+     * @traceability DES-C-003 → classify_rate_category_batch
+     *
+     * Element i receives classify_rate_category(frequencies_hz[i]).category.
+     * Null arrays or count == 0 return 0 without recording metrics.
+     */
+    size_t classify_rate_category_batch(const uint32_t* frequencies_hz,
+                                        size_t count,
+                                        RateCategory* categories) const noexcept;
+
+    /**
+     * @brief Classify an array of frequencies into categories and multipliers
+     * @param frequencies_hz Input sampling frequencies in Hz
+     * @param count Number of frequencies
+     * @param results Caller-owned structure-of-arrays output (see RateCategoryBatchResults)
+     * @return Number of frequencies that fall into a known category
+     * @performance AVX-512 (16 lanes), AVX2 (8 lanes) or SSE2 (4 lanes) kernel
+     *              selected at runtime via simd::get_active_simd_level(), portable
+     *              scalar fallback; metrics recorded once per batch
+     * @thread_safety Thread-safe, lock-free; does not touch the classification cache
+     * @traceability DES-C-003 → classify_rate_category_batch
+     *
+     * Results are identical to classify_rate_category() for every element and
+     * every kernel. Null frequencies/categories or count == 0 return 0 without
+     * recording metrics.
+     */
+    size_t classify_rate_category_batch(const uint32_t* frequencies_hz,
+                                        size_t count,
+                                        const RateCategoryBatchResults& results) const noexcept;
+
     /**
      * @brief Get performance metrics from ValidationCore
      * @return Reference to validation metrics
      * @thread_safety Thread-safe atomic access
      * @traceability DES-C-003 → get_metrics
+     *
+     * With MetricsBackend::Sharded the reference is the core's aggregate
+     * view, refreshed by every get_metrics() call on that core, so an
+     * earlier reference changes when metrics are fetched again. Use
+     * get_metrics_snapshot() for a copy that stays fixed.
      */
     const validation::ValidationMetrics& get_metrics() const noexcept;
 
+    /**
+     * @brief Consistent, copyable metrics snapshot from ValidationCore
+     * @return Snapshot (diff with MetricsSnapshot::since() for rates)
+     * @thread_safety Thread-safe; never blocks classifying threads
+     * @traceability DES-C-003 → get_metrics_snapshot
+     */
+    validation::MetricsSnapshot get_metrics_snapshot() const noexcept;
+
     /**
      * @brief Reset performance metrics
      * @thread_safety Thread-safe atomic reset
@@ -181,20 +238,20 @@ public:
      * @brief Get AES5-2018 rate category constants
      * @traceability DES-C-003 → AES5-2018 Constants
      */
-    static constexpr uint32_t QUARTER_RATE_MIN_HZ = 7750;   ///< 7.75 kHz minimum
-    static constexpr uint32_t QUARTER_RATE_MAX_HZ = 13500;  ///< 13.5 kHz maximum
-    static constexpr uint32_t HALF_RATE_MIN_HZ = 15500;     ///< 15.5 kHz minimum
-    static constexpr uint32_t HALF_RATE_MAX_HZ = 27000;     ///< 27 kHz maximum
-    static constexpr uint32_t BASIC_RATE_MIN_HZ = 31000;    ///< 31 kHz minimum
-    static constexpr uint32_t BASIC_RATE_MAX_HZ = 54000;    ///< 54 kHz maximum
-    static constexpr uint32_t DOUBLE_RATE_MIN_HZ = 62000;   ///< 62 kHz minimum
-    static constexpr uint32_t DOUBLE_RATE_MAX_HZ = 108000;  ///< 108 kHz maximum
-    static constexpr uint32_t QUADRUPLE_RATE_MIN_HZ = 124000; ///< 124 kHz minimum
-    static constexpr uint32_t QUADRUPLE_RATE_MAX_HZ = 216000; ///< 216 kHz maximum
-    static constexpr uint32_t OCTUPLE_RATE_MIN_HZ = 248000;   ///< 248 kHz minimum
-    static constexpr uint32_t OCTUPLE_RATE_MAX_HZ = 432000;   ///< 432 kHz maximum
+    static constexpr uint32_t QUARTER_RATE_MIN_HZ = rate_category_bounds(RateCategory::Quarter).min_hz;     ///< 7.75 kHz minimum
+    static constexpr uint32_t QUARTER_RATE_MAX_HZ = rate_category_bounds(RateCategory::Quarter).max_hz;     ///< 13.5 kHz maximum
+    static constexpr uint32_t HALF_RATE_MIN_HZ = rate_category_bounds(RateCategory::Half).min_hz;           ///< 15.5 kHz minimum
+    static constexpr uint32_t HALF_RATE_MAX_HZ = rate_category_bounds(RateCategory::Half).max_hz;           ///< 27 kHz maximum
+    static constexpr uint32_t BASIC_RATE_MIN_HZ = rate_category_bounds(RateCategory::Basic).min_hz;         ///< 31 kHz minimum
+    static constexpr uint32_t BASIC_RATE_MAX_HZ = rate_category_bounds(RateCategory::Basic).max_hz;         ///< 54 kHz maximum
+    static constexpr uint32_t DOUBLE_RATE_MIN_HZ = rate_category_bounds(RateCategory::Double).min_hz;       ///< 62 kHz minimum
+    static constexpr uint32_t DOUBLE_RATE_MAX_HZ = rate_category_bounds(RateCategory::Double).max_hz;       ///< 108 kHz maximum
+    static constexpr uint32_t QUADRUPLE_RATE_MIN_HZ = rate_category_bounds(RateCategory::Quadruple).min_hz; ///< 124 kHz minimum
+    static constexpr uint32_t QUADRUPLE_RATE_MAX_HZ = rate_category_bounds(RateCategory::Quadruple).max_hz; ///< 216 kHz maximum
+    static constexpr uint32_t OCTUPLE_RATE_MIN_HZ = rate_category_bounds(RateCategory::Octuple).min_hz;     ///< 248 kHz minimum
+    static constexpr uint32_t OCTUPLE_RATE_MAX_HZ = rate_category_bounds(RateCategory::Octuple).max_hz;     ///< 432 kHz maximum
 
-    static constexpr uint32_t BASE_FREQUENCY_HZ = 48000;    ///< 48 kHz base frequency
+    static constexpr uint32_t BASE_FREQUENCY_HZ = RATE_BASE_FREQUENCY_HZ;    ///< 48 kHz base frequency
     static constexpr double DEFAULT_TOLERANCE_PERCENT = 5.0; ///< Default tolerance
 
 private:
@@ -208,30 +265,12 @@ private:
     // ValidationCore for performance monitoring
     std::unique_ptr<validation::ValidationCore> validation_core_;
 
-    // Static rate category validation function for ValidationCore
-    static validation::ValidationResult rate_category_validation_function(
-        uint32_t frequency, void* context) noexcept;
-    
     // Internal implementation methods
     RateCategory classify_rate_category_internal(uint32_t frequency_hz) const noexcept;
     double calculate_multiplier_internal(uint32_t frequency_hz) const noexcept;
     
-    // Performance optimization members
-    mutable uint32_t last_frequency_;      ///< Cache last frequency for optimization
-    mutable RateCategory last_category_;   ///< Cache last category for optimization
-    mutable double last_multiplier_;       ///< Cache last multiplier for optimization
-    
-    // Internal lookup table for performance optimization
-    static constexpr size_t LOOKUP_TABLE_SIZE = 32;
-    mutable std::array<uint32_t, LOOKUP_TABLE_SIZE> frequency_cache_;
-    mutable std::array<RateCategory, LOOKUP_TABLE_SIZE> category_cache_;
-    mutable std::array<double, LOOKUP_TABLE_SIZE> multiplier_cache_;
-    mutable std::atomic<size_t> cache_index_{0};  ///< Current cache index
-    
-    // REFACTOR PHASE: High-performance O(1) lookup tables
-    static constexpr size_t FREQUENCY_LOOKUP_SIZE = 512;  ///< 0-511 kHz range
-    static const std::array<RateCategory, FREQUENCY_LOOKUP_SIZE> frequency_to_category_lookup_;
-    static const std::array<double, FREQUENCY_LOOKUP_SIZE> frequency_to_multiplier_lookup_;
+    // Lock-free cache of recent classifications, shared by all calling threads
+    mutable RateClassificationCache<> classification_cache_;
     
     // Performance optimization methods
     RateCategory classify_frequency_optimized(uint32_t frequency_hz) const noexcept;
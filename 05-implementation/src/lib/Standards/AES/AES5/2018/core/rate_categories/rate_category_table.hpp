@@ -0,0 +1,160 @@
+/**
+ * @file rate_category_table.hpp
+ * @brief Compile-time two-level rate category lookup for every integer Hz
+ * @traceability DES-C-003 → classify_rate_category
+ *
+ * Internal header - not part of the public API; use
+ * compile_time::classify_rate_category(). The category ranges of
+ * RATE_CATEGORY_BOUNDS split the frequency axis into segments (a gap, a
+ * category, a gap, ...). The axis is cut into BUCKET_HZ-wide buckets; the
+ * generator checks that no bucket holds more than one segment boundary, so
+ * one 16-bit entry per bucket is enough:
+ *
+ *     bits 0..10   offset of the boundary inside the bucket (BUCKET_HZ = none)
+ *     bits 11..14  segment at the start of the bucket
+ *
+ * segment = entry.segment + (offset_in_bucket >= entry.offset), then one
+ * 13-byte segment → category map. Frequencies beyond the last category
+ * clamp to a final all-Unknown bucket.
+ *
+ * @performance O(1): one clamp, one table load, one compare, one byte load;
+ *              no data-dependent branches. ~850 bytes of tables
+ * @thread_safety Immutable constexpr data
+ */
+
+#ifndef AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CATEGORY_TABLE_HPP
+#define AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CATEGORY_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "rate_category.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_categories {
+namespace detail {
+
+/// Bucket width; must not exceed the smallest distance between segment boundaries
+static constexpr unsigned BUCKET_SHIFT = 10;
+static constexpr uint32_t BUCKET_HZ = 1u << BUCKET_SHIFT;
+
+static constexpr unsigned SEGMENT_SHIFT = BUCKET_SHIFT + 1;
+static constexpr uint16_t OFFSET_MASK = (1u << SEGMENT_SHIFT) - 1;
+
+/// Gap below each category, the category itself, and the gap above the last one
+static constexpr size_t RATE_SEGMENT_COUNT = 2 * RATE_CATEGORY_BOUNDS.size() + 1;
+
+/// First frequency of segment k (k >= 1): alternately a category min and max + 1
+constexpr uint32_t rate_segment_start(size_t k) noexcept {
+    const RateCategoryBounds& bounds = RATE_CATEGORY_BOUNDS[(k - 1) / 2];
+    return (k % 2 == 1) ? bounds.min_hz : bounds.max_hz + 1;
+}
+
+/// First frequency of the last segment (everything above the highest category)
+static constexpr uint32_t LAST_SEGMENT_START = rate_segment_start(RATE_SEGMENT_COUNT - 1);
+
+/// Buckets up to and including the first bucket lying wholly in the last segment
+static constexpr size_t RATE_BUCKET_COUNT = ((LAST_SEGMENT_START + BUCKET_HZ - 1) >> BUCKET_SHIFT) + 1;
+
+static_assert(RATE_SEGMENT_COUNT <= 16, "Segment index must fit in four bits");
+
+constexpr bool rate_segments_fit_buckets() noexcept {
+    for (size_t k = 2; k < RATE_SEGMENT_COUNT; ++k) {
+        if (rate_segment_start(k) - rate_segment_start(k - 1) < BUCKET_HZ) {
+            return false;
+        }
+    }
+    return rate_segment_start(1) >= BUCKET_HZ;
+}
+
+static_assert(rate_segments_fit_buckets(), "Segment boundaries must be at least BUCKET_HZ apart");
+
+constexpr std::array<uint16_t, RATE_BUCKET_COUNT> build_rate_bucket_table() noexcept {
+    std::array<uint16_t, RATE_BUCKET_COUNT> table{};
+    size_t segment = 0;
+    for (size_t bucket = 0; bucket < RATE_BUCKET_COUNT; ++bucket) {
+        const uint32_t bucket_start = static_cast<uint32_t>(bucket << BUCKET_SHIFT);
+        while (segment + 1 < RATE_SEGMENT_COUNT && rate_segment_start(segment + 1) <= bucket_start) {
+            ++segment;
+        }
+        uint32_t offset = BUCKET_HZ;
+        if (segment + 1 < RATE_SEGMENT_COUNT && rate_segment_start(segment + 1) < bucket_start + BUCKET_HZ) {
+            offset = rate_segment_start(segment + 1) - bucket_start;
+        }
+        table[bucket] = static_cast<uint16_t>((segment << SEGMENT_SHIFT) | offset);
+    }
+    return table;
+}
+
+constexpr std::array<RateCategory, RATE_SEGMENT_COUNT> build_rate_segment_categories() noexcept {
+    std::array<RateCategory, RATE_SEGMENT_COUNT> categories{};
+    for (size_t k = 0; k < RATE_SEGMENT_COUNT; ++k) {
+        categories[k] = (k % 2 == 1) ? RATE_CATEGORY_BOUNDS[k / 2].category : RateCategory::Unknown;
+    }
+    return categories;
+}
+
+/// Per-bucket segment and boundary offset
+static constexpr std::array<uint16_t, RATE_BUCKET_COUNT> RATE_BUCKET_TABLE = build_rate_bucket_table();
+
+/// Category of each segment
+static constexpr std::array<RateCategory, RATE_SEGMENT_COUNT> RATE_SEGMENT_CATEGORIES =
+    build_rate_segment_categories();
+
+/**
+ * @brief Rate category by two-level table lookup
+ */
+constexpr RateCategory lookup_rate_category(uint32_t frequency_hz) noexcept {
+    const uint32_t bucket = frequency_hz >> BUCKET_SHIFT;
+    const uint32_t last = static_cast<uint32_t>(RATE_BUCKET_COUNT - 1);
+    const uint16_t entry = RATE_BUCKET_TABLE[bucket < last ? bucket : last];
+    const uint32_t offset = (bucket < last) ? (frequency_hz & (BUCKET_HZ - 1)) : 0;
+    const size_t segment = (entry >> SEGMENT_SHIFT) + ((offset >= (entry & OFFSET_MASK)) ? 1 : 0);
+    return RATE_SEGMENT_CATEGORIES[segment];
+}
+
+/**
+ * @brief Rate category by range checks over RATE_CATEGORY_BOUNDS (reference)
+ */
+constexpr RateCategory classify_rate_category_by_range(uint32_t frequency_hz) noexcept {
+    for (const auto& bounds : RATE_CATEGORY_BOUNDS) {
+        if (frequency_hz >= bounds.min_hz && frequency_hz <= bounds.max_hz) {
+            return bounds.category;
+        }
+    }
+    return RateCategory::Unknown;
+}
+
+constexpr bool rate_table_matches_ranges() noexcept {
+    const uint32_t probes[] = {0, 1, BUCKET_HZ - 1, BUCKET_HZ, 44100, 48000, 88200, 176400, 352800,
+                               LAST_SEGMENT_START + BUCKET_HZ, UINT32_MAX};
+    for (uint32_t frequency : probes) {
+        if (lookup_rate_category(frequency) != classify_rate_category_by_range(frequency)) {
+            return false;
+        }
+    }
+    for (size_t k = 1; k < RATE_SEGMENT_COUNT; ++k) {
+        const uint32_t start = rate_segment_start(k);
+        if (lookup_rate_category(start - 1) != classify_rate_category_by_range(start - 1) ||
+            lookup_rate_category(start) != classify_rate_category_by_range(start)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(rate_table_matches_ranges(), "Bucket table must agree with the category ranges at every boundary");
+static_assert(sizeof(RATE_BUCKET_TABLE) + sizeof(RATE_SEGMENT_CATEGORIES) < 1024, "Lookup tables must stay under 1 KB");
+
+} // namespace detail
+} // namespace rate_categories
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CATEGORY_TABLE_HPP
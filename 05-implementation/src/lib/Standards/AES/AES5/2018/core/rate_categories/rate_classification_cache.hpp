@@ -0,0 +1,163 @@
+/**
+ * @file rate_classification_cache.hpp
+ * @brief Lock-free set-associative cache of rate category classifications
+ * @traceability DES-C-003 → RateClassificationCache
+ *
+ * Maps recently classified frequencies to their RateCategory for
+ * RateCategoryManager::classify_rate_category(). Each entry is packed into
+ * one 64-bit word (occupied bit | category | frequency) and written with a
+ * single atomic store, so a reader always sees a whole entry, never a torn
+ * key/value pair. Classification is a pure function of the frequency: a
+ * concurrent overwrite can only replace one correct entry with another, and
+ * a reader either hits a correct entry or misses.
+ *
+ * A frequency hashes to one set of Ways entries (one cache line for the
+ * default 4 ways); a miss inserts into the first free way, otherwise
+ * replaces ways round-robin per set.
+ *
+ * @performance lookup(): one multiply, Ways relaxed loads in one cache line
+ * @thread_safety lookup() and insert() are lock-free and may run
+ *                concurrently from any number of threads
+ * @exception none (noexcept guarantee)
+ */
+
+#ifndef AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CLASSIFICATION_CACHE_HPP
+#define AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CLASSIFICATION_CACHE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "rate_category.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_categories {
+namespace detail {
+
+/// Smallest power of two holding ways 64-bit entries, capped at a cache line
+constexpr size_t cache_set_alignment(size_t ways) noexcept {
+    size_t alignment = sizeof(uint64_t);
+    while (alignment < ways * sizeof(uint64_t) && alignment < 64) {
+        alignment *= 2;
+    }
+    return alignment;
+}
+
+} // namespace detail
+
+/**
+ * @brief Lock-free N-way set-associative frequency → RateCategory cache
+ * @tparam Sets Number of sets; power of two
+ * @tparam Ways Entries per set
+ * @traceability DES-C-003 → RateClassificationCache
+ */
+template<size_t Sets = 16, size_t Ways = 4>
+class RateClassificationCache {
+    static_assert(Sets >= 1 && Sets <= 65536 && (Sets & (Sets - 1)) == 0, "Sets must be a power of two");
+    static_assert(Ways >= 1 && Ways <= 256, "Ways must fit the victim counter");
+
+public:
+    RateClassificationCache() noexcept { clear(); }
+
+    RateClassificationCache(const RateClassificationCache&) = delete;
+    RateClassificationCache& operator=(const RateClassificationCache&) = delete;
+
+    /**
+     * @brief Look up a cached classification
+     * @param frequency_hz Frequency to find
+     * @param category Receives the cached category on a hit
+     * @return true on a hit
+     */
+    bool lookup(uint32_t frequency_hz, RateCategory& category) const noexcept {
+        const Set& set = sets_[set_index(frequency_hz)];
+        for (size_t way = 0; way < Ways; ++way) {
+            const uint64_t entry = set.entries[way].load(std::memory_order_relaxed);
+            if ((entry & KEY_MASK) == (OCCUPIED | frequency_hz)) {
+                category = static_cast<RateCategory>(static_cast<uint8_t>(entry >> CATEGORY_SHIFT));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Cache a classification
+     * @param frequency_hz Classified frequency
+     * @param category Its category (must be the pure classification result)
+     */
+    void insert(uint32_t frequency_hz, RateCategory category) noexcept {
+        const size_t index = set_index(frequency_hz);
+        Set& set = sets_[index];
+        const uint64_t entry = OCCUPIED | (static_cast<uint64_t>(category) << CATEGORY_SHIFT) | frequency_hz;
+
+        for (size_t way = 0; way < Ways; ++way) {
+            const uint64_t current = set.entries[way].load(std::memory_order_relaxed);
+            if (current == 0 || (current & KEY_MASK) == (OCCUPIED | frequency_hz)) {
+                set.entries[way].store(entry, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        // Set full: round-robin victim. Load/store instead of an RMW - racing
+        // inserters may pick the same way, which only costs a cached entry
+        std::atomic<uint8_t>& next_victim = next_victims_[index];
+        const uint8_t victim = next_victim.load(std::memory_order_relaxed);
+        next_victim.store(static_cast<uint8_t>((victim + 1) % Ways), std::memory_order_relaxed);
+        set.entries[victim % Ways].store(entry, std::memory_order_relaxed);
+    }
+
+    /// Drop all entries; safe concurrently with lookups (they miss)
+    void clear() noexcept {
+        for (auto& set : sets_) {
+            for (auto& entry : set.entries) {
+                entry.store(0, std::memory_order_relaxed);
+            }
+        }
+        for (auto& next_victim : next_victims_) {
+            next_victim.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    static constexpr size_t capacity() noexcept { return Sets * Ways; }
+
+private:
+    static constexpr uint64_t OCCUPIED = 1ULL << 63;
+    static constexpr unsigned CATEGORY_SHIFT = 32;
+    static constexpr uint64_t KEY_MASK = OCCUPIED | 0xFFFFFFFFULL;
+
+    static constexpr unsigned set_bits() noexcept {
+        unsigned bits = 0;
+        while ((size_t{1} << bits) < Sets) {
+            ++bits;
+        }
+        return bits;
+    }
+
+    /// Fibonacci hashing: upper bits of the product spread nearby rates
+    static size_t set_index(uint32_t frequency_hz) noexcept {
+        if constexpr (Sets == 1) {
+            return 0;
+        } else {
+            return static_cast<size_t>((frequency_hz * 0x9E3779B1u) >> (32 - set_bits()));
+        }
+    }
+
+    /// One set; aligned so a set of up to 8 ways never straddles a cache line
+    struct alignas(detail::cache_set_alignment(Ways)) Set {
+        std::atomic<uint64_t> entries[Ways];
+    };
+
+    Set sets_[Sets];
+    std::atomic<uint8_t> next_victims_[Sets];    ///< Round-robin replacement position per set
+};
+
+} // namespace rate_categories
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_CLASSIFICATION_CACHE_HPP
@@ -0,0 +1,157 @@
+/**
+ * @file rate_ratio.hpp
+ * @brief Exact rational rate multipliers and integer frame-count conversion
+ * @traceability DES-C-003 → calculate_rate_multiplier
+ *
+ * RateCategoryResult::multiplier is a double, so 44.1 kHz-family rates come
+ * out inexact (44100 / 48000 = 0.91875 only approximately). RateRatio keeps
+ * the reduced fraction instead, and the helpers below convert frame counts
+ * between rates with integer arithmetic only:
+ *
+ * - convert_frame_count()/convert_frame_count_ceil(): one-shot floor/ceil
+ * - FrameCountConverter: running conversion that carries the remainder, so
+ *   after any number of periods the total equals the one-shot conversion of
+ *   the summed input - no cumulative drift
+ *
+ * Intermediate products stay below 2^38 for rates up to 432 kHz; results
+ * are exact whenever they fit in 64 bits.
+ *
+ * @performance One gcd per ratio; conversions are two divisions by the
+ *              reduced denominator
+ * @thread_safety RateRatio and the free functions are pure;
+ *                FrameCountConverter is not thread-safe (one per stream)
+ * @exception none (noexcept guarantee)
+ *
+ * Usage Example:
+ * @code
+ * constexpr RateRatio ratio = make_rate_ratio(44100, 48000);   // 147/160
+ * uint64_t frames = convert_frame_count(480, 48000, 44100);    // 441
+ *
+ * FrameCountConverter to_device(48000, 44100);
+ * uint64_t period = to_device.convert(256);                     // 235, 0.2 frame carried
+ * @endcode
+ */
+
+#ifndef AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_RATIO_HPP
+#define AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_RATIO_HPP
+
+#include <cstdint>
+#include <numeric>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_categories {
+
+/**
+ * @brief Reduced fraction numerator / denominator (denominator > 0)
+ * @traceability DES-C-003 → calculate_rate_multiplier
+ */
+struct RateRatio {
+    uint32_t numerator;         ///< Reduced numerator
+    uint32_t denominator;       ///< Reduced denominator, never 0
+
+    /// True if the ratio is a whole number (e.g. 2/1 for 96 kHz over 48 kHz)
+    constexpr bool is_integer() const noexcept { return denominator == 1; }
+
+    /// Nearest double, for display and legacy callers
+    constexpr double to_double() const noexcept {
+        return static_cast<double>(numerator) / static_cast<double>(denominator);
+    }
+
+    constexpr bool operator==(const RateRatio& other) const noexcept {
+        return numerator == other.numerator && denominator == other.denominator;
+    }
+    constexpr bool operator!=(const RateRatio& other) const noexcept { return !(*this == other); }
+};
+
+/**
+ * @brief Reduced ratio frequency_hz / base_hz
+ * @return {0, 1} if either frequency is 0
+ */
+constexpr RateRatio make_rate_ratio(uint32_t frequency_hz, uint32_t base_hz) noexcept {
+    if (frequency_hz == 0 || base_hz == 0) {
+        return RateRatio{0, 1};
+    }
+    const uint32_t divisor = std::gcd(frequency_hz, base_hz);
+    return RateRatio{frequency_hz / divisor, base_hz / divisor};
+}
+
+/**
+ * @brief frames * ratio, rounded down
+ *
+ * Splits frames by the denominator so no intermediate product exceeds
+ * numerator * denominator.
+ */
+constexpr uint64_t scale_frame_count(uint64_t frames, RateRatio ratio) noexcept {
+    return (frames / ratio.denominator) * ratio.numerator +
+           ((frames % ratio.denominator) * ratio.numerator) / ratio.denominator;
+}
+
+/**
+ * @brief Frames at to_hz covering frames at from_hz, rounded down
+ * @return 0 if from_hz is 0
+ */
+constexpr uint64_t convert_frame_count(uint64_t frames, uint32_t from_hz, uint32_t to_hz) noexcept {
+    return scale_frame_count(frames, make_rate_ratio(to_hz, from_hz));
+}
+
+/**
+ * @brief Frames at to_hz covering frames at from_hz, rounded up
+ * @return 0 if from_hz is 0
+ */
+constexpr uint64_t convert_frame_count_ceil(uint64_t frames, uint32_t from_hz, uint32_t to_hz) noexcept {
+    const RateRatio ratio = make_rate_ratio(to_hz, from_hz);
+    const uint64_t remainder_product = (frames % ratio.denominator) * ratio.numerator;
+    return (frames / ratio.denominator) * ratio.numerator +
+           (remainder_product + ratio.denominator - 1) / ratio.denominator;
+}
+
+/**
+ * @brief Drift-free running frame-count conversion between two rates
+ * @traceability DES-C-003 → calculate_rate_multiplier
+ *
+ * Each convert() returns whole frames at the target rate and carries the
+ * fractional part to the next call. The sum of all results always equals
+ * convert_frame_count(sum of all inputs, from_hz, to_hz).
+ */
+class FrameCountConverter {
+public:
+    constexpr FrameCountConverter(uint32_t from_hz, uint32_t to_hz) noexcept
+        : ratio_(make_rate_ratio(to_hz, from_hz)), remainder_(0) {
+    }
+
+    /// Target-rate frames for the next source_frames, carrying the remainder
+    constexpr uint64_t convert(uint64_t source_frames) noexcept {
+        const uint64_t carried = remainder_ + (source_frames % ratio_.denominator) * ratio_.numerator;
+        remainder_ = carried % ratio_.denominator;
+        return (source_frames / ratio_.denominator) * ratio_.numerator + carried / ratio_.denominator;
+    }
+
+    /// Pending fraction of a target frame, in units of 1 / ratio().denominator
+    constexpr uint64_t remainder() const noexcept { return remainder_; }
+
+    /// Target rate / source rate
+    constexpr RateRatio ratio() const noexcept { return ratio_; }
+
+    /// Drop the carried fraction (e.g. on stream restart)
+    constexpr void reset() noexcept { remainder_ = 0; }
+
+private:
+    RateRatio ratio_;
+    uint64_t remainder_;        ///< Always < ratio_.denominator
+};
+
+static_assert(make_rate_ratio(44100, 48000) == RateRatio{147, 160}, "44.1 kHz is 147/160 of 48 kHz");
+static_assert(make_rate_ratio(96000, 48000) == RateRatio{2, 1}, "96 kHz is twice 48 kHz");
+static_assert(convert_frame_count(480, 48000, 44100) == 441, "10 ms at 48 kHz is 441 frames at 44.1 kHz");
+static_assert(convert_frame_count_ceil(1, 48000, 44100) == 1, "Any partial frame rounds up");
+
+} // namespace rate_categories
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_RATE_CATEGORIES_RATE_RATIO_HPP
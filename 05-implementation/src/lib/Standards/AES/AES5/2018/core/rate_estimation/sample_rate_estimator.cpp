@@ -0,0 +1,131 @@
+/**
+ * @file sample_rate_estimator.cpp
+ * @brief Streaming sample-rate estimator implementation
+ * @traceability DES-C-008 → SampleRateEstimator
+ */
+
+#include "sample_rate_estimator.hpp"
+#include <cmath>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_estimation {
+
+SampleRateEstimator::SampleRateEstimator(uint32_t window_updates) noexcept
+    : window_updates_(window_updates < 2 ? 2 : window_updates)
+    , decay_(1.0 - 1.0 / static_cast<double>(window_updates_)) {
+    reset();
+}
+
+void SampleRateEstimator::reset() noexcept {
+    last_frame_ = 0;
+    last_timestamp_ns_ = 0;
+    weight_ = 0.0;
+    mean_frames_ = 0.0;
+    mean_ns_ = 0.0;
+    comoment_ff_ = 0.0;
+    comoment_fn_ = 0.0;
+    comoment_nn_ = 0.0;
+    last_period_ns_ = 0.0;
+    drift_ppb_per_second_ = 0.0;
+    accepted_updates_ = 0;
+    rejected_updates_ = 0;
+}
+
+bool SampleRateEstimator::update(uint64_t frame_position, uint64_t timestamp_ns) noexcept {
+    if (accepted_updates_ == 0) {
+        // First point: origin of the fit
+        last_frame_ = frame_position;
+        last_timestamp_ns_ = timestamp_ns;
+        weight_ = 1.0;
+        accepted_updates_ = 1;
+        return true;
+    }
+
+    // Deltas in modular arithmetic so counter wrap is harmless
+    const int64_t frame_delta = static_cast<int64_t>(frame_position - last_frame_);
+    const int64_t time_delta = static_cast<int64_t>(timestamp_ns - last_timestamp_ns_);
+    if (frame_delta <= 0 || time_delta <= 0) {
+        ++rejected_updates_;
+        return false;
+    }
+
+    // New point relative to the previous origin
+    const double x = static_cast<double>(frame_delta);
+    const double y = static_cast<double>(time_delta);
+
+    // Exponentially weighted Welford update
+    weight_ = decay_ * weight_ + 1.0;
+    const double inverse_weight = 1.0 / weight_;
+    const double dx = x - mean_frames_;
+    const double dy = y - mean_ns_;
+    mean_frames_ += dx * inverse_weight;
+    mean_ns_ += dy * inverse_weight;
+    comoment_ff_ = decay_ * comoment_ff_ + dx * (x - mean_frames_);
+    comoment_fn_ = decay_ * comoment_fn_ + dx * (y - mean_ns_);
+    comoment_nn_ = decay_ * comoment_nn_ + dy * (y - mean_ns_);
+
+    // Re-base on the new point; co-moments are translation invariant
+    mean_frames_ -= x;
+    mean_ns_ -= y;
+    last_frame_ = frame_position;
+    last_timestamp_ns_ = timestamp_ns;
+    ++accepted_updates_;
+
+    // Drift: smoothed change of the rate estimate per second
+    const double period = period_ns();
+    if (period > 0.0) {
+        if (last_period_ns_ > 0.0) {
+            const double rate_change_ppb = (last_period_ns_ / period - 1.0) * 1e9;
+            const double instantaneous = rate_change_ppb * 1e9 / y;
+            drift_ppb_per_second_ += (instantaneous - drift_ppb_per_second_) * (1.0 - decay_);
+        }
+        last_period_ns_ = period;
+    }
+    return true;
+}
+
+double SampleRateEstimator::period_ns() const noexcept {
+    if (accepted_updates_ < MIN_UPDATES || comoment_ff_ <= 0.0) {
+        return 0.0;
+    }
+    return comoment_fn_ / comoment_ff_;
+}
+
+SampleRateEstimate SampleRateEstimator::estimate() const noexcept {
+    SampleRateEstimate estimate{};
+    estimate.accepted_updates = accepted_updates_;
+    estimate.rejected_updates = rejected_updates_;
+
+    const double period = period_ns();
+    if (period <= 0.0) {
+        return estimate;
+    }
+
+    estimate.frequency_hz = 1e9 / period;
+    const double q32_32 = std::ldexp(estimate.frequency_hz, 32);
+    estimate.frequency.q32_32 = (q32_32 >= 18446744073709551615.0)
+        ? UINT64_MAX
+        : static_cast<uint64_t>(q32_32);
+
+    // Standard error of the slope from the weighted residual variance
+    const double residual = comoment_nn_ - comoment_fn_ * comoment_fn_ / comoment_ff_;
+    const double degrees = (weight_ > 3.0) ? weight_ - 2.0 : 1.0;
+    const double slope_variance = (residual > 0.0 ? residual : 0.0) / degrees / comoment_ff_;
+    estimate.uncertainty_ppb = std::sqrt(slope_variance) / period * 1e9;
+    estimate.drift_ppb_per_second = drift_ppb_per_second_;
+    return estimate;
+}
+
+frequency_validation::FrequencyValidationResult SampleRateEstimator::validate(
+    const frequency_validation::FrequencyValidator& validator, uint32_t tolerance_ppm) const noexcept {
+    return validator.validate_frequency(estimate().frequency, tolerance_ppm);
+}
+
+} // namespace rate_estimation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
@@ -0,0 +1,163 @@
+/**
+ * @file sample_rate_estimator.hpp
+ * @brief Streaming sample-rate estimator from sample-clock timestamps
+ * @traceability DES-C-008 → SampleRateEstimator
+ *
+ * Turns (frame position, timestamp) pairs - for example the frame counter of
+ * an audio callback paired with audio_interface_t::get_sample_clock_ns() -
+ * into a measured sampling frequency that can be passed straight to
+ * FrequencyValidator::validate_frequency(PreciseFrequency).
+ *
+ * The fit is an exponentially weighted least-squares line through
+ * (frames, time) maintained in Welford form: means and co-moments are
+ * updated in O(1) per timestamp and re-based on the newest point, so
+ * precision does not degrade with stream age.
+ *
+ * @performance O(1) per update (one division), fixed footprint, no allocation
+ * @thread_safety One writer per estimator; concurrent update() calls on the
+ *                same instance are not supported. Distinct instances are
+ *                independent.
+ * @exception none (noexcept guarantee)
+ */
+
+#ifndef AES_AES5_2018_CORE_RATE_ESTIMATION_SAMPLE_RATE_ESTIMATOR_HPP
+#define AES_AES5_2018_CORE_RATE_ESTIMATION_SAMPLE_RATE_ESTIMATOR_HPP
+
+#include <cstdint>
+
+#include "../frequency_validation/frequency_validator.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace rate_estimation {
+
+/**
+ * @brief Snapshot of a sample-rate estimate
+ * @traceability DES-C-008 → SampleRateEstimate
+ */
+struct SampleRateEstimate {
+    frequency_validation::PreciseFrequency frequency; ///< Estimated rate (Q32.32 Hz), 0 until valid
+    double frequency_hz;            ///< Estimated rate (Hz), 0.0 until valid
+    double uncertainty_ppb;         ///< One-sigma standard error of the rate (parts per billion)
+    double drift_ppb_per_second;    ///< Smoothed rate of change of the estimate (ppb/s)
+    uint64_t accepted_updates;      ///< Timestamps used by the fit
+    uint64_t rejected_updates;      ///< Timestamps discarded (non-monotonic frames or time)
+
+    /**
+     * @brief Check if the estimate is usable
+     * @return true once at least MIN_UPDATES timestamps have been accepted
+     */
+    bool is_valid() const noexcept {
+        return frequency.q32_32 != 0;
+    }
+};
+
+/**
+ * @brief Streaming least-squares sample-rate estimator
+ * @traceability DES-C-008 → SampleRateEstimator
+ *
+ * Trivially copyable value type (~100 bytes); keep one per stream, e.g. in a
+ * fixed array. The effective averaging window is set in updates: older
+ * timestamps decay with weight (1 - 1/window)^age.
+ *
+ * Usage Example:
+ * @code
+ * SampleRateEstimator estimator;
+ * // In the audio callback:
+ * frames_processed += frames_in_block;
+ * estimator.update(frames_processed, audio->get_sample_clock_ns());
+ * // Periodically:
+ * auto result = estimator.validate(*validator);
+ * @endcode
+ */
+class SampleRateEstimator {
+public:
+    static constexpr uint32_t DEFAULT_WINDOW_UPDATES = 256;  ///< Default effective window
+    static constexpr uint32_t MIN_UPDATES = 3;               ///< Points before an estimate is reported
+
+    /**
+     * @brief Construct an estimator
+     * @param window_updates Effective averaging window in updates (values < 2 use 2)
+     */
+    explicit SampleRateEstimator(uint32_t window_updates = DEFAULT_WINDOW_UPDATES) noexcept;
+
+    /**
+     * @brief Add one (frame position, timestamp) observation
+     * @param frame_position Running frame counter (wraps modulo 2^64)
+     * @param timestamp_ns Sample-clock timestamp of frame_position (ns)
+     * @return true if the observation was used, false if rejected
+     *
+     * @traceability DES-C-008 → update
+     * @performance O(1): ~20 floating-point operations and one division
+     *
+     * Observations whose frame or time delta relative to the previous
+     * accepted observation is zero or negative are rejected and counted.
+     */
+    bool update(uint64_t frame_position, uint64_t timestamp_ns) noexcept;
+
+    /**
+     * @brief Current estimate
+     * @traceability DES-C-008 → estimate
+     */
+    SampleRateEstimate estimate() const noexcept;
+
+    /**
+     * @brief Validate the current estimate against AES5-2018
+     * @param validator Validator to use (records its metrics as usual)
+     * @param tolerance_ppm Tolerance in parts per million
+     * @return Result of validate_frequency(PreciseFrequency); InvalidInput
+     *         while no estimate is available
+     *
+     * @traceability DES-C-008 → validate
+     */
+    frequency_validation::FrequencyValidationResult validate(
+        const frequency_validation::FrequencyValidator& validator,
+        uint32_t tolerance_ppm = frequency_validation::FrequencyValidator::DEFAULT_TOLERANCE_PPM) const noexcept;
+
+    /**
+     * @brief Discard all observations (window size is kept)
+     * @traceability DES-C-008 → reset
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Effective averaging window in updates
+     */
+    uint32_t get_window_updates() const noexcept { return window_updates_; }
+
+private:
+    /// Estimated period in ns per frame, 0.0 until MIN_UPDATES points are in
+    double period_ns() const noexcept;
+
+    uint32_t window_updates_;       ///< Effective window (updates)
+    double decay_;                  ///< Per-update weight decay, 1 - 1/window
+
+    // Last accepted observation; the fit is kept relative to this point
+    uint64_t last_frame_;
+    uint64_t last_timestamp_ns_;
+
+    // Exponentially weighted Welford state (x = frames, y = ns, relative to last point)
+    double weight_;                 ///< Sum of weights
+    double mean_frames_;            ///< Weighted mean of x
+    double mean_ns_;                ///< Weighted mean of y
+    double comoment_ff_;            ///< Weighted sum of (x - mean_x)^2
+    double comoment_fn_;            ///< Weighted sum of (x - mean_x)(y - mean_y)
+    double comoment_nn_;            ///< Weighted sum of (y - mean_y)^2
+
+    // Drift tracking
+    double last_period_ns_;         ///< Period estimate at the previous update (0 = none)
+    double drift_ppb_per_second_;   ///< Smoothed d(rate)/dt
+
+    uint64_t accepted_updates_;
+    uint64_t rejected_updates_;
+};
+
+} // namespace rate_estimation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_RATE_ESTIMATION_SAMPLE_RATE_ESTIMATOR_HPP
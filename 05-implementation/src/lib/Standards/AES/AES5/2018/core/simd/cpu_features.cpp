@@ -0,0 +1,131 @@
+/**
+ * @file cpu_features.cpp
+ * @brief Runtime CPU feature detection implementation
+ * @traceability DES-C-011 → Implementation
+ *
+ * Uses the compiler-provided CPUID helpers where available. Wider kernels are
+ * only reported when the build compiled them (AES5_HAVE_AVX2_KERNELS /
+ * AES5_HAVE_AVX512_KERNELS, set by CMake for x86 targets).
+ */
+
+#include "cpu_features.hpp"
+#include <atomic>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace simd {
+
+namespace {
+
+CpuFeatures detect_cpu_features() noexcept {
+    CpuFeatures features{false, false, false, false, false, false};
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    features.sse2 = __builtin_cpu_supports("sse2");
+    features.sse41 = __builtin_cpu_supports("sse4.1");
+    features.avx2 = __builtin_cpu_supports("avx2");
+    features.avx512f = __builtin_cpu_supports("avx512f");
+    features.avx512bw = __builtin_cpu_supports("avx512bw");
+
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(0x80000000u, &eax, &ebx, &ecx, &edx) && eax >= 0x80000007u &&
+        __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx)) {
+        features.invariant_tsc = (edx & (1u << 8)) != 0;
+    }
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int regs[4] = {0, 0, 0, 0};
+    __cpuid(regs, 0);
+    const int max_leaf = regs[0];
+
+    __cpuid(regs, 1);
+    features.sse2 = (regs[3] & (1 << 26)) != 0;
+    features.sse41 = (regs[2] & (1 << 19)) != 0;
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    const bool os_avx = (xcr0 & 0x6) == 0x6;        // XMM + YMM state
+    const bool os_avx512 = (xcr0 & 0xE6) == 0xE6;   // + opmask/ZMM state
+
+    if (max_leaf >= 7) {
+        __cpuidex(regs, 7, 0);
+        features.avx2 = os_avx && (regs[1] & (1 << 5)) != 0;
+        features.avx512f = os_avx512 && (regs[1] & (1 << 16)) != 0;
+        features.avx512bw = os_avx512 && (regs[1] & (1 << 30)) != 0;
+    }
+
+    __cpuid(regs, 0x80000000);
+    if (static_cast<unsigned>(regs[0]) >= 0x80000007u) {
+        __cpuid(regs, 0x80000007);
+        features.invariant_tsc = (regs[3] & (1 << 8)) != 0;
+    }
+#endif
+
+    return features;
+}
+
+SimdLevel detect_hardware_level() noexcept {
+    const CpuFeatures& features = get_cpu_features();
+#if defined(AES5_HAVE_AVX512_KERNELS)
+    if (features.avx512f && features.avx512bw) {
+        return SimdLevel::AVX512;
+    }
+#endif
+#if defined(AES5_HAVE_AVX2_KERNELS)
+    if (features.avx2) {
+        return SimdLevel::AVX2;
+    }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+    if (features.sse2) {
+        return SimdLevel::SSE2;
+    }
+#endif
+    (void)features;
+    return SimdLevel::Scalar;
+}
+
+std::atomic<uint8_t> max_simd_level{static_cast<uint8_t>(SimdLevel::AVX512)};
+
+} // namespace
+
+const CpuFeatures& get_cpu_features() noexcept {
+    static const CpuFeatures features = detect_cpu_features();
+    return features;
+}
+
+SimdLevel get_active_simd_level() noexcept {
+    static const SimdLevel hardware_level = detect_hardware_level();
+    const uint8_t cap = max_simd_level.load(std::memory_order_relaxed);
+    return (static_cast<uint8_t>(hardware_level) < cap) ? hardware_level
+                                                       : static_cast<SimdLevel>(cap);
+}
+
+void set_max_simd_level(SimdLevel level) noexcept {
+    max_simd_level.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+}
+
+const char* to_string(SimdLevel level) noexcept {
+    switch (level) {
+        case SimdLevel::Scalar: return "Scalar";
+        case SimdLevel::SSE2: return "SSE2";
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::AVX512: return "AVX-512";
+        default: return "Unknown";
+    }
+}
+
+} // namespace simd
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
@@ -0,0 +1,104 @@
+/**
+ * @file cpu_features.hpp
+ * @brief Runtime CPU feature detection for SIMD kernel dispatch
+ * @traceability DES-C-011 → Hardware Detection Engine
+ *
+ * Detects the vector instruction sets available on the executing CPU once and
+ * exposes the best usable SIMD level to batch kernels in the core library.
+ * Kernels compiled for wider instruction sets live in dedicated translation
+ * units and are only entered after this module confirms hardware support.
+ *
+ * Performance Requirements:
+ * - Detection runs once (function-local static), <1μs per query afterwards
+ * - No dynamic allocation
+ *
+ * Thread Safety: All functions are thread-safe
+ * Exception Safety: All functions provide noexcept guarantee
+ */
+
+#ifndef AES_AES5_2018_CORE_SIMD_CPU_FEATURES_HPP
+#define AES_AES5_2018_CORE_SIMD_CPU_FEATURES_HPP
+
+#include <cstdint>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace simd {
+
+/**
+ * @brief SIMD instruction set levels usable by batch kernels (ordered)
+ * @traceability DES-C-011 → SimdLevel
+ */
+enum class SimdLevel : uint8_t {
+    Scalar = 0,     ///< Portable C++ (no vector intrinsics)
+    SSE2 = 1,       ///< x86-64 baseline 128-bit integer/double vectors
+    AVX2 = 2,       ///< 256-bit integer vectors
+    AVX512 = 3      ///< 512-bit vectors (AVX-512F + AVX-512BW)
+};
+
+/**
+ * @brief Instruction set support detected on the executing CPU
+ * @traceability DES-C-011 → CpuFeatures
+ */
+struct CpuFeatures {
+    bool sse2;          ///< SSE2 available
+    bool sse41;         ///< SSE4.1 available
+    bool avx2;          ///< AVX2 available (and enabled by the OS)
+    bool avx512f;       ///< AVX-512 Foundation available (and enabled by the OS)
+    bool avx512bw;      ///< AVX-512 Byte/Word available
+    bool invariant_tsc; ///< Time-stamp counter runs at a constant rate in all states
+};
+
+/**
+ * @brief Get CPU features of the executing processor
+ * @return Reference to features detected on first call
+ *
+ * @traceability DES-C-011 → get_cpu_features
+ *
+ * @exception none (noexcept guarantee)
+ * @thread_safety Thread-safe (detected once)
+ */
+const CpuFeatures& get_cpu_features() noexcept;
+
+/**
+ * @brief Get the SIMD level batch kernels should use
+ * @return Best level supported by both CPU and build, capped by set_max_simd_level()
+ *
+ * @traceability DES-C-011 → get_active_simd_level
+ *
+ * @exception none (noexcept guarantee)
+ * @thread_safety Thread-safe
+ */
+SimdLevel get_active_simd_level() noexcept;
+
+/**
+ * @brief Cap the SIMD level used by batch kernels
+ * @param level Highest level kernels may use (Scalar forces portable code)
+ *
+ * @traceability DES-C-011 → set_max_simd_level
+ *
+ * Intended for benchmarks and tests that compare kernel variants. Requesting
+ * a level above what the hardware supports has no effect beyond the hardware
+ * limit.
+ *
+ * @exception none (noexcept guarantee)
+ * @thread_safety Thread-safe (atomic)
+ */
+void set_max_simd_level(SimdLevel level) noexcept;
+
+/**
+ * @brief Convert SIMD level to string
+ * @param level SIMD level
+ * @return Human-readable level name
+ */
+const char* to_string(SimdLevel level) noexcept;
+
+} // namespace simd
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_SIMD_CPU_FEATURES_HPP
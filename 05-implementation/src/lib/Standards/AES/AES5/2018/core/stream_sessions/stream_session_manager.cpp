@@ -0,0 +1,181 @@
+/**
+ * @file stream_session_manager.cpp
+ * @brief Multi-stream sampling frequency session manager implementation
+ * @traceability DES-C-001, DES-C-003 → StreamSessionManager
+ */
+
+#include "stream_session_manager.hpp"
+#include <new>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace stream_sessions {
+
+std::unique_ptr<StreamSessionManager> StreamSessionManager::create(
+    std::unique_ptr<frequency_validation::FrequencyValidator> validator,
+    std::unique_ptr<rate_categories::RateCategoryManager> rate_categories,
+    size_t max_streams) noexcept {
+
+    if (!validator || !rate_categories || max_streams == 0 || max_streams >= INVALID_STREAM_ID) {
+        return nullptr;
+    }
+
+    std::unique_ptr<StreamSessionManager> manager(new (std::nothrow) StreamSessionManager(
+        std::move(validator), std::move(rate_categories), max_streams));
+    if (!manager || !manager->allocate()) {
+        return nullptr;
+    }
+    return manager;
+}
+
+StreamSessionManager::StreamSessionManager(
+    std::unique_ptr<frequency_validation::FrequencyValidator> validator,
+    std::unique_ptr<rate_categories::RateCategoryManager> rate_categories,
+    size_t capacity) noexcept
+    : validator_(std::move(validator))
+    , rate_categories_(std::move(rate_categories))
+    , capacity_(capacity)
+    , stream_count_(0)
+    , free_id_count_(0) {
+}
+
+bool StreamSessionManager::allocate() noexcept {
+    measured_rate_hz_.reset(new (std::nothrow) uint32_t[capacity_]);
+    closest_standard_frequency_.reset(new (std::nothrow) uint32_t[capacity_]);
+    deviation_ppm_.reset(new (std::nothrow) double[capacity_]);
+    status_.reset(new (std::nothrow) validation::ValidationResult[capacity_]);
+    applicable_clause_.reset(new (std::nothrow) compliance::AES5Clause[capacity_]);
+    category_.reset(new (std::nothrow) rate_categories::RateCategory[capacity_]);
+    stream_id_of_slot_.reset(new (std::nothrow) StreamId[capacity_]);
+    slot_of_stream_id_.reset(new (std::nothrow) uint32_t[capacity_]);
+    free_ids_.reset(new (std::nothrow) StreamId[capacity_]);
+
+    if (!measured_rate_hz_ || !closest_standard_frequency_ || !deviation_ppm_ || !status_ ||
+        !applicable_clause_ || !category_ || !stream_id_of_slot_ || !slot_of_stream_id_ || !free_ids_) {
+        return false;
+    }
+
+    // Lowest ids are handed out first
+    for (size_t i = 0; i < capacity_; ++i) {
+        slot_of_stream_id_[i] = static_cast<uint32_t>(capacity_);
+        free_ids_[i] = static_cast<StreamId>(capacity_ - 1 - i);
+    }
+    free_id_count_ = capacity_;
+    return true;
+}
+
+size_t StreamSessionManager::slot_of(StreamId id) const noexcept {
+    return (id < capacity_) ? slot_of_stream_id_[id] : capacity_;
+}
+
+StreamId StreamSessionManager::add_stream(uint32_t measured_rate_hz) noexcept {
+    if (free_id_count_ == 0) {
+        return INVALID_STREAM_ID;
+    }
+
+    const StreamId id = free_ids_[--free_id_count_];
+    const size_t slot = stream_count_++;
+    slot_of_stream_id_[id] = static_cast<uint32_t>(slot);
+    stream_id_of_slot_[slot] = id;
+
+    // Not evaluated until the next tick()
+    measured_rate_hz_[slot] = measured_rate_hz;
+    closest_standard_frequency_[slot] = 0;
+    deviation_ppm_[slot] = 0.0;
+    status_[slot] = validation::ValidationResult::InvalidInput;
+    applicable_clause_[slot] = compliance::AES5Clause::Unknown;
+    category_[slot] = rate_categories::RateCategory::Unknown;
+    return id;
+}
+
+bool StreamSessionManager::remove_stream(StreamId id) noexcept {
+    const size_t slot = slot_of(id);
+    if (slot >= stream_count_) {
+        return false;
+    }
+
+    // Move the last stream into the hole to keep the arrays dense
+    const size_t last = --stream_count_;
+    if (slot != last) {
+        measured_rate_hz_[slot] = measured_rate_hz_[last];
+        closest_standard_frequency_[slot] = closest_standard_frequency_[last];
+        deviation_ppm_[slot] = deviation_ppm_[last];
+        status_[slot] = status_[last];
+        applicable_clause_[slot] = applicable_clause_[last];
+        category_[slot] = category_[last];
+        const StreamId moved = stream_id_of_slot_[last];
+        stream_id_of_slot_[slot] = moved;
+        slot_of_stream_id_[moved] = static_cast<uint32_t>(slot);
+    }
+
+    slot_of_stream_id_[id] = static_cast<uint32_t>(capacity_);
+    free_ids_[free_id_count_++] = id;
+    return true;
+}
+
+bool StreamSessionManager::set_measured_rate(StreamId id, uint32_t measured_rate_hz) noexcept {
+    const size_t slot = slot_of(id);
+    if (slot >= stream_count_) {
+        return false;
+    }
+    measured_rate_hz_[slot] = measured_rate_hz;
+    return true;
+}
+
+size_t StreamSessionManager::tick(uint32_t tolerance_ppm) noexcept {
+    size_t valid_count = 0;
+
+    // Validate and classify block by block so each block is still cached
+    // when the second kernel reads it
+    for (size_t begin = 0; begin < stream_count_; begin += TICK_BLOCK_STREAMS) {
+        const size_t count = (stream_count_ - begin < TICK_BLOCK_STREAMS) ? stream_count_ - begin
+                                                                          : TICK_BLOCK_STREAMS;
+        const frequency_validation::FrequencyBatchResults results{
+            status_.get() + begin,
+            closest_standard_frequency_.get() + begin,
+            deviation_ppm_.get() + begin,
+            applicable_clause_.get() + begin
+        };
+        valid_count += validator_->validate_frequency_batch(
+            measured_rate_hz_.get() + begin, count, results, tolerance_ppm);
+        rate_categories_->classify_rate_category_batch(
+            measured_rate_hz_.get() + begin, count, category_.get() + begin);
+    }
+
+    return valid_count;
+}
+
+bool StreamSessionManager::get_stream_state(StreamId id, StreamState& state) const noexcept {
+    const size_t slot = slot_of(id);
+    if (slot >= stream_count_) {
+        return false;
+    }
+    state.measured_rate_hz = measured_rate_hz_[slot];
+    state.closest_standard_frequency = closest_standard_frequency_[slot];
+    state.deviation_ppm = deviation_ppm_[slot];
+    state.status = status_[slot];
+    state.applicable_clause = applicable_clause_[slot];
+    state.category = category_[slot];
+    return true;
+}
+
+StreamSessionView StreamSessionManager::view() const noexcept {
+    return StreamSessionView{
+        stream_count_,
+        stream_id_of_slot_.get(),
+        measured_rate_hz_.get(),
+        closest_standard_frequency_.get(),
+        deviation_ppm_.get(),
+        status_.get(),
+        applicable_clause_.get(),
+        category_.get()
+    };
+}
+
+} // namespace stream_sessions
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
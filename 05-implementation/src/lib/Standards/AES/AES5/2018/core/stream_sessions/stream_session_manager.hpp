@@ -0,0 +1,196 @@
+/**
+ * @file stream_session_manager.hpp
+ * @brief Multi-stream sampling frequency session manager (structure-of-arrays)
+ * @traceability DES-C-001, DES-C-003 → StreamSessionManager
+ *
+ * Monitors thousands of streams with one FrequencyValidator and one
+ * RateCategoryManager instead of one validator (and two heap-allocated
+ * dependencies) per stream. Per-stream state lives in dense parallel arrays
+ * that tick() sweeps block by block with the batch kernels of both
+ * components, so each block stays cache-resident between validation and
+ * classification.
+ *
+ * Stream ids are stable for the lifetime of a stream; removing a stream moves
+ * the last stream into its slot so the arrays stay dense.
+ *
+ * @performance tick(): O(streams), batch SIMD validation + table classification,
+ *              metrics recorded once per block. All storage is allocated by
+ *              create(); no allocation afterwards.
+ * @thread_safety Not thread-safe: add/remove/update/tick must be serialized
+ *                by the caller (typically one monitoring thread)
+ * @exception none (noexcept guarantee)
+ */
+
+#ifndef AES_AES5_2018_CORE_STREAM_SESSIONS_STREAM_SESSION_MANAGER_HPP
+#define AES_AES5_2018_CORE_STREAM_SESSIONS_STREAM_SESSION_MANAGER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "../frequency_validation/frequency_validator.hpp"
+#include "../rate_categories/rate_category_manager.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace stream_sessions {
+
+/// Stable stream identifier
+using StreamId = uint32_t;
+
+/// Returned by add_stream() when the manager is full
+constexpr StreamId INVALID_STREAM_ID = UINT32_MAX;
+
+/**
+ * @brief Per-stream state snapshot
+ * @traceability DES-C-001, DES-C-003 → StreamState
+ */
+struct StreamState {
+    uint32_t measured_rate_hz;                 ///< Last measured rate (0 = none yet)
+    uint32_t closest_standard_frequency;       ///< Nearest AES5-2018 standard frequency
+    double deviation_ppm;                      ///< Deviation from closest standard (ppm)
+    validation::ValidationResult status;       ///< Status at the last tick
+    compliance::AES5Clause applicable_clause;  ///< Applicable AES5-2018 clause
+    rate_categories::RateCategory category;    ///< AES5-2018 Section 5.3 rate category
+};
+
+/**
+ * @brief Read-only structure-of-arrays view of all streams (slot order)
+ * @traceability DES-C-001, DES-C-003 → StreamSessionView
+ *
+ * Valid until the next add_stream() / remove_stream().
+ */
+struct StreamSessionView {
+    size_t count;                                       ///< Active streams
+    const StreamId* stream_ids;                         ///< Stream id per slot
+    const uint32_t* measured_rate_hz;
+    const uint32_t* closest_standard_frequency;
+    const double* deviation_ppm;
+    const validation::ValidationResult* status;
+    const compliance::AES5Clause* applicable_clause;
+    const rate_categories::RateCategory* category;
+};
+
+/**
+ * @brief Structure-of-arrays session manager for many concurrent streams
+ * @traceability DES-C-001, DES-C-003 → StreamSessionManager
+ *
+ * Usage Example:
+ * @code
+ * auto sessions = StreamSessionManager::create(std::move(validator), std::move(categories), 100000);
+ * StreamId id = sessions->add_stream();
+ * sessions->set_measured_rate(id, 48001);
+ * size_t valid = sessions->tick();          // once per monitoring period
+ * StreamState state;
+ * sessions->get_stream_state(id, state);
+ * @endcode
+ */
+class StreamSessionManager {
+public:
+    /// Streams processed per block in tick() (working set fits in L1/L2)
+    static constexpr size_t TICK_BLOCK_STREAMS = 1024;
+
+    /**
+     * @brief Create a session manager with fixed capacity
+     * @param validator Frequency validator used for every stream
+     * @param rate_categories Rate category manager used for every stream
+     * @param max_streams Maximum concurrent streams (> 0, < INVALID_STREAM_ID)
+     * @return Manager, or nullptr on invalid arguments or allocation failure
+     * @traceability DES-C-001, DES-C-003 → create
+     */
+    static std::unique_ptr<StreamSessionManager> create(
+        std::unique_ptr<frequency_validation::FrequencyValidator> validator,
+        std::unique_ptr<rate_categories::RateCategoryManager> rate_categories,
+        size_t max_streams) noexcept;
+
+    StreamSessionManager(const StreamSessionManager&) = delete;
+    StreamSessionManager& operator=(const StreamSessionManager&) = delete;
+    ~StreamSessionManager() noexcept = default;
+
+    /**
+     * @brief Register a stream
+     * @param measured_rate_hz Initial measured rate (0 = not yet measured)
+     * @return Stream id, or INVALID_STREAM_ID if the manager is full
+     */
+    StreamId add_stream(uint32_t measured_rate_hz = 0) noexcept;
+
+    /**
+     * @brief Unregister a stream (its id may be reused)
+     * @return false if id is not an active stream
+     */
+    bool remove_stream(StreamId id) noexcept;
+
+    /**
+     * @brief Store a new measured rate; evaluated at the next tick()
+     * @return false if id is not an active stream
+     */
+    bool set_measured_rate(StreamId id, uint32_t measured_rate_hz) noexcept;
+
+    /**
+     * @brief Validate and classify every stream in one pass
+     * @param tolerance_ppm Tolerance applied to every stream
+     * @return Number of streams that validated successfully
+     * @traceability DES-C-001, DES-C-003 → tick
+     *
+     * Results match FrequencyValidator::validate_frequency() and
+     * RateCategoryManager::classify_rate_category() per stream.
+     */
+    size_t tick(uint32_t tolerance_ppm = frequency_validation::FrequencyValidator::DEFAULT_TOLERANCE_PPM) noexcept;
+
+    /**
+     * @brief Copy the state of one stream
+     * @return false if id is not an active stream
+     */
+    bool get_stream_state(StreamId id, StreamState& state) const noexcept;
+
+    /**
+     * @brief Structure-of-arrays view over all active streams
+     */
+    StreamSessionView view() const noexcept;
+
+    size_t stream_count() const noexcept { return stream_count_; }
+    size_t capacity() const noexcept { return capacity_; }
+
+    const frequency_validation::FrequencyValidator& get_validator() const noexcept { return *validator_; }
+    const rate_categories::RateCategoryManager& get_rate_category_manager() const noexcept { return *rate_categories_; }
+
+private:
+    StreamSessionManager(std::unique_ptr<frequency_validation::FrequencyValidator> validator,
+                         std::unique_ptr<rate_categories::RateCategoryManager> rate_categories,
+                         size_t capacity) noexcept;
+
+    /// Allocate all arrays; false on failure
+    bool allocate() noexcept;
+
+    /// Slot of an active stream, or capacity_ if inactive
+    size_t slot_of(StreamId id) const noexcept;
+
+    std::unique_ptr<frequency_validation::FrequencyValidator> validator_;
+    std::unique_ptr<rate_categories::RateCategoryManager> rate_categories_;
+    size_t capacity_;
+    size_t stream_count_;
+
+    // Per-slot state (dense, [0, stream_count_))
+    std::unique_ptr<uint32_t[]> measured_rate_hz_;
+    std::unique_ptr<uint32_t[]> closest_standard_frequency_;
+    std::unique_ptr<double[]> deviation_ppm_;
+    std::unique_ptr<validation::ValidationResult[]> status_;
+    std::unique_ptr<compliance::AES5Clause[]> applicable_clause_;
+    std::unique_ptr<rate_categories::RateCategory[]> category_;
+    std::unique_ptr<StreamId[]> stream_id_of_slot_;
+
+    // Id management
+    std::unique_ptr<uint32_t[]> slot_of_stream_id_;   ///< Slot per id, capacity_ when free
+    std::unique_ptr<StreamId[]> free_ids_;            ///< Stack of free ids
+    size_t free_id_count_;
+};
+
+} // namespace stream_sessions
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_STREAM_SESSIONS_STREAM_SESSION_MANAGER_HPP
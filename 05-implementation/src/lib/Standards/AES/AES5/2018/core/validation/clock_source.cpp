@@ -0,0 +1,108 @@
+/**
+ * @file clock_source.cpp
+ * @brief Cycle counter detection and calibration
+ * @traceability DES-C-005, DES-C-007 → ClockSource
+ */
+
+#include "clock_source.hpp"
+#include "../simd/cpu_features.hpp"
+
+#include <atomic>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+namespace {
+
+/// Calibration window against steady_clock
+constexpr uint64_t CALIBRATION_NS = 5000000;
+
+/// calibrated_ns_per_tick value before calibration has completed
+constexpr uint64_t NOT_CALIBRATED = UINT64_MAX;
+
+/// Result of calibrate_cycle_counter(), published once for automatic()
+std::atomic<uint64_t> calibrated_ns_per_tick{NOT_CALIBRATED};
+
+/// Nanoseconds per tick in Q32.32, 0 if the cycle counter is unusable
+uint64_t calibrate_cycle_counter() noexcept {
+    if (!detail::HAVE_CYCLE_COUNTER) {
+        return 0;
+    }
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    // A TSC that stops or changes rate with power states cannot time latency
+    if (!simd::get_cpu_features().invariant_tsc) {
+        return 0;
+    }
+#endif
+
+    const uint64_t start_ns = detail::steady_now_ns();
+    const uint64_t start_ticks = detail::read_cycle_counter();
+    uint64_t end_ns = start_ns;
+    while (end_ns - start_ns < CALIBRATION_NS) {
+        end_ns = detail::steady_now_ns();
+    }
+    const uint64_t end_ticks = detail::read_cycle_counter();
+
+    const uint64_t ticks = end_ticks - start_ticks;
+    if (end_ticks <= start_ticks || ticks < 1000) {
+        return 0;   // Counter not advancing (or too coarse to be useful)
+    }
+    return ((end_ns - start_ns) << 32) / ticks;
+}
+
+/// Calibrate once per process; concurrent first callers block on the static
+uint64_t calibrated_cycle_counter() noexcept {
+    static const uint64_t ns_per_tick_q32 = [] {
+        const uint64_t value = calibrate_cycle_counter();
+        calibrated_ns_per_tick.store(value, std::memory_order_release);
+        return value;
+    }();
+    return ns_per_tick_q32;
+}
+
+} // namespace
+
+bool ClockSource::calibrate() noexcept {
+    return calibrated_cycle_counter() != 0;
+}
+
+ClockSource ClockSource::cycle_counter() noexcept {
+    const uint64_t ns_per_tick_q32 = calibrated_cycle_counter();
+
+    ClockSource source;
+    if (ns_per_tick_q32 != 0) {
+        source.kind_ = ClockSourceKind::CycleCounter;
+        source.ns_per_tick_q32_ = ns_per_tick_q32;
+    }
+    return source;
+}
+
+ClockSource ClockSource::automatic() noexcept {
+    const uint64_t ns_per_tick_q32 = calibrated_ns_per_tick.load(std::memory_order_acquire);
+
+    ClockSource source;
+    if (ns_per_tick_q32 != NOT_CALIBRATED && ns_per_tick_q32 != 0) {
+        source.kind_ = ClockSourceKind::CycleCounter;
+        source.ns_per_tick_q32_ = ns_per_tick_q32;
+    }
+    return source;
+}
+
+ClockSource ClockSource::injected(ClockFunction function, void* context) noexcept {
+    ClockSource source;
+    if (function != nullptr) {
+        source.kind_ = ClockSourceKind::Injected;
+        source.function_ = function;
+        source.context_ = context;
+    }
+    return source;
+}
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
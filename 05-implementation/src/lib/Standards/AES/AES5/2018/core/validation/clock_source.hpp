@@ -0,0 +1,192 @@
+/**
+ * @file clock_source.hpp
+ * @brief Pluggable low-overhead timestamp source for latency metrics
+ * @traceability DES-C-005, DES-C-007 → ClockSource
+ *
+ * Latency measurement in ValidationCore (and the components timing through
+ * it) reads timestamps as raw ticks and converts only the difference to
+ * nanoseconds. Three sources are available:
+ * - CycleCounter: invariant TSC (x86) or generic timer (AArch64), calibrated
+ *   against steady_clock once per process by ClockSource::calibrate()
+ * - SteadyClock: std::chrono::steady_clock
+ * - Injected: caller-supplied function returning nanoseconds (tests, PTP, ...)
+ *
+ * Requesting the cycle counter on a CPU without an invariant counter falls
+ * back to SteadyClock; kind() reports the source actually used. Calibration
+ * busy-waits ~5 ms, so it only runs on an explicit calibrate() or
+ * cycle_counter() call; automatic() (the ValidationCore default) never
+ * blocks and returns SteadyClock until calibration has completed.
+ *
+ * @performance CycleCounter: one unserialized counter read per timestamp,
+ *              delta conversion is a multiply and shift (no division).
+ *              Measured ~16.5 ns per start/elapsed pair on the reference
+ *              x86-64 host (clock_source_benchmark), which misses the
+ *              <10 ns per measurement goal; SteadyClock is ~2.5x that.
+ * @thread_safety ClockSource is an immutable value; reads are thread-safe
+ * @exception none (noexcept guarantee)
+ */
+
+#ifndef AES_AES5_2018_CORE_VALIDATION_CLOCK_SOURCE_HPP
+#define AES_AES5_2018_CORE_VALIDATION_CLOCK_SOURCE_HPP
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+/**
+ * @brief Timestamp source actually used by a ClockSource
+ * @traceability DES-C-005, DES-C-007 → ClockSourceKind
+ */
+enum class ClockSourceKind : uint8_t {
+    SteadyClock = 0,    ///< std::chrono::steady_clock
+    CycleCounter = 1,   ///< Calibrated invariant TSC / generic timer
+    Injected = 2        ///< Caller-supplied clock function
+};
+
+/**
+ * @brief Caller-supplied clock
+ * @param context Context passed to ClockSource::injected()
+ * @return Monotonic time in nanoseconds (arbitrary epoch)
+ */
+using ClockFunction = uint64_t (*)(void* context) noexcept;
+
+namespace detail {
+
+/// True if this build can read a hardware cycle counter
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86) || defined(__aarch64__)
+constexpr bool HAVE_CYCLE_COUNTER = true;
+#else
+constexpr bool HAVE_CYCLE_COUNTER = false;
+#endif
+
+/// Raw hardware counter (0 where unavailable)
+inline uint64_t read_cycle_counter() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return 0;
+#endif
+}
+
+inline uint64_t steady_now_ns() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace detail
+
+/**
+ * @brief Timestamp source with tick/nanosecond conversion
+ * @traceability DES-C-005, DES-C-007 → ClockSource
+ *
+ * Usage Example:
+ * @code
+ * const ClockSource& clock = core.get_clock_source();
+ * uint64_t start = clock.now_ticks();
+ * do_work();
+ * uint64_t elapsed_ns = clock.elapsed_ns(start);
+ * @endcode
+ */
+class ClockSource {
+public:
+    /// Default: steady_clock
+    constexpr ClockSource() noexcept
+        : kind_(ClockSourceKind::SteadyClock), ns_per_tick_q32_(1ULL << 32), function_(nullptr), context_(nullptr) {}
+
+    /// std::chrono::steady_clock
+    static ClockSource steady() noexcept { return ClockSource(); }
+
+    /**
+     * @brief Calibrate the cycle counter against steady_clock
+     * @return True if the cycle counter is usable
+     * @traceability DES-C-005, DES-C-007 → calibrate
+     *
+     * Busy-waits ~5 ms on the first call (concurrent callers wait for it);
+     * later calls return immediately. Call during start-up, outside any
+     * real-time path, so that automatic() selects the cycle counter.
+     */
+    static bool calibrate() noexcept;
+
+    /**
+     * @brief Calibrated cycle counter, or steady_clock if not invariant/available
+     * @traceability DES-C-005, DES-C-007 → cycle_counter
+     *
+     * Calibrates on first use (see calibrate()).
+     */
+    static ClockSource cycle_counter() noexcept;
+
+    /**
+     * @brief Caller-supplied clock (steady_clock if function is null)
+     * @param function Returns nanoseconds; must be thread-safe if the owning
+     *        ValidationCore is shared
+     * @param context Forwarded to function
+     */
+    static ClockSource injected(ClockFunction function, void* context = nullptr) noexcept;
+
+    /**
+     * @brief Lowest-overhead source available without blocking
+     * @return Cycle counter once calibrate() has completed, steady_clock before
+     * @traceability DES-C-005, DES-C-007 → automatic
+     */
+    static ClockSource automatic() noexcept;
+
+    ClockSourceKind kind() const noexcept { return kind_; }
+
+    /// Counter frequency in Hz (1e9 for nanosecond sources)
+    double tick_frequency_hz() const noexcept {
+        return 1e9 * 4294967296.0 / static_cast<double>(ns_per_tick_q32_);
+    }
+
+    /// Raw timestamp in source ticks
+    uint64_t now_ticks() const noexcept {
+        switch (kind_) {
+            case ClockSourceKind::CycleCounter: return detail::read_cycle_counter();
+            case ClockSourceKind::Injected: return function_(context_);
+            default: return detail::steady_now_ns();
+        }
+    }
+
+    /// Convert a tick difference to nanoseconds
+    uint64_t ticks_to_ns(uint64_t ticks) const noexcept {
+        if (kind_ != ClockSourceKind::CycleCounter) {
+            return ticks;
+        }
+        // 64x32.32 fixed-point multiply without 128-bit arithmetic
+        return (ticks >> 32) * ns_per_tick_q32_ + (((ticks & 0xFFFFFFFFULL) * ns_per_tick_q32_) >> 32);
+    }
+
+    /// Nanoseconds elapsed since start_ticks (from now_ticks())
+    uint64_t elapsed_ns(uint64_t start_ticks) const noexcept { return ticks_to_ns(now_ticks() - start_ticks); }
+
+    /// Current time in nanoseconds (source-specific epoch)
+    uint64_t now_ns() const noexcept { return ticks_to_ns(now_ticks()); }
+
+private:
+    ClockSourceKind kind_;
+    uint64_t ns_per_tick_q32_;     ///< Nanoseconds per tick, Q32.32
+    ClockFunction function_;
+    void* context_;
+};
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_VALIDATION_CLOCK_SOURCE_HPP
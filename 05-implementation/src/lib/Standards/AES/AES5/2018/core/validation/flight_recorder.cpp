@@ -0,0 +1,152 @@
+/**
+ * @file flight_recorder.cpp
+ * @brief Flight recorder snapshots and binary dump format
+ * @traceability DES-C-005 → FlightRecorder
+ */
+
+#include "flight_recorder.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+namespace {
+
+/// On-disk event record: the four slot words
+struct FlightRecordEntry {
+    uint64_t sequence;
+    uint64_t timestamp_ticks;
+    uint64_t frequencies;
+    uint64_t outcome;
+};
+
+static_assert(sizeof(FlightRecordEntry) == 32, "compact 32-byte records");
+
+} // namespace
+
+FlightEvent FlightRecorder::unpack(uint64_t sequence, uint64_t timestamp_ticks,
+                                   uint64_t frequencies, uint64_t outcome) noexcept {
+    FlightEvent event;
+    event.sequence = sequence;
+    event.timestamp_ticks = timestamp_ticks;
+    event.frequency_hz = static_cast<uint32_t>(frequencies);
+    event.closest_standard_hz = static_cast<uint32_t>(frequencies >> 32);
+    event.deviation_ppb = static_cast<int32_t>(static_cast<uint32_t>(outcome));
+    event.latency_ns = static_cast<uint32_t>(outcome >> 40);
+    event.result = static_cast<ValidationResult>(static_cast<uint8_t>(outcome >> 32));
+    return event;
+}
+
+size_t FlightRecorder::snapshot(FlightEvent* out, size_t max_events) const noexcept {
+    if (out == nullptr || max_events == 0) {
+        return 0;
+    }
+
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    const uint64_t retained = head < capacity() ? head : capacity();
+    const uint64_t wanted = retained < max_events ? retained : max_events;
+
+    size_t written = 0;
+    for (uint64_t position = head - wanted; position < head; ++position) {
+        const Slot& slot = slots_[position & mask_];
+        const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const uint64_t timestamp_ticks = slot.timestamp_ticks.load(std::memory_order_relaxed);
+        const uint64_t frequencies = slot.frequencies.load(std::memory_order_relaxed);
+        const uint64_t outcome = slot.outcome.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // Skip slots still being written, or already overwritten by a newer lap
+        if (sequence != position + 1 || slot.sequence.load(std::memory_order_relaxed) != sequence) {
+            continue;
+        }
+        out[written++] = unpack(sequence, timestamp_ticks, frequencies, outcome);
+    }
+    return written;
+}
+
+bool FlightRecorder::dump(const char* path, const ClockSource& clock) const noexcept {
+    if (path == nullptr) {
+        return false;
+    }
+
+    std::unique_ptr<FlightEvent[]> events(new (std::nothrow) FlightEvent[capacity()]);
+    if (!events) {
+        return false;
+    }
+    const size_t count = snapshot(events.get(), capacity());
+
+    FlightRecordHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, FLIGHT_RECORD_MAGIC, sizeof(header.magic));
+    header.version = FLIGHT_RECORD_VERSION;
+    header.record_size = sizeof(FlightRecordEntry);
+    header.event_count = count;
+    header.tick_frequency_hz = clock.tick_frequency_hz();
+    header.clock_kind = static_cast<uint32_t>(clock.kind());
+    header.frozen = is_frozen() ? 1 : 0;
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    for (size_t i = 0; ok && i < count; ++i) {
+        const FlightEvent& event = events[i];
+        const FlightRecordEntry entry{
+            event.sequence,
+            event.timestamp_ticks,
+            static_cast<uint64_t>(event.frequency_hz) | (static_cast<uint64_t>(event.closest_standard_hz) << 32),
+            pack_outcome(event.deviation_ppb, event.latency_ns, event.result)};
+        ok = std::fwrite(&entry, sizeof(entry), 1, file) == 1;
+    }
+    return (std::fclose(file) == 0) && ok;
+}
+
+size_t FlightRecorder::read_dump(const char* path, FlightRecordHeader* header,
+                                 FlightEvent* out, size_t max_events) noexcept {
+    if (path == nullptr) {
+        return 0;
+    }
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr) {
+        return 0;
+    }
+
+    FlightRecordHeader file_header;
+    size_t read = 0;
+    if (std::fread(&file_header, sizeof(file_header), 1, file) == 1 &&
+        std::memcmp(file_header.magic, FLIGHT_RECORD_MAGIC, sizeof(file_header.magic)) == 0 &&
+        file_header.version == FLIGHT_RECORD_VERSION &&
+        file_header.record_size == sizeof(FlightRecordEntry)) {
+        if (header != nullptr) {
+            *header = file_header;
+        }
+        FlightRecordEntry entry;
+        while (out != nullptr && read < max_events && read < file_header.event_count &&
+               std::fread(&entry, sizeof(entry), 1, file) == 1) {
+            out[read++] = unpack(entry.sequence, entry.timestamp_ticks, entry.frequencies, entry.outcome);
+        }
+    }
+    std::fclose(file);
+    return read;
+}
+
+void FlightRecorder::clear() noexcept {
+    for (size_t i = 0; i < capacity(); ++i) {
+        slots_[i].sequence.store(0, std::memory_order_relaxed);
+    }
+    head_.store(0, std::memory_order_release);
+}
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
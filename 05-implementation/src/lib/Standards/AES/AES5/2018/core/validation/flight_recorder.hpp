@@ -0,0 +1,261 @@
+/**
+ * @file flight_recorder.hpp
+ * @brief Ring buffer of the most recent validation events for post-mortem analysis
+ * @traceability DES-C-005 → FlightRecorder
+ *
+ * Aggregate counters tell that a stream failed, not what it looked like
+ * just before. A FlightRecorder keeps the last capacity() events (input
+ * frequency, closest standard rate, deviation, result, latency and the
+ * ClockSource timestamp), overwriting the oldest. It can be frozen on
+ * demand or automatically by the first failed validation, then dumped to
+ * a compact binary file off the real-time path.
+ *
+ * Like LatencyHistogram this is caller-owned storage (static or member
+ * allocation per ADR-002): declare a FlightRecorderStorage<N> and attach
+ * it with ValidationCore::attach_flight_recorder(). FrequencyValidator
+ * records every single-frequency validation while one is attached,
+ * including InvalidInput results; batch validations
+ * (validate_frequency_batch()) are not recorded.
+ *
+ * @performance record(): one relaxed fetch_add plus four relaxed stores to
+ *              one 32-byte slot; no clock read of its own (timed validations
+ *              reuse the timing policy's timestamps, untimed ones cost one
+ *              clock read while a recorder is attached)
+ * @thread_safety record() is wait-free and may run on audio threads from
+ *                several writers. Snapshots skip slots being written.
+ *                Validations already in progress when freeze() takes effect
+ *                may still add their event.
+ * @exception none (noexcept guarantee)
+ */
+
+#ifndef AES_AES5_2018_CORE_VALIDATION_FLIGHT_RECORDER_HPP
+#define AES_AES5_2018_CORE_VALIDATION_FLIGHT_RECORDER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "clock_source.hpp"
+#include "validation_result.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+/**
+ * @brief One recorded validation
+ * @traceability DES-C-005 → FlightEvent
+ */
+struct FlightEvent {
+    uint64_t sequence;              ///< 1-based position in the recording (gaps = overwritten/in-flight)
+    uint64_t timestamp_ticks;       ///< ClockSource ticks: start if timed, completion if untimed (never 0)
+    uint32_t frequency_hz;          ///< Input frequency
+    uint32_t closest_standard_hz;   ///< Nearest AES5-2018 rate
+    int32_t deviation_ppb;          ///< Deviation from closest_standard_hz, saturated to int32
+    uint32_t latency_ns;            ///< Saturated to FlightRecorder::MAX_LATENCY_NS, 0 if untimed
+    ValidationResult result;
+
+    /// Deviation in parts per million
+    double deviation_ppm() const noexcept { return static_cast<double>(deviation_ppb) / 1000.0; }
+};
+
+/**
+ * @brief Header of a FlightRecorder::dump() file (host byte order)
+ * @traceability DES-C-005 → FlightRecordHeader
+ *
+ * Followed by event_count records of four uint64_t words: sequence,
+ * timestamp_ticks, frequency_hz | closest_standard_hz << 32, and
+ * uint32(deviation_ppb) | (latency_ns << 8 | result) << 32.
+ */
+struct FlightRecordHeader {
+    char magic[8];                  ///< FLIGHT_RECORD_MAGIC
+    uint32_t version;               ///< FLIGHT_RECORD_VERSION
+    uint32_t record_size;           ///< Bytes per event record (32)
+    uint64_t event_count;
+    double tick_frequency_hz;       ///< Of the ClockSource that produced timestamp_ticks
+    uint32_t clock_kind;            ///< ClockSourceKind
+    uint32_t frozen;                ///< 1 if the recorder was frozen when dumped
+};
+
+constexpr char FLIGHT_RECORD_MAGIC[8] = {'A', 'E', 'S', '5', 'F', 'L', 'T', 'R'};
+constexpr uint32_t FLIGHT_RECORD_VERSION = 1;
+
+/**
+ * @brief Wait-free overwrite-oldest event ring
+ * @traceability DES-C-005 → FlightRecorder
+ *
+ * Usage Example:
+ * @code
+ * static FlightRecorderStorage<4096> recorder;
+ * recorder.set_freeze_on_failure(true);
+ * auto core = std::make_unique<ValidationCore>();
+ * const ClockSource clock = core->get_clock_source();
+ * core->attach_flight_recorder(&recorder);
+ * auto validator = FrequencyValidator::create(std::move(engine), std::move(core));
+ * ...
+ * if (recorder.is_frozen()) {                 // from a housekeeping thread
+ *     recorder.dump("/var/tmp/aes5_failure.bin", clock);
+ * }
+ * @endcode
+ */
+class FlightRecorder {
+public:
+    /// Largest latency representable in an event (24 bits)
+    static constexpr uint32_t MAX_LATENCY_NS = (1u << 24) - 1;
+
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /**
+     * @brief Record one validation, overwriting the oldest event when full
+     * @param frequency_hz Input frequency
+     * @param closest_standard_hz Nearest standard rate
+     * @param deviation_ppb Signed deviation in ppb
+     * @param result Validator outcome
+     * @param latency_ns Measured latency, 0 if untimed
+     * @param timestamp_ticks ClockSource ticks: validation start if timed,
+     *        completion if untimed (FrequencyValidator never passes 0)
+     * @traceability DES-C-005 → FlightRecorder::record
+     *
+     * Dropped while frozen. A failed result freezes the recorder after
+     * recording when set_freeze_on_failure(true) is set.
+     */
+    void record(uint32_t frequency_hz, uint32_t closest_standard_hz, int64_t deviation_ppb,
+                ValidationResult result, uint64_t latency_ns, uint64_t timestamp_ticks) noexcept {
+        if (frozen_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        const uint64_t position = head_.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots_[position & mask_];
+
+        slot.sequence.store(0, std::memory_order_relaxed);   // Mark in-flight for snapshots
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.timestamp_ticks.store(timestamp_ticks, std::memory_order_relaxed);
+        slot.frequencies.store(static_cast<uint64_t>(frequency_hz) |
+                               (static_cast<uint64_t>(closest_standard_hz) << 32), std::memory_order_relaxed);
+        slot.outcome.store(pack_outcome(deviation_ppb, latency_ns, result), std::memory_order_relaxed);
+        slot.sequence.store(position + 1, std::memory_order_release);
+
+        if (static_cast<uint8_t>(result) != 0 && freeze_on_failure_.load(std::memory_order_relaxed)) {
+            frozen_.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    /// Stop recording; the ring keeps its current contents
+    void freeze() noexcept { frozen_.store(true, std::memory_order_relaxed); }
+
+    /// Resume recording after freeze() or an automatic freeze
+    void resume() noexcept { frozen_.store(false, std::memory_order_relaxed); }
+
+    bool is_frozen() const noexcept { return frozen_.load(std::memory_order_relaxed); }
+
+    /// Freeze automatically after recording the first non-Valid result
+    void set_freeze_on_failure(bool enabled) noexcept {
+        freeze_on_failure_.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool get_freeze_on_failure() const noexcept { return freeze_on_failure_.load(std::memory_order_relaxed); }
+
+    /// Ring size in events
+    size_t capacity() const noexcept { return mask_ + 1; }
+
+    /// Events recorded since construction or clear(), including overwritten ones
+    uint64_t total_recorded() const noexcept { return head_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Copy the retained events, oldest first
+     * @param out Destination array
+     * @param max_events Capacity of out; the newest max_events are copied
+     * @return Number of events written
+     * @traceability DES-C-005 → FlightRecorder::snapshot
+     */
+    size_t snapshot(FlightEvent* out, size_t max_events) const noexcept;
+
+    /**
+     * @brief Write the retained events to a binary file
+     * @param path Destination file (replaced)
+     * @param clock ClockSource of the recording core, stored for tick conversion
+     * @return false if the file cannot be written
+     * @traceability DES-C-005 → FlightRecorder::dump
+     *
+     * Not real-time safe (file I/O and a capacity()-sized temporary). Freeze
+     * first for a stable picture; dumping a live ring captures whatever is
+     * retained at the time.
+     */
+    bool dump(const char* path, const ClockSource& clock) const noexcept;
+
+    /**
+     * @brief Read a file written by dump()
+     * @param path File to read
+     * @param header Receives the file header (may be nullptr)
+     * @param out Destination array
+     * @param max_events Capacity of out; the first max_events are read
+     * @return Events read, 0 if the file is missing or not a version-compatible dump
+     */
+    static size_t read_dump(const char* path, FlightRecordHeader* header,
+                            FlightEvent* out, size_t max_events) noexcept;
+
+    /// Discard all events; not concurrently with record()
+    void clear() noexcept;
+
+protected:
+    /// One event; all fields atomic so snapshots may race writers
+    struct alignas(32) Slot {
+        std::atomic<uint64_t> sequence{0};          ///< position + 1, 0 while written
+        std::atomic<uint64_t> timestamp_ticks{0};
+        std::atomic<uint64_t> frequencies{0};       ///< frequency | closest << 32
+        std::atomic<uint64_t> outcome{0};           ///< uint32(deviation) | (latency << 8 | result) << 32
+    };
+
+    /// @param slots Storage of capacity slots; capacity must be a power of two
+    FlightRecorder(Slot* slots, size_t capacity) noexcept
+        : slots_(slots)
+        , mask_(capacity - 1) {
+    }
+
+    ~FlightRecorder() = default;
+
+private:
+    static uint64_t pack_outcome(int64_t deviation_ppb, uint64_t latency_ns, ValidationResult result) noexcept {
+        const int32_t deviation = deviation_ppb > INT32_MAX ? INT32_MAX
+                                  : (deviation_ppb < INT32_MIN ? INT32_MIN : static_cast<int32_t>(deviation_ppb));
+        const uint64_t latency = latency_ns > MAX_LATENCY_NS ? MAX_LATENCY_NS : latency_ns;
+        return static_cast<uint64_t>(static_cast<uint32_t>(deviation)) |
+               ((latency << 8 | static_cast<uint8_t>(result)) << 32);
+    }
+
+    static FlightEvent unpack(uint64_t sequence, uint64_t timestamp_ticks,
+                              uint64_t frequencies, uint64_t outcome) noexcept;
+
+    Slot* slots_;
+    size_t mask_;
+    std::atomic<uint64_t> head_{0};                 ///< Next position to write
+    std::atomic<bool> frozen_{false};
+    std::atomic<bool> freeze_on_failure_{false};
+};
+
+/**
+ * @brief FlightRecorder with inline storage for Capacity events
+ * @tparam Capacity Events retained; power of two
+ * @traceability DES-C-005 → FlightRecorderStorage
+ */
+template<size_t Capacity>
+class FlightRecorderStorage : public FlightRecorder {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    FlightRecorderStorage() noexcept : FlightRecorder(storage_, Capacity) {}
+
+private:
+    Slot storage_[Capacity];
+};
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_VALIDATION_FLIGHT_RECORDER_HPP
@@ -0,0 +1,73 @@
+/**
+ * @file instrumentation.hpp
+ * @brief Compile-time instrumentation level of the core library
+ * @traceability DES-C-005 → InstrumentationLevel
+ *
+ * AES5_INSTRUMENTATION_LEVEL selects which metrics code is compiled into
+ * ValidationCore, FrequencyValidator and RateCategoryManager hot paths. It
+ * is set by the AES5_INSTRUMENTATION_LEVEL CMake cache variable (none,
+ * counters, timing, tracing) as a PUBLIC definition of aes5_standards, so
+ * the library and everything including its headers agree on one level.
+ *
+ * - None: no counters, clock reads or recorders; validations are bare
+ *   lookups. Metrics queries return zeros.
+ * - Counters: total/successful/failed counts only, no clock reads.
+ * - Timing: counts plus latency, histograms, windows and deadlines.
+ * - Tracing (default): Timing plus FlightRecorder events.
+ *
+ * Lower levels keep the full API; attaching a histogram or recorder is
+ * allowed and simply receives nothing.
+ */
+
+#ifndef AES_AES5_2018_CORE_VALIDATION_INSTRUMENTATION_HPP
+#define AES_AES5_2018_CORE_VALIDATION_INSTRUMENTATION_HPP
+
+#include <cstdint>
+
+#ifndef AES5_INSTRUMENTATION_LEVEL
+#define AES5_INSTRUMENTATION_LEVEL 3
+#endif
+
+#if AES5_INSTRUMENTATION_LEVEL < 0 || AES5_INSTRUMENTATION_LEVEL > 3
+#error "AES5_INSTRUMENTATION_LEVEL must be 0 (none), 1 (counters), 2 (timing) or 3 (tracing)"
+#endif
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+/**
+ * @brief Instrumentation compiled into the library
+ * @traceability DES-C-005 → InstrumentationLevel
+ */
+enum class InstrumentationLevel : uint8_t {
+    None = 0,       ///< No metrics
+    Counters = 1,   ///< Validation counts
+    Timing = 2,     ///< Counts and latency
+    Tracing = 3     ///< Counts, latency and flight recorder events
+};
+
+/// Level this translation unit was compiled with
+constexpr InstrumentationLevel INSTRUMENTATION_LEVEL =
+    static_cast<InstrumentationLevel>(AES5_INSTRUMENTATION_LEVEL);
+
+constexpr bool INSTRUMENT_COUNTERS = INSTRUMENTATION_LEVEL >= InstrumentationLevel::Counters;
+constexpr bool INSTRUMENT_TIMING = INSTRUMENTATION_LEVEL >= InstrumentationLevel::Timing;
+constexpr bool INSTRUMENT_TRACING = INSTRUMENTATION_LEVEL >= InstrumentationLevel::Tracing;
+
+/// Level name as used by the CMake option
+constexpr const char* instrumentation_level_name(InstrumentationLevel level) noexcept {
+    return level == InstrumentationLevel::None ? "none"
+         : level == InstrumentationLevel::Counters ? "counters"
+         : level == InstrumentationLevel::Timing ? "timing" : "tracing";
+}
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_VALIDATION_INSTRUMENTATION_HPP
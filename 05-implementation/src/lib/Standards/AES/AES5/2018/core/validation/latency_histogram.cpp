@@ -0,0 +1,77 @@
+/**
+ * @file latency_histogram.cpp
+ * @brief Log-linear latency histogram queries
+ * @traceability DES-C-005 → LatencyHistogram
+ */
+
+#include "latency_histogram.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+// Bucket layout sanity checks (index and bounds must round-trip)
+static_assert(LatencyHistogram::bucket_index(LatencyHistogram::SUB_BUCKET_COUNT - 1) ==
+              LatencyHistogram::SUB_BUCKET_COUNT - 1, "linear region");
+static_assert(LatencyHistogram::bucket_index(LatencyHistogram::MAX_TRACKABLE_NS - 1) ==
+              LatencyHistogram::BUCKET_COUNT - 1, "last bucket");
+static_assert(LatencyHistogram::bucket_lower_bound(LatencyHistogram::bucket_index(1000)) <= 1000 &&
+              LatencyHistogram::bucket_upper_bound(LatencyHistogram::bucket_index(1000)) >= 1000, "bounds");
+
+LatencyHistogram::LatencyHistogram() noexcept {
+    reset();
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) noexcept {
+    if (&other == this) {
+        return;
+    }
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        const uint64_t count = other.buckets_[i].load(std::memory_order_relaxed);
+        if (count != 0) {
+            buckets_[i].fetch_add(count, std::memory_order_relaxed);
+        }
+    }
+}
+
+void LatencyHistogram::reset() noexcept {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+uint64_t LatencyHistogram::total_count() const noexcept {
+    uint64_t total = 0;
+    for (const auto& bucket : buckets_) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t LatencyHistogram::value_at_percentile(double percentile) const noexcept {
+    // Snapshot once so the walk is consistent with the total
+    uint64_t counts[BUCKET_COUNT];
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    return Layout::value_at_percentile(counts, total, percentile);
+}
+
+uint64_t LatencyHistogram::max_value() const noexcept {
+    for (size_t i = BUCKET_COUNT; i-- > 0;) {
+        if (buckets_[i].load(std::memory_order_relaxed) != 0) {
+            return bucket_upper_bound(i);
+        }
+    }
+    return 0;
+}
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
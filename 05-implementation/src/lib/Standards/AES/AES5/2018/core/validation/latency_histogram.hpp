@@ -0,0 +1,219 @@
+/**
+ * @file latency_histogram.hpp
+ * @brief Fixed-memory log-linear latency histogram (HDR-style)
+ * @traceability DES-C-005 → LatencyHistogram
+ *
+ * Values below SUB_BUCKET_COUNT ns are counted exactly. Every power-of-two
+ * range above is split into SUB_BUCKET_COUNT equal buckets, so any recorded
+ * value is reported with at most 1/SUB_BUCKET_COUNT (3.1%) relative error.
+ * Values at or above MAX_TRACKABLE_NS (~4.3 s) fall into the last bucket.
+ *
+ * The histogram is caller-owned storage (static or member allocation per
+ * ADR-002) and attached to a ValidationCore with attach_latency_histogram().
+ * It never allocates.
+ *
+ * @performance record(): index computation (one clz) + one relaxed fetch_add,
+ *              wait-free. Queries walk all BUCKET_COUNT buckets.
+ * @thread_safety record()/merge()/queries are thread-safe; queries taken
+ *                during concurrent recording see a non-atomic snapshot
+ * @exception none (noexcept guarantee)
+ */
+
+#ifndef AES_AES5_2018_CORE_VALIDATION_LATENCY_HISTOGRAM_HPP
+#define AES_AES5_2018_CORE_VALIDATION_LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+/**
+ * @brief Log-linear bucket layout shared by latency histograms
+ * @tparam SubBucketBits log2(buckets per power of two); relative error 2^-SubBucketBits
+ * @tparam MaxValueBits Values >= 2^MaxValueBits are clamped into the last bucket
+ * @traceability DES-C-005 → LogLinearBuckets
+ */
+template<unsigned SubBucketBits, unsigned MaxValueBits>
+struct LogLinearBuckets {
+    static constexpr uint64_t SUB_BUCKET_COUNT = 1ULL << SubBucketBits;
+    static constexpr uint64_t MAX_TRACKABLE = 1ULL << MaxValueBits;
+    static constexpr size_t BUCKET_COUNT =
+        static_cast<size_t>(SUB_BUCKET_COUNT * (MaxValueBits - SubBucketBits + 1));
+
+    /// Bucket holding a value
+    static constexpr size_t index(uint64_t value) noexcept {
+        if (value >= MAX_TRACKABLE) {
+            value = MAX_TRACKABLE - 1;
+        }
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<size_t>(value);
+        }
+        const unsigned shift = highest_bit(value) - SubBucketBits;
+        const uint64_t sub_bucket = (value >> shift) - SUB_BUCKET_COUNT;
+        return static_cast<size_t>(SUB_BUCKET_COUNT * (shift + 1) + sub_bucket);
+    }
+
+    /// Smallest value mapped to a bucket
+    static constexpr uint64_t lower_bound(size_t bucket) noexcept {
+        if (bucket < SUB_BUCKET_COUNT) {
+            return bucket;
+        }
+        const uint64_t shift = bucket / SUB_BUCKET_COUNT - 1;
+        const uint64_t sub_bucket = bucket % SUB_BUCKET_COUNT;
+        return (SUB_BUCKET_COUNT + sub_bucket) << shift;
+    }
+
+    /// Largest value mapped to a bucket
+    static constexpr uint64_t upper_bound(size_t bucket) noexcept {
+        return (bucket + 1 < BUCKET_COUNT) ? lower_bound(bucket + 1) - 1 : MAX_TRACKABLE - 1;
+    }
+
+    /**
+     * @brief Smallest bucket bound v with at least percentile % of counts <= v
+     * @param counts BUCKET_COUNT bucket counts (a snapshot)
+     * @param total Sum of counts
+     * @param percentile Percentile in [0, 100]; values outside are clamped
+     * @return Bucket upper bound, 0 if total is 0
+     */
+    static uint64_t value_at_percentile(const uint64_t* counts, uint64_t total, double percentile) noexcept {
+        if (total == 0) {
+            return 0;
+        }
+        if (!(percentile > 0.0)) {
+            percentile = 0.0;
+        } else if (percentile > 100.0) {
+            percentile = 100.0;
+        }
+
+        // Rank of the requested occurrence (1-based, at least the first); the
+        // relative slack keeps e.g. 99.9% of 1000 at rank 999 despite rounding
+        const double target = percentile / 100.0 * static_cast<double>(total);
+        uint64_t rank = static_cast<uint64_t>(std::ceil(target - target * 1e-12));
+        if (rank == 0) {
+            rank = 1;
+        }
+        if (rank > total) {
+            rank = total;
+        }
+
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            cumulative += counts[i];
+            if (cumulative >= rank) {
+                return upper_bound(i);
+            }
+        }
+        return upper_bound(BUCKET_COUNT - 1);
+    }
+
+    static constexpr unsigned highest_bit(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#else
+        unsigned bit = 0;
+        while (value >>= 1) {
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+};
+
+/**
+ * @brief Lock-free log-linear latency histogram
+ * @traceability DES-C-005 → LatencyHistogram
+ *
+ * Usage Example:
+ * @code
+ * static LatencyHistogram histogram;             // fixed storage
+ * core.attach_latency_histogram(&histogram);
+ * ...
+ * uint64_t p99 = histogram.value_at_percentile(99.0);
+ * @endcode
+ */
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 5;                          ///< log2(sub-buckets per octave)
+    using Layout = LogLinearBuckets<SUB_BUCKET_BITS, 32>;                   ///< 3.1% precision, 2^32 ns range
+    static constexpr uint64_t SUB_BUCKET_COUNT = Layout::SUB_BUCKET_COUNT;  ///< Sub-buckets per octave
+    static constexpr uint64_t MAX_TRACKABLE_NS = Layout::MAX_TRACKABLE;     ///< Values >= this are clamped
+    static constexpr size_t BUCKET_COUNT = Layout::BUCKET_COUNT;
+
+    LatencyHistogram() noexcept;
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /**
+     * @brief Record occurrences of a latency
+     * @param latency_ns Latency in nanoseconds
+     * @param count Number of occurrences (e.g. batch size)
+     * @traceability DES-C-005 → LatencyHistogram::record
+     */
+    void record(uint64_t latency_ns, uint64_t count = 1) noexcept {
+        buckets_[bucket_index(latency_ns)].fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Add all counts of another histogram to this one
+     * @traceability DES-C-005 → LatencyHistogram::merge
+     */
+    void merge(const LatencyHistogram& other) noexcept;
+
+    /**
+     * @brief Clear all counts
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Total recorded occurrences
+     */
+    uint64_t total_count() const noexcept;
+
+    /**
+     * @brief Smallest value v such that at least percentile % of recorded
+     *        occurrences are <= v (within bucket precision, rounded up)
+     * @param percentile Percentile in [0, 100]; values outside are clamped
+     * @return Latency in ns, 0 if nothing has been recorded
+     * @traceability DES-C-005 → LatencyHistogram::value_at_percentile
+     */
+    uint64_t value_at_percentile(double percentile) const noexcept;
+
+    /**
+     * @brief Upper bound of the highest non-empty bucket (0 if empty)
+     */
+    uint64_t max_value() const noexcept;
+
+    /**
+     * @brief Occurrences in one bucket (for exporters)
+     */
+    uint64_t bucket_count_at(size_t index) const noexcept {
+        return (index < BUCKET_COUNT) ? buckets_[index].load(std::memory_order_relaxed) : 0;
+    }
+
+    /// Bucket holding a value
+    static constexpr size_t bucket_index(uint64_t value) noexcept { return Layout::index(value); }
+
+    /// Smallest value mapped to a bucket
+    static constexpr uint64_t bucket_lower_bound(size_t index) noexcept { return Layout::lower_bound(index); }
+
+    /// Largest value mapped to a bucket
+    static constexpr uint64_t bucket_upper_bound(size_t index) noexcept { return Layout::upper_bound(index); }
+
+private:
+    std::atomic<uint64_t> buckets_[BUCKET_COUNT];
+};
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_VALIDATION_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,111 @@
+/**
+ * @file metrics_policies.hpp
+ * @brief Metrics policies for the header-only value-type validators
+ * @traceability DES-C-005 → MetricsPolicy
+ *
+ * InlineFrequencyValidator and InlineRateCategoryManager take their metrics
+ * sink as a template parameter instead of an owned ValidationCore. A policy
+ * is any copyable type with
+ *
+ *     void record_validation(ValidationResult result) noexcept;
+ *
+ * Three are provided:
+ * - NullMetricsPolicy: records nothing (empty, no storage)
+ * - LocalCountersPolicy: plain per-object counters, for one owner thread
+ * - SharedCorePolicy: forwards to a long-lived ValidationCore it does not own
+ *
+ * Policies honour AES5_INSTRUMENTATION_LEVEL like ValidationCore: below
+ * Counters they compile to nothing.
+ *
+ * @performance No allocation, no virtual calls; inlined at the call site
+ * @thread_safety LocalCountersPolicy is not thread-safe (one owner);
+ *                SharedCorePolicy is as thread-safe as ValidationCore
+ * @exception none (noexcept guarantee)
+ */
+
+#ifndef AES_AES5_2018_CORE_VALIDATION_METRICS_POLICIES_HPP
+#define AES_AES5_2018_CORE_VALIDATION_METRICS_POLICIES_HPP
+
+#include <cstdint>
+
+#include "instrumentation.hpp"
+#include "validation_core.hpp"
+#include "validation_result.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+/**
+ * @brief Metrics policy that records nothing
+ * @traceability DES-C-005 → NullMetricsPolicy
+ */
+struct NullMetricsPolicy {
+    void record_validation(ValidationResult) noexcept {}
+};
+
+/**
+ * @brief Metrics policy with plain counters owned by the validator
+ * @traceability DES-C-005 → LocalCountersPolicy
+ *
+ * For validators owned by one thread (e.g. one per connection); copying a
+ * validator copies its counts.
+ */
+class LocalCountersPolicy {
+public:
+    void record_validation(ValidationResult result) noexcept {
+        if constexpr (INSTRUMENT_COUNTERS) {
+            ++total_validations_;
+            failed_validations_ += (result == ValidationResult::Valid) ? 0 : 1;
+        } else {
+            (void)result;
+        }
+    }
+
+    uint64_t total_validations() const noexcept { return total_validations_; }
+    uint64_t successful_validations() const noexcept { return total_validations_ - failed_validations_; }
+    uint64_t failed_validations() const noexcept { return failed_validations_; }
+
+    void reset() noexcept {
+        total_validations_ = 0;
+        failed_validations_ = 0;
+    }
+
+private:
+    uint64_t total_validations_ = 0;
+    uint64_t failed_validations_ = 0;
+};
+
+/**
+ * @brief Metrics policy forwarding counts to a shared ValidationCore
+ * @traceability DES-C-005 → SharedCorePolicy
+ *
+ * The core is not owned and must outlive every validator using it; many
+ * short-lived validators can feed one process-wide core. A null core
+ * records nothing.
+ */
+class SharedCorePolicy {
+public:
+    explicit SharedCorePolicy(ValidationCore* core = nullptr) noexcept : core_(core) {}
+
+    void record_validation(ValidationResult result) noexcept {
+        if (core_ != nullptr) {
+            core_->record_validation(result);
+        }
+    }
+
+    ValidationCore* core() const noexcept { return core_; }
+
+private:
+    ValidationCore* core_;
+};
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_VALIDATION_METRICS_POLICIES_HPP
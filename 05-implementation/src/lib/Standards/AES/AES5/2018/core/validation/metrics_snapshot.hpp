@@ -0,0 +1,128 @@
+/**
+ * @file metrics_snapshot.hpp
+ * @brief Copyable, consistent view of validation metrics and interval deltas
+ * @traceability DES-C-005 → MetricsSnapshot
+ *
+ * ValidationMetrics is a set of independent atomics: reading them one by one
+ * can pair a new total_validations with an old total_latency_ns. A
+ * MetricsSnapshot is taken by ValidationCore::get_metrics_snapshot() under a
+ * multi-writer sequence protocol (see ValidationMetrics::writes_begun) so all
+ * counters belong to the same instant; Shared cores follow the protocol only
+ * with ValidationCore::set_snapshot_sequencing(true). Two snapshots diff into a
+ * MetricsDelta giving per-interval rates.
+ *
+ * @performance Plain value type, no atomics
+ * @thread_safety Value semantics; safe to copy between threads
+ * @exception none (noexcept guarantee)
+ */
+
+#ifndef AES_AES5_2018_CORE_VALIDATION_METRICS_SNAPSHOT_HPP
+#define AES_AES5_2018_CORE_VALIDATION_METRICS_SNAPSHOT_HPP
+
+#include <cstdint>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+/**
+ * @brief Counter changes between two snapshots
+ * @traceability DES-C-005 → MetricsDelta
+ *
+ * Maximum latency is all-time and cannot be differenced; use
+ * WindowedLatencyMetrics for per-interval maxima.
+ */
+struct MetricsDelta {
+    uint64_t interval_ns = 0;            ///< Time between the snapshots (core's ClockSource)
+    uint64_t validations = 0;
+    uint64_t successful_validations = 0;
+    uint64_t failed_validations = 0;
+    uint64_t latency_ns = 0;             ///< Latency accumulated by timed validations
+    uint64_t timed_validations = 0;
+    uint64_t deadline_violations = 0;
+    bool counters_reset = false;         ///< Metrics were reset in between; counts are since the reset
+
+    /// Validations per second over the interval (0 for an empty interval)
+    double validations_per_second() const noexcept {
+        return interval_ns ? static_cast<double>(validations) * 1e9 / static_cast<double>(interval_ns) : 0.0;
+    }
+
+    /// Deadline violations per second over the interval
+    double deadline_violations_per_second() const noexcept {
+        return interval_ns ? static_cast<double>(deadline_violations) * 1e9 / static_cast<double>(interval_ns)
+                           : 0.0;
+    }
+
+    /// Average latency of validations timed in the interval
+    uint64_t average_latency_ns() const noexcept {
+        return timed_validations ? latency_ns / timed_validations : 0;
+    }
+
+    /// Success rate in the interval (0.0 to 100.0)
+    double success_rate() const noexcept {
+        return validations ? static_cast<double>(successful_validations) / validations * 100.0 : 0.0;
+    }
+};
+
+/**
+ * @brief Point-in-time copy of ValidationMetrics
+ * @traceability DES-C-005 → MetricsSnapshot
+ */
+struct MetricsSnapshot {
+    uint64_t total_validations = 0;
+    uint64_t successful_validations = 0;
+    uint64_t failed_validations = 0;
+    uint64_t max_latency_ns = 0;
+    uint64_t total_latency_ns = 0;
+    uint64_t timed_validations = 0;
+    uint64_t deadline_violations = 0;
+    uint64_t timestamp_ns = 0;           ///< When taken (core's ClockSource)
+    bool consistent = false;             ///< False if writers kept the reader from a clean read or the core is unsequenced
+
+    /// Average latency over timed validations, 0 if none were timed
+    uint64_t average_latency_ns() const noexcept {
+        return timed_validations ? total_latency_ns / timed_validations : 0;
+    }
+
+    /// Success rate (0.0 to 100.0), 0.0 if no validations
+    double success_rate() const noexcept {
+        return total_validations ? static_cast<double>(successful_validations) / total_validations * 100.0 : 0.0;
+    }
+
+    /**
+     * @brief Changes since an earlier snapshot of the same source
+     * @param earlier Snapshot taken before this one
+     * @traceability DES-C-005 → MetricsSnapshot::since
+     *
+     * If any counter went backwards the metrics were reset in between; the
+     * delta then covers this snapshot's counts since the reset.
+     */
+    MetricsDelta since(const MetricsSnapshot& earlier) const noexcept {
+        MetricsDelta delta;
+        delta.interval_ns = (timestamp_ns > earlier.timestamp_ns) ? timestamp_ns - earlier.timestamp_ns : 0;
+        delta.counters_reset = total_validations < earlier.total_validations ||
+                               successful_validations < earlier.successful_validations ||
+                               failed_validations < earlier.failed_validations ||
+                               total_latency_ns < earlier.total_latency_ns ||
+                               timed_validations < earlier.timed_validations ||
+                               deadline_violations < earlier.deadline_violations;
+        const MetricsSnapshot base = delta.counters_reset ? MetricsSnapshot() : earlier;
+        delta.validations = total_validations - base.total_validations;
+        delta.successful_validations = successful_validations - base.successful_validations;
+        delta.failed_validations = failed_validations - base.failed_validations;
+        delta.latency_ns = total_latency_ns - base.total_latency_ns;
+        delta.timed_validations = timed_validations - base.timed_validations;
+        delta.deadline_violations = deadline_violations - base.deadline_violations;
+        return delta;
+    }
+};
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_VALIDATION_METRICS_SNAPSHOT_HPP
@@ -0,0 +1,181 @@
+/**
+ * @file sharded_metrics.cpp
+ * @brief Per-thread sharded validation metrics implementation
+ * @traceability DES-C-005 → ShardedValidationMetrics
+ */
+
+#include "sharded_metrics.hpp"
+#include "validation_core.hpp"
+#include "metrics_snapshot.hpp"
+#include <new>
+#include <thread>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+namespace {
+
+/// Next thread slot (process-wide); each thread takes one on first update
+std::atomic<uint32_t> next_thread_slot{0};
+
+uint32_t thread_slot() noexcept {
+    thread_local const uint32_t slot = next_thread_slot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+} // namespace
+
+std::unique_ptr<ShardedValidationMetrics> ShardedValidationMetrics::create(size_t shard_count) noexcept {
+    if (shard_count == 0) {
+        shard_count = std::thread::hardware_concurrency();
+    }
+    size_t rounded = 1;
+    while (rounded < shard_count && rounded < MAX_SHARDS) {
+        rounded <<= 1;
+    }
+
+    std::unique_ptr<Shard[]> shards(new (std::nothrow) Shard[rounded]);
+    if (!shards) {
+        return nullptr;
+    }
+    return std::unique_ptr<ShardedValidationMetrics>(
+        new (std::nothrow) ShardedValidationMetrics(std::move(shards), rounded));
+}
+
+ShardedValidationMetrics::ShardedValidationMetrics(std::unique_ptr<Shard[]> shards, size_t shard_count) noexcept
+    : shards_(std::move(shards))
+    , shard_mask_(shard_count - 1) {
+}
+
+ShardedValidationMetrics::Shard& ShardedValidationMetrics::local_shard() noexcept {
+    return shards_[thread_slot() & shard_mask_];
+}
+
+void ShardedValidationMetrics::record(uint64_t total, uint64_t successful,
+                                      uint64_t latency_ns, uint64_t timed,
+                                      uint64_t max_latency_ns) noexcept {
+    Shard& shard = local_shard();
+    shard.writes_begun.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    shard.total_validations.fetch_add(total, std::memory_order_relaxed);
+    if (successful != 0) {
+        shard.successful_validations.fetch_add(successful, std::memory_order_relaxed);
+    }
+    if (successful != total) {
+        shard.failed_validations.fetch_add(total - successful, std::memory_order_relaxed);
+    }
+    if (timed == 0) {
+        shard.writes_done.fetch_add(1, std::memory_order_release);
+        return;
+    }
+
+    shard.total_latency_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+    shard.timed_validations.fetch_add(timed, std::memory_order_relaxed);
+
+    // Shard-local maximum: the CAS almost never contends
+    uint64_t current_max = shard.max_latency_ns.load(std::memory_order_relaxed);
+    while (max_latency_ns > current_max &&
+           !shard.max_latency_ns.compare_exchange_weak(current_max, max_latency_ns,
+                                                       std::memory_order_relaxed,
+                                                       std::memory_order_relaxed)) {
+        // Retry until updated or a larger value was stored
+    }
+    shard.writes_done.fetch_add(1, std::memory_order_release);
+}
+
+void ShardedValidationMetrics::aggregate_into(ValidationMetrics& out) const noexcept {
+    uint64_t total = 0;
+    uint64_t successful = 0;
+    uint64_t failed = 0;
+    uint64_t latency = 0;
+    uint64_t timed = 0;
+    uint64_t max_latency = 0;
+
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        const Shard& shard = shards_[i];
+        total += shard.total_validations.load(std::memory_order_relaxed);
+        successful += shard.successful_validations.load(std::memory_order_relaxed);
+        failed += shard.failed_validations.load(std::memory_order_relaxed);
+        latency += shard.total_latency_ns.load(std::memory_order_relaxed);
+        timed += shard.timed_validations.load(std::memory_order_relaxed);
+        const uint64_t shard_max = shard.max_latency_ns.load(std::memory_order_relaxed);
+        max_latency = (shard_max > max_latency) ? shard_max : max_latency;
+    }
+
+    out.total_validations.store(total, std::memory_order_relaxed);
+    out.successful_validations.store(successful, std::memory_order_relaxed);
+    out.failed_validations.store(failed, std::memory_order_relaxed);
+    out.total_latency_ns.store(latency, std::memory_order_relaxed);
+    out.timed_validations.store(timed, std::memory_order_relaxed);
+    out.max_latency_ns.store(max_latency, std::memory_order_relaxed);
+}
+
+bool ShardedValidationMetrics::snapshot_into(MetricsSnapshot& out, unsigned max_attempts) const noexcept {
+    out.total_validations = 0;
+    out.successful_validations = 0;
+    out.failed_validations = 0;
+    out.total_latency_ns = 0;
+    out.timed_validations = 0;
+    out.max_latency_ns = 0;
+
+    bool all_consistent = true;
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        const Shard& shard = shards_[i];
+        uint64_t total = 0, successful = 0, failed = 0, latency = 0, timed = 0, shard_max = 0;
+        bool consistent = false;
+        for (unsigned attempt = 0; attempt < max_attempts && !consistent; ++attempt) {
+            const uint64_t done = shard.writes_done.load(std::memory_order_acquire);
+            total = shard.total_validations.load(std::memory_order_relaxed);
+            successful = shard.successful_validations.load(std::memory_order_relaxed);
+            failed = shard.failed_validations.load(std::memory_order_relaxed);
+            latency = shard.total_latency_ns.load(std::memory_order_relaxed);
+            timed = shard.timed_validations.load(std::memory_order_relaxed);
+            shard_max = shard.max_latency_ns.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            consistent = (shard.writes_begun.load(std::memory_order_relaxed) == done);
+        }
+        all_consistent = all_consistent && consistent;
+
+        out.total_validations += total;
+        out.successful_validations += successful;
+        out.failed_validations += failed;
+        out.total_latency_ns += latency;
+        out.timed_validations += timed;
+        out.max_latency_ns = (shard_max > out.max_latency_ns) ? shard_max : out.max_latency_ns;
+    }
+    return all_consistent;
+}
+
+uint64_t ShardedValidationMetrics::max_latency_ns() const noexcept {
+    uint64_t max_latency = 0;
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        const uint64_t shard_max = shards_[i].max_latency_ns.load(std::memory_order_relaxed);
+        max_latency = (shard_max > max_latency) ? shard_max : max_latency;
+    }
+    return max_latency;
+}
+
+void ShardedValidationMetrics::reset() noexcept {
+    for (size_t i = 0; i <= shard_mask_; ++i) {
+        Shard& shard = shards_[i];
+        shard.writes_begun.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        shard.total_validations.store(0, std::memory_order_relaxed);
+        shard.successful_validations.store(0, std::memory_order_relaxed);
+        shard.failed_validations.store(0, std::memory_order_relaxed);
+        shard.total_latency_ns.store(0, std::memory_order_relaxed);
+        shard.timed_validations.store(0, std::memory_order_relaxed);
+        shard.max_latency_ns.store(0, std::memory_order_relaxed);
+        shard.writes_done.fetch_add(1, std::memory_order_release);
+    }
+}
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
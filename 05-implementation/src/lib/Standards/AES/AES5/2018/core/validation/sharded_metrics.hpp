@@ -0,0 +1,128 @@
+/**
+ * @file sharded_metrics.hpp
+ * @brief Per-thread sharded validation metrics backend
+ * @traceability DES-C-005 → Performance Metrics
+ *
+ * Spreads ValidationMetrics updates over cache-line-sized shards so that
+ * threads validating concurrently do not contend on a single cache line.
+ * Each thread is assigned a shard on first use; readers aggregate all shards
+ * on demand.
+ *
+ * @performance Updates touch only the calling thread's shard (uncontended
+ *              relaxed atomics); aggregation is O(shard count)
+ * @thread_safety All methods are thread-safe and lock-free
+ * @exception none (noexcept guarantee)
+ */
+
+#ifndef AES_AES5_2018_CORE_VALIDATION_SHARDED_METRICS_HPP
+#define AES_AES5_2018_CORE_VALIDATION_SHARDED_METRICS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+struct ValidationMetrics;
+struct MetricsSnapshot;
+
+/**
+ * @brief Cache-line-padded per-thread metrics shards
+ * @traceability DES-C-005 → ShardedValidationMetrics
+ *
+ * Non-copyable. Shards are allocated once at construction; the validation
+ * path never allocates.
+ */
+class ShardedValidationMetrics {
+public:
+    /// Cache line size assumed for shard padding
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    /// Upper bound on shards (threads beyond this share shards)
+    static constexpr size_t MAX_SHARDS = 256;
+
+    /**
+     * @brief Create a sharded backend
+     * @param shard_count Requested shards (0 = hardware concurrency); rounded up
+     *        to a power of two and clamped to MAX_SHARDS
+     * @return Backend, or nullptr if allocation failed
+     */
+    static std::unique_ptr<ShardedValidationMetrics> create(size_t shard_count = 0) noexcept;
+
+    ShardedValidationMetrics(const ShardedValidationMetrics&) = delete;
+    ShardedValidationMetrics& operator=(const ShardedValidationMetrics&) = delete;
+    ~ShardedValidationMetrics() noexcept = default;
+
+    /**
+     * @brief Record counts (and optionally latency) in the calling thread's shard
+     * @param total Validations performed
+     * @param successful Validations that succeeded (<= total)
+     * @param latency_ns Latency covering timed validations
+     * @param timed Validations covered by latency_ns (0 = counts only)
+     * @param max_latency_ns Candidate for the maximum latency
+     */
+    void record(uint64_t total, uint64_t successful,
+                uint64_t latency_ns, uint64_t timed, uint64_t max_latency_ns) noexcept;
+
+    /**
+     * @brief Sum all shards into a ValidationMetrics snapshot
+     * @param out Destination (every counter is overwritten)
+     */
+    void aggregate_into(ValidationMetrics& out) const noexcept;
+
+    /**
+     * @brief Sum all shards into a snapshot, each shard read consistently
+     * @param out Destination (counter fields are overwritten)
+     * @param max_attempts Read attempts per shard before accepting a torn read
+     * @return true if every shard was read consistently
+     */
+    bool snapshot_into(MetricsSnapshot& out, unsigned max_attempts) const noexcept;
+
+    /**
+     * @brief Maximum latency over all shards
+     */
+    uint64_t max_latency_ns() const noexcept;
+
+    /**
+     * @brief Reset every shard to zero
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Number of shards (power of two)
+     */
+    size_t shard_count() const noexcept { return shard_mask_ + 1; }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        std::atomic<uint64_t> total_validations{0};
+        std::atomic<uint64_t> successful_validations{0};
+        std::atomic<uint64_t> failed_validations{0};
+        std::atomic<uint64_t> total_latency_ns{0};
+        std::atomic<uint64_t> timed_validations{0};
+        std::atomic<uint64_t> max_latency_ns{0};
+        std::atomic<uint64_t> writes_begun{0};     ///< Snapshot sequence (see ValidationMetrics)
+        std::atomic<uint64_t> writes_done{0};
+    };
+
+    ShardedValidationMetrics(std::unique_ptr<Shard[]> shards, size_t shard_count) noexcept;
+
+    /// Shard owned by the calling thread
+    Shard& local_shard() noexcept;
+
+    std::unique_ptr<Shard[]> shards_;
+    size_t shard_mask_;
+};
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_VALIDATION_SHARDED_METRICS_HPP
@@ -13,7 +13,9 @@
  */
 
 #include "validation_core.hpp"
+
 #include <algorithm>
+#include <new>
 
 namespace AES {
 namespace AES5 {
@@ -26,31 +28,69 @@ ValidationCore::ValidationCore() noexcept {
     // Metrics are automatically initialized to zero via atomic defaults
 }
 
-ValidationCore::ValidationCore(const ValidationCore& other) noexcept {
-    // GREEN PHASE: Copy constructor - copy configuration, reset metrics
-    (void)other;  // Configuration copying not needed in minimal implementation
-    // metrics_ is automatically initialized to zero
+ValidationCore::ValidationCore(MetricsBackend backend) noexcept {
+    if (backend == MetricsBackend::Sharded) {
+        create_sharded_backend(0);
+    }
+}
+
+ValidationCore::ValidationCore(const ValidationCore& other) noexcept
+    : clock_source_(other.clock_source_)
+    , latency_deadline_ns_(other.latency_deadline_ns_.load(std::memory_order_relaxed))
+    , snapshot_sequencing_(other.snapshot_sequencing_) {
+    // Copy configuration (metrics backend), reset metrics
+    if (other.sharded_metrics_) {
+        create_sharded_backend(other.sharded_metrics_->shard_count());
+    }
 }
 
 ValidationCore& ValidationCore::operator=(const ValidationCore& other) noexcept {
-    // GREEN PHASE: Copy assignment
+    // Copy configuration (metrics backend), reset metrics
     if (this != &other) {
-        (void)other;  // Configuration copying not needed in minimal implementation
+        clock_source_ = other.clock_source_;
+        latency_deadline_ns_.store(other.latency_deadline_ns_.load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+        snapshot_sequencing_ = other.snapshot_sequencing_;
+        if (!other.sharded_metrics_) {
+            sharded_metrics_.reset();
+            sharded_view_.reset();
+        } else if (!sharded_metrics_) {
+            create_sharded_backend(other.sharded_metrics_->shard_count());
+        }
         reset_metrics();
     }
     return *this;
 }
 
-ValidationCore::ValidationCore(ValidationCore&& other) noexcept {
-    // GREEN PHASE: Move constructor
-    (void)other;  // No resources to move in minimal implementation
-    // metrics_ is automatically initialized to zero
+ValidationCore::ValidationCore(ValidationCore&& other) noexcept
+    : sharded_metrics_(std::move(other.sharded_metrics_))
+    , sharded_view_(std::move(other.sharded_view_))
+    , clock_source_(other.clock_source_)
+    , latency_histogram_(other.latency_histogram_.exchange(nullptr, std::memory_order_acq_rel))
+    , windowed_metrics_(other.windowed_metrics_.exchange(nullptr, std::memory_order_acq_rel))
+    , flight_recorder_(other.flight_recorder_.exchange(nullptr, std::memory_order_acq_rel))
+    , latency_deadline_ns_(other.latency_deadline_ns_.load(std::memory_order_relaxed))
+    , snapshot_sequencing_(other.snapshot_sequencing_) {
+    // Take over the backend; metrics start from zero
+    if (sharded_metrics_) {
+        sharded_metrics_->reset();
+    }
 }
 
 ValidationCore& ValidationCore::operator=(ValidationCore&& other) noexcept {
-    // GREEN PHASE: Move assignment
     if (this != &other) {
-        (void)other;  // No resources to move in minimal implementation
+        sharded_metrics_ = std::move(other.sharded_metrics_);
+        sharded_view_ = std::move(other.sharded_view_);
+        clock_source_ = other.clock_source_;
+        latency_histogram_.store(other.latency_histogram_.exchange(nullptr, std::memory_order_acq_rel),
+                                 std::memory_order_release);
+        windowed_metrics_.store(other.windowed_metrics_.exchange(nullptr, std::memory_order_acq_rel),
+                                std::memory_order_release);
+        flight_recorder_.store(other.flight_recorder_.exchange(nullptr, std::memory_order_acq_rel),
+                               std::memory_order_release);
+        latency_deadline_ns_.store(other.latency_deadline_ns_.load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+        snapshot_sequencing_ = other.snapshot_sequencing_;
         reset_metrics();
     }
     return *this;
@@ -67,85 +107,319 @@ ValidationResult ValidationCore::validate(uint32_t value,
         return ValidationResult::InternalError;
     }
     
-    // High-performance timing measurement (cache-optimized)
-    uint64_t start_time = get_timestamp_ns();
+    // High-performance timing measurement (configured clock source)
+    const uint64_t start_ticks = start_measurement();
     
     // Perform actual validation (main operation, optimize for inlining)
     ValidationResult result = validation_function(value, context);
     
     // Fast latency calculation (single call, single subtraction)
-    uint64_t latency_ns = get_timestamp_ns() - start_time;
-    
-    // Update metrics with optimized atomic operations
-    update_metrics(result, latency_ns);
+    uint64_t latency_ns = elapsed_measurement_ns(start_ticks);
     
-    return result;
+    // Update metrics with optimized atomic operations (applies the deadline)
+    return update_metrics(result, latency_ns);
 }
 
 ValidationResult ValidationCore::batch_validate(const uint32_t* values,
                                               size_t count,
                                               ValidationFunction validation_function,
                                               void* context) noexcept {
-    // REFACTOR PHASE: Cache-optimized batch validation
-    
     // Handle invalid parameters (fast path)
     if (values == nullptr || count == 0 || validation_function == nullptr) {
         update_metrics(ValidationResult::InternalError, 0);
         return ValidationResult::InternalError;
     }
-    
-    // Clamp batch size (avoid bounds check in hot loop)
-    const size_t batch_count = (count > MAX_BATCH_SIZE) ? MAX_BATCH_SIZE : count;
-    
-    // Single timing measurement for entire batch (reduces syscall overhead)
-    uint64_t start_time = get_timestamp_ns();
-    
-    // Cache-friendly sequential validation with early exit
-    ValidationResult overall_result = ValidationResult::Valid;
-    for (size_t i = 0; i < batch_count; ++i) {
-        ValidationResult result = validation_function(values[i], context);
-        if (result != ValidationResult::Valid) {
-            overall_result = result;
-            break;  // Early exit optimization for performance
+
+    return batch_validate_into(values, count, nullptr, validation_function, context,
+                               BatchStopPolicy::StopOnFirstFailure).first_failure;
+}
+
+BatchValidationSummary ValidationCore::batch_validate_into(const uint32_t* values,
+                                                           size_t count,
+                                                           ValidationResult* results,
+                                                           ValidationFunction validation_function,
+                                                           void* context,
+                                                           BatchStopPolicy stop_policy) noexcept {
+    BatchValidationSummary summary{0, 0, ValidationResult::Valid, count};
+
+    if ((values == nullptr && count > 0) || validation_function == nullptr) {
+        update_metrics(ValidationResult::InternalError, 0);
+        summary.first_failure = ValidationResult::InternalError;
+        summary.first_failure_index = 0;
+        return summary;
+    }
+
+    const bool stop_on_failure = (stop_policy == BatchStopPolicy::StopOnFirstFailure);
+
+    // Fixed-size chunks: one timing pair and one metrics update per chunk
+    for (size_t begin = 0; begin < count; begin += BATCH_CHUNK_SIZE) {
+        const size_t end = (count - begin < BATCH_CHUNK_SIZE) ? count : begin + BATCH_CHUNK_SIZE;
+        const uint64_t start_ticks = start_measurement();
+
+        size_t chunk_successful = 0;
+        size_t i = begin;
+        bool stopped = false;
+        for (; i < end; ++i) {
+            const ValidationResult result = validation_function(values[i], context);
+            if (results != nullptr) {
+                results[i] = result;
+            }
+            if (result == ValidationResult::Valid) {
+                ++chunk_successful;
+            } else if (summary.first_failure == ValidationResult::Valid) {
+                summary.first_failure = result;
+                summary.first_failure_index = i;
+                if (stop_on_failure) {
+                    ++i;
+                    stopped = true;
+                    break;
+                }
+            }
+        }
+
+        record_batch(i - begin, chunk_successful, elapsed_measurement_ns(start_ticks));
+        summary.processed = i;
+        summary.successful += chunk_successful;
+        if (stopped) {
+            break;
         }
     }
-    
-    // Fast latency calculation (single subtraction)
-    uint64_t latency_ns = get_timestamp_ns() - start_time;
-    
-    // Update optimized metrics
-    update_metrics(overall_result, latency_ns);
-    
-    return overall_result;
+
+    return summary;
+}
+
+void ValidationCore::record_counts(size_t count, size_t successful) noexcept {
+    if (sharded_metrics_) {
+        sharded_metrics_->record(count, successful, 0, 0, 0);
+        return;
+    }
+
+    begin_metrics_write();
+    metrics_.total_validations.fetch_add(count, std::memory_order_relaxed);
+    if (successful != 0) {
+        metrics_.successful_validations.fetch_add(successful, std::memory_order_relaxed);
+    }
+    if (successful != count) {
+        metrics_.failed_validations.fetch_add(count - successful, std::memory_order_relaxed);
+    }
+    end_metrics_write();
+}
+
+void ValidationCore::record_batch_metrics(size_t count, size_t successful, uint64_t latency_ns) noexcept {
+    if (count == 0) {
+        return;
+    }
+    if (successful > count) {
+        successful = count;
+    }
+    if constexpr (!INSTRUMENT_TIMING) {
+        (void)latency_ns;
+        record_counts(count, successful);
+        return;
+    }
+
+    // Max latency tracks per-element cost, not whole-batch duration
+    const uint64_t per_element_ns = latency_ns / count;
+
+    const uint64_t deadline_ns = latency_deadline_ns_.load(std::memory_order_relaxed);
+    const bool violation = deadline_ns != 0 && per_element_ns > deadline_ns;
+
+    if (LatencyHistogram* histogram = latency_histogram_.load(std::memory_order_acquire)) {
+        histogram->record(per_element_ns, count);
+    }
+    if (WindowedLatencyMetrics* windowed = windowed_metrics_.load(std::memory_order_acquire)) {
+        windowed->record(per_element_ns, windowed->mode() == WindowMode::Time ? clock_source_.now_ns() : 0,
+                         count, violation);
+    }
+
+    if (sharded_metrics_) {
+        if (violation) {
+            metrics_.deadline_violations.fetch_add(count, std::memory_order_relaxed);
+        }
+        sharded_metrics_->record(count, successful, latency_ns, count, per_element_ns);
+        return;
+    }
+
+    begin_metrics_write();
+    if (violation) {
+        metrics_.deadline_violations.fetch_add(count, std::memory_order_relaxed);
+    }
+    metrics_.total_validations.fetch_add(count, std::memory_order_relaxed);
+    metrics_.total_latency_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+    metrics_.timed_validations.fetch_add(count, std::memory_order_relaxed);
+    metrics_.successful_validations.fetch_add(successful, std::memory_order_relaxed);
+    metrics_.failed_validations.fetch_add(count - successful, std::memory_order_relaxed);
+
+    uint64_t current_max = metrics_.max_latency_ns.load(std::memory_order_relaxed);
+    while (per_element_ns > current_max &&
+           !metrics_.max_latency_ns.compare_exchange_weak(current_max, per_element_ns,
+                                                        std::memory_order_relaxed,
+                                                        std::memory_order_relaxed)) {
+        // Retry until updated or another thread stored a larger value
+    }
+    end_metrics_write();
 }
 
 const ValidationMetrics& ValidationCore::get_metrics() const noexcept {
-    // GREEN PHASE: Return reference to internal metrics
-    // Thread-safe access via atomic operations within ValidationMetrics
-    return metrics_;
+    // Shared backend: the live atomic counters
+    if (!sharded_metrics_) {
+        return metrics_;
+    }
+
+    // Sharded backend: refresh this core's own aggregate view, never one
+    // shared with other cores
+    sharded_metrics_->aggregate_into(*sharded_view_);
+    sharded_view_->deadline_violations.store(metrics_.deadline_violations.load(std::memory_order_relaxed),
+                                             std::memory_order_relaxed);
+    return *sharded_view_;
+}
+
+void ValidationCore::create_sharded_backend(size_t shard_count) noexcept {
+    sharded_metrics_ = ShardedValidationMetrics::create(shard_count);
+    sharded_view_.reset(new (std::nothrow) ValidationMetrics());
+    if (!sharded_metrics_ || !sharded_view_) {
+        // Fall back to MetricsBackend::Shared
+        sharded_metrics_.reset();
+        sharded_view_.reset();
+    }
+}
+
+MetricsBackend ValidationCore::get_metrics_backend() const noexcept {
+    return sharded_metrics_ ? MetricsBackend::Sharded : MetricsBackend::Shared;
+}
+
+MetricsSnapshot ValidationCore::get_metrics_snapshot() const noexcept {
+    MetricsSnapshot snapshot;
+
+    if (sharded_metrics_) {
+        snapshot.consistent = sharded_metrics_->snapshot_into(snapshot, SNAPSHOT_MAX_ATTEMPTS);
+        snapshot.deadline_violations = metrics_.deadline_violations.load(std::memory_order_relaxed);
+        snapshot.timestamp_ns = clock_source_.now_ns();
+        return snapshot;
+    }
+
+    // Without sequencing a single pass is all a reader can do
+    const unsigned attempts = snapshot_sequencing_ ? SNAPSHOT_MAX_ATTEMPTS : 1;
+    for (unsigned attempt = 0; attempt < attempts && !snapshot.consistent; ++attempt) {
+        const uint64_t done = metrics_.writes_done.load(std::memory_order_acquire);
+        snapshot.total_validations = metrics_.total_validations.load(std::memory_order_relaxed);
+        snapshot.successful_validations = metrics_.successful_validations.load(std::memory_order_relaxed);
+        snapshot.failed_validations = metrics_.failed_validations.load(std::memory_order_relaxed);
+        snapshot.max_latency_ns = metrics_.max_latency_ns.load(std::memory_order_relaxed);
+        snapshot.total_latency_ns = metrics_.total_latency_ns.load(std::memory_order_relaxed);
+        snapshot.timed_validations = metrics_.timed_validations.load(std::memory_order_relaxed);
+        snapshot.deadline_violations = metrics_.deadline_violations.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // No update started after the loads began unless begun moved past done
+        snapshot.consistent = snapshot_sequencing_ &&
+                              (metrics_.writes_begun.load(std::memory_order_relaxed) == done);
+    }
+    snapshot.timestamp_ns = clock_source_.now_ns();
+    return snapshot;
 }
 
 void ValidationCore::reset_metrics() noexcept {
     // GREEN PHASE: Reset all metrics to zero
+    begin_metrics_write();
     metrics_.total_validations.store(0, std::memory_order_relaxed);
     metrics_.successful_validations.store(0, std::memory_order_relaxed);
     metrics_.failed_validations.store(0, std::memory_order_relaxed);
     metrics_.max_latency_ns.store(0, std::memory_order_relaxed);
     metrics_.total_latency_ns.store(0, std::memory_order_relaxed);
+    metrics_.timed_validations.store(0, std::memory_order_relaxed);
+    metrics_.deadline_violations.store(0, std::memory_order_relaxed);
+    end_metrics_write();
+    if (sharded_metrics_) {
+        sharded_metrics_->reset();
+    }
+    if (LatencyHistogram* histogram = latency_histogram_.load(std::memory_order_acquire)) {
+        histogram->reset();
+    }
+    if (WindowedLatencyMetrics* windowed = windowed_metrics_.load(std::memory_order_acquire)) {
+        windowed->reset();
+    }
 }
 
 bool ValidationCore::meets_realtime_constraints(uint64_t max_latency_ns) const noexcept {
     // GREEN PHASE: Simple constraint checking
-    uint64_t current_max_latency = metrics_.max_latency_ns.load(std::memory_order_relaxed);
+    uint64_t current_max_latency = sharded_metrics_ ? sharded_metrics_->max_latency_ns()
+                                                    : metrics_.max_latency_ns.load(std::memory_order_relaxed);
     return current_max_latency <= max_latency_ns;
 }
 
-void ValidationCore::update_metrics(ValidationResult result, uint64_t latency_ns) noexcept {
+bool ValidationCore::meets_realtime_constraints(uint64_t max_latency_ns, double percentile) const noexcept {
+    const LatencyHistogram* histogram = latency_histogram_.load(std::memory_order_acquire);
+    if (histogram == nullptr || histogram->total_count() == 0) {
+        return meets_realtime_constraints(max_latency_ns);
+    }
+    return histogram->value_at_percentile(percentile) <= max_latency_ns;
+}
+
+uint64_t ValidationCore::get_latency_percentile_ns(double percentile) const noexcept {
+    const LatencyHistogram* histogram = latency_histogram_.load(std::memory_order_acquire);
+    return histogram ? histogram->value_at_percentile(percentile) : 0;
+}
+
+WindowedLatencyStats ValidationCore::get_windowed_stats() const noexcept {
+    const WindowedLatencyMetrics* windowed = windowed_metrics_.load(std::memory_order_acquire);
+    if (windowed == nullptr) {
+        return WindowedLatencyStats{0, 0, 0, 0, 0.0};
+    }
+    return windowed->stats(windowed->mode() == WindowMode::Time ? clock_source_.now_ns() : 0);
+}
+
+bool ValidationCore::meets_windowed_realtime_constraints(uint64_t max_latency_ns, double percentile) const noexcept {
+    const WindowedLatencyMetrics* windowed = windowed_metrics_.load(std::memory_order_acquire);
+    if (windowed == nullptr) {
+        return meets_realtime_constraints(max_latency_ns, percentile);
+    }
+    const uint64_t now_ns = (windowed->mode() == WindowMode::Time) ? clock_source_.now_ns() : 0;
+    if (percentile >= 100.0) {
+        return windowed->stats(now_ns).max_latency_ns <= max_latency_ns;
+    }
+    return windowed->value_at_percentile(percentile, now_ns) <= max_latency_ns;
+}
+
+ValidationResult ValidationCore::record_metrics(ValidationResult result, uint64_t latency_ns) noexcept {
     // REFACTOR PHASE: Optimized atomic metrics update
+    if constexpr (!INSTRUMENT_TIMING) {
+        // Counters level: no latency was measured, so no deadline either
+        (void)latency_ns;
+        record_counts(1, (result == ValidationResult::Valid) ? 1 : 0);
+        return result;
+    }
+    
+    // Deadline check first: a Valid result that missed it is reported as
+    // PerformanceViolation to the caller, counters keep the validator outcome
+    const uint64_t deadline_ns = latency_deadline_ns_.load(std::memory_order_relaxed);
+    const bool violation = deadline_ns != 0 && latency_ns > deadline_ns;
+    const ValidationResult reported = (violation && result == ValidationResult::Valid)
+        ? ValidationResult::PerformanceViolation : result;
+
+    if (LatencyHistogram* histogram = latency_histogram_.load(std::memory_order_acquire)) {
+        histogram->record(latency_ns);
+    }
+    if (WindowedLatencyMetrics* windowed = windowed_metrics_.load(std::memory_order_acquire)) {
+        windowed->record(latency_ns, windowed->mode() == WindowMode::Time ? clock_source_.now_ns() : 0,
+                         1, violation);
+    }
+    
+    if (sharded_metrics_) {
+        if (violation) {
+            metrics_.deadline_violations.fetch_add(1, std::memory_order_relaxed);
+        }
+        sharded_metrics_->record(1, (result == ValidationResult::Valid) ? 1 : 0, latency_ns, 1, latency_ns);
+        return reported;
+    }
     
     // Batch atomic operations for cache efficiency
+    begin_metrics_write();
+    if (violation) {
+        metrics_.deadline_violations.fetch_add(1, std::memory_order_relaxed);
+    }
     metrics_.total_validations.fetch_add(1, std::memory_order_relaxed);
     metrics_.total_latency_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+    metrics_.timed_validations.fetch_add(1, std::memory_order_relaxed);
     
     // Conditional update (optimized for valid results)
     if (result == ValidationResult::Valid) {
@@ -165,13 +439,8 @@ void ValidationCore::update_metrics(ValidationResult result, uint64_t latency_ns
             // Retry loop with relaxed ordering for performance
         }
     }
-}
-
-uint64_t ValidationCore::get_timestamp_ns() noexcept {
-    // GREEN PHASE: High-resolution timestamp
-    auto now = std::chrono::high_resolution_clock::now();
-    auto duration = now.time_since_epoch();
-    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    end_metrics_write();
+    return reported;
 }
 
 } // namespace validation
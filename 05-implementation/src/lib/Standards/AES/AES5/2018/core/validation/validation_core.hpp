@@ -26,6 +26,19 @@
 #include <atomic>
 #include <chrono>
 #include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "clock_source.hpp"
+#include "flight_recorder.hpp"
+#include "instrumentation.hpp"
+#include "latency_histogram.hpp"
+#include "metrics_snapshot.hpp"
+#include "sharded_metrics.hpp"
+#include "validation_result.hpp"
+#include "windowed_metrics.hpp"
 
 namespace AES {
 namespace AES5 {
@@ -33,18 +46,6 @@ namespace _2018 {
 namespace core {
 namespace validation {
 
-/**
- * @brief Validation result enumeration
- * @traceability DES-C-005 → ValidationResult
- */
-enum class ValidationResult : uint8_t {
-    Valid = 0,              ///< Validation passed
-    InvalidInput = 1,       ///< Input parameters invalid
-    OutOfTolerance = 2,     ///< Value outside acceptable tolerance
-    PerformanceViolation = 3, ///< Performance constraint violated
-    InternalError = 4       ///< Internal validation error
-};
-
 /**
  * @brief Performance metrics for validation operations
  * @traceability DES-C-005 → Performance Metrics
@@ -57,6 +58,17 @@ struct ValidationMetrics {
     std::atomic<uint64_t> failed_validations{0};     ///< Failed validations
     std::atomic<uint64_t> max_latency_ns{0};         ///< Maximum latency in nanoseconds
     std::atomic<uint64_t> total_latency_ns{0};       ///< Total cumulative latency
+    std::atomic<uint64_t> timed_validations{0};      ///< Validations covered by total_latency_ns
+    std::atomic<uint64_t> deadline_violations{0};    ///< Timed validations over the latency deadline
+
+    /// Snapshot sequence: updates started / completed. When snapshot
+    /// sequencing is enabled (ValidationCore::set_snapshot_sequencing())
+    /// writers increment writes_begun before and writes_done after touching
+    /// the counters; a reader that sees writes_done == writes_begun around
+    /// its loads read one consistent state (multi-writer seqlock, writers
+    /// never wait). Both stay 0 while sequencing is disabled.
+    std::atomic<uint64_t> writes_begun{0};
+    std::atomic<uint64_t> writes_done{0};
     
     // Make non-copyable due to atomic members
     ValidationMetrics() = default;
@@ -67,12 +79,15 @@ struct ValidationMetrics {
     
     /**
      * @brief Get average validation latency in nanoseconds
-     * @return Average latency, or 0 if no validations performed
+     * @return Average latency over timed validations, or 0 if none were timed
+     *
+     * Only timed validations contribute latency (see FrequencyValidator
+     * TimingPolicy), so the average is taken over timed_validations.
      */
     uint64_t get_average_latency_ns() const noexcept {
-        uint64_t total = total_validations.load(std::memory_order_relaxed);
-        if (total == 0) return 0;
-        return total_latency_ns.load(std::memory_order_relaxed) / total;
+        uint64_t timed = timed_validations.load(std::memory_order_relaxed);
+        if (timed == 0) return 0;
+        return total_latency_ns.load(std::memory_order_relaxed) / timed;
     }
     
     /**
@@ -87,6 +102,47 @@ struct ValidationMetrics {
     }
 };
 
+/**
+ * @brief True if F is callable as ValidationResult(uint32_t)
+ * @traceability DES-C-005 → InlineValidator
+ *
+ * Selects the templated validate()/batch_validate() overloads; the C-style
+ * ValidationFunction + context API is never matched by it.
+ */
+template<typename F>
+constexpr bool is_inline_validator_v = std::is_invocable_r_v<ValidationResult, F&, uint32_t>;
+
+/**
+ * @brief Storage backend for ValidationCore metrics
+ * @traceability DES-C-005 → MetricsBackend
+ */
+enum class MetricsBackend : uint8_t {
+    Shared = 0,     ///< Single set of atomic counters (default, no allocation)
+    Sharded = 1     ///< Per-thread cache-line shards aggregated on read (ShardedValidationMetrics)
+};
+
+/**
+ * @brief Early-exit behaviour of ValidationCore::batch_validate_into()
+ * @traceability DES-C-005 → BatchStopPolicy
+ */
+enum class BatchStopPolicy : uint8_t {
+    ValidateAll = 0,          ///< Validate every element
+    StopOnFirstFailure = 1    ///< Stop after the first non-Valid element
+};
+
+/**
+ * @brief Outcome of ValidationCore::batch_validate_into()
+ * @traceability DES-C-005 → BatchValidationSummary
+ */
+struct BatchValidationSummary {
+    size_t processed;                 ///< Elements validated (< count only after an early stop)
+    size_t successful;                ///< Elements that returned Valid
+    ValidationResult first_failure;   ///< First non-Valid result, Valid if none
+    size_t first_failure_index;       ///< Index of first_failure, count if none
+
+    bool all_valid() const noexcept { return first_failure == ValidationResult::Valid; }
+};
+
 /**
  * @brief Real-Time Validation Core Infrastructure
  * @traceability DES-C-005
@@ -116,6 +172,67 @@ public:
      */
     ValidationCore() noexcept;
 
+    /**
+     * @brief Construct with an explicit metrics backend
+     * @param backend Metrics storage backend
+     * @traceability DES-C-005 → Constructor
+     *
+     * MetricsBackend::Sharded allocates one cache line per hardware thread
+     * here (never in the validation path). If that allocation fails the core
+     * falls back to MetricsBackend::Shared.
+     */
+    explicit ValidationCore(MetricsBackend backend) noexcept;
+
+    /**
+     * @brief Select the timestamp source used for latency metrics
+     * @param clock_source Source (ClockSource::automatic() by default)
+     * @traceability DES-C-005, DES-C-007 → set_clock_source
+     *
+     * The default is fixed at construction: cores built before
+     * ClockSource::calibrate() has completed time with steady_clock.
+     *
+     * Configuration call: not synchronized with concurrent validations, set
+     * it before sharing the core across threads.
+     */
+    void set_clock_source(const ClockSource& clock_source) noexcept { clock_source_ = clock_source; }
+
+    /**
+     * @brief Timestamp source used for latency metrics
+     * @traceability DES-C-005, DES-C-007 → get_clock_source
+     *
+     * Components that time work themselves and report it via
+     * record_validation()/record_batch() use this source too.
+     */
+    const ClockSource& get_clock_source() const noexcept { return clock_source_; }
+
+    /**
+     * @brief Start a latency measurement on this core's clock
+     * @return ClockSource ticks, or 0 when AES5_INSTRUMENTATION_LEVEL compiles timing out
+     * @traceability DES-C-005 → start_measurement
+     *
+     * For components that time work themselves and report it via
+     * record_validation()/record_batch().
+     */
+    uint64_t start_measurement() const noexcept {
+        if constexpr (INSTRUMENT_TIMING) {
+            return clock_source_.now_ticks();
+        } else {
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Nanoseconds since start_measurement(), 0 when timing is compiled out
+     */
+    uint64_t elapsed_measurement_ns(uint64_t start_ticks) const noexcept {
+        if constexpr (INSTRUMENT_TIMING) {
+            return clock_source_.elapsed_ns(start_ticks);
+        } else {
+            (void)start_ticks;
+            return 0;
+        }
+    }
+
     /**
      * @brief Copy constructor - copies configuration but resets metrics
      * @param other Source ValidationCore to copy from
@@ -188,29 +305,227 @@ public:
      * @traceability DES-C-005 → batch_validate
      * 
      * @exception none (noexcept guarantee)
-     * @performance <500μs for up to 16 values
+     * @performance O(count): one validation_function call per value plus two
+     *              clock reads and one metrics update per BATCH_CHUNK_SIZE
+     *              values, no allocation; no upper bound on count
      * @thread_safety Thread-safe
      * 
-     * @pre values != nullptr && count > 0 && count <= MAX_BATCH_SIZE
+     * @pre values != nullptr && count > 0
      * @pre validation_function != nullptr
+     *
+     * Equivalent to batch_validate_into() with StopOnFirstFailure and no
+     * per-element results.
      */
     ValidationResult batch_validate(const uint32_t* values,
                                   size_t count,
                                   ValidationFunction validation_function,
                                   void* context = nullptr) noexcept;
 
+    /**
+     * @brief Validate an array of any length with per-element results
+     * @param values Array of values to validate
+     * @param count Number of values (unbounded)
+     * @param results Caller-owned output, at least count elements (may be nullptr)
+     * @param validation_function Function to perform validation
+     * @param context Optional context passed to validation function
+     * @param stop_policy Whether to stop after the first failure
+     * @return Processed/successful counts and the first failure
+     *
+     * @traceability DES-C-005 → batch_validate_into
+     *
+     * @exception none (noexcept guarantee)
+     * @performance Processed in BATCH_CHUNK_SIZE chunks: two clock reads and
+     *              one metrics update per chunk, no allocation
+     * @thread_safety Thread-safe
+     *
+     * Elements after an early stop are not written. Null values (with
+     * count > 0) or a null function record one InternalError and process nothing.
+     */
+    BatchValidationSummary batch_validate_into(const uint32_t* values,
+                                               size_t count,
+                                               ValidationResult* results,
+                                               ValidationFunction validation_function,
+                                               void* context = nullptr,
+                                               BatchStopPolicy stop_policy = BatchStopPolicy::ValidateAll) noexcept;
+
+    /**
+     * @brief Validate one value with an inlinable callable
+     * @tparam F Callable as ValidationResult(uint32_t), should be noexcept
+     * @param value Value to validate
+     * @param validator Callable performing the validation
+     * @return Result of validator(value)
+     *
+     * @traceability DES-C-005 → validate<F>
+     *
+     * @performance Same timing and metrics as validate(value, fn, context), but
+     *              the validator body is inlined instead of called indirectly
+     * @thread_safety Thread-safe (if validator is)
+     */
+    template<typename F, typename = std::enable_if_t<is_inline_validator_v<F>>>
+    ValidationResult validate(uint32_t value, F&& validator) noexcept;
+
+    /**
+     * @brief Batch validate with an inlinable callable, first failure wins
+     * @return ValidationResult::Valid if all pass, first failure otherwise
+     *
+     * @traceability DES-C-005 → batch_validate<F>
+     *
+     * Same semantics as batch_validate(values, count, fn, context).
+     */
+    template<typename F, typename = std::enable_if_t<is_inline_validator_v<F>>>
+    ValidationResult batch_validate(const uint32_t* values, size_t count, F&& validator) noexcept;
+
+    /**
+     * @brief Unbounded batch validation with an inlinable callable
+     *
+     * @traceability DES-C-005 → batch_validate_into<F>
+     *
+     * Same semantics as the ValidationFunction overload. With ValidateAll the
+     * per-chunk loop is branch-free (results are scanned for the first
+     * failure afterwards) so simple validators vectorize.
+     */
+    template<typename F, typename = std::enable_if_t<is_inline_validator_v<F>>>
+    BatchValidationSummary batch_validate_into(const uint32_t* values,
+                                               size_t count,
+                                               ValidationResult* results,
+                                               F&& validator,
+                                               BatchStopPolicy stop_policy = BatchStopPolicy::ValidateAll) noexcept;
+
+    /**
+     * @brief Record the outcome of a validation performed outside this core
+     * @param result Validation result
+     *
+     * @traceability DES-C-005 → record_validation
+     *
+     * @exception none (noexcept guarantee)
+     * @performance Two relaxed atomic increments, no clock access
+     * @thread_safety Thread-safe, lock-free implementation
+     *
+     * Updates counts only; latency statistics are left untouched.
+     */
+    void record_validation(ValidationResult result) noexcept {
+        if constexpr (INSTRUMENT_COUNTERS) {
+            record_counts(1, (result == ValidationResult::Valid) ? 1 : 0);
+        } else {
+            (void)result;
+        }
+    }
+
+    /**
+     * @brief Record the outcome and latency of a validation performed outside this core
+     * @param result Validation result
+     * @param latency_ns Measured latency in nanoseconds
+     *
+     * @traceability DES-C-005 → record_validation
+     *
+     * @exception none (noexcept guarantee)
+     * @performance Same cost as validate() metrics update
+     * @thread_safety Thread-safe, lock-free implementation
+     */
+    void record_validation(ValidationResult result, uint64_t latency_ns) noexcept {
+        update_metrics(result, latency_ns);
+    }
+
+    /**
+     * @brief Record the outcome of a batch validated outside this core
+     * @param count Number of values validated in the batch
+     * @param successful Number of values that validated successfully
+     * @param latency_ns Latency of the whole batch in nanoseconds
+     *
+     * @traceability DES-C-005 → record_batch
+     *
+     * @exception none (noexcept guarantee)
+     * @performance One atomic update per counter regardless of batch size
+     * @thread_safety Thread-safe, lock-free implementation
+     *
+     * Used by batch kernels (e.g. FrequencyValidator::validate_frequency_batch)
+     * to amortize metrics over the batch. Counts are per element; the maximum
+     * latency is updated with the per-element average so that
+     * meets_realtime_constraints() keeps its per-validation meaning.
+     */
+    void record_batch(size_t count, size_t successful, uint64_t latency_ns) noexcept {
+        if constexpr (INSTRUMENT_COUNTERS) {
+            record_batch_metrics(count, successful, latency_ns);
+        } else {
+            (void)count;
+            (void)successful;
+            (void)latency_ns;
+        }
+    }
+
     /**
      * @brief Get current performance metrics
-     * @return Copy of current validation metrics
+     * @return Reference to the live counters (Shared) or to a per-thread aggregate (Sharded)
      * 
      * @traceability DES-C-005 → get_metrics
      * 
      * @exception none (noexcept guarantee)
      * @performance <10μs
-     * @thread_safety Thread-safe
+     * @thread_safety Thread-safe; never writes state shared with other readers
+     *
+     * With MetricsBackend::Shared the reference tracks the live counters.
+     * With MetricsBackend::Sharded this call sums the shards into an
+     * aggregate view owned by this core (valid for the core's lifetime,
+     * never shared with other cores): the values are those of the latest
+     * get_metrics() call on this core, from any thread, and do not advance
+     * on their own. Concurrent callers refresh the same view, so monitoring
+     * threads should use get_metrics_snapshot() for a consistent copy.
      */
     const ValidationMetrics& get_metrics() const noexcept;
 
+    /**
+     * @brief Take a consistent, copyable snapshot of the metrics
+     * @return Snapshot; consistent is false if writers kept updating through
+     *         SNAPSHOT_MAX_ATTEMPTS read attempts, and always false for a
+     *         Shared core without snapshot sequencing
+     *
+     * @traceability DES-C-005 → get_metrics_snapshot
+     *
+     * @exception none (noexcept guarantee)
+     * @performance One pass over the counters per attempt (per shard with
+     *              MetricsBackend::Sharded); writers are never blocked
+     * @thread_safety Thread-safe; intended for monitoring/scraper threads
+     *
+     * Counters are read under the ValidationMetrics sequence protocol and
+     * timestamped with this core's ClockSource, so two snapshots diff into
+     * per-interval rates with MetricsSnapshot::since(). With the sharded
+     * backend each shard is read consistently and summed (sums of consistent
+     * shards keep averages exact); deadline_violations is read alongside.
+     * A Shared core reads its counters under the protocol only with
+     * set_snapshot_sequencing(true); otherwise they are read once, one by one.
+     */
+    MetricsSnapshot get_metrics_snapshot() const noexcept;
+
+    /// Read attempts before get_metrics_snapshot() gives up on consistency
+    static constexpr unsigned SNAPSHOT_MAX_ATTEMPTS = 64;
+
+    /**
+     * @brief Enable the snapshot sequence protocol for the Shared backend
+     * @param enabled True to sequence metrics updates (default false)
+     * @traceability DES-C-005 → set_snapshot_sequencing
+     *
+     * @performance Enabled: two extra atomic RMWs on the shared counters'
+     *              cache line per metrics update
+     *
+     * Configuration call: not synchronized with concurrent validations, set
+     * it before sharing the core across threads. Only Shared cores whose
+     * snapshots must be consistent under concurrent writers need it; the
+     * Sharded backend always sequences its per-thread shards.
+     */
+    void set_snapshot_sequencing(bool enabled) noexcept { snapshot_sequencing_ = enabled; }
+
+    /**
+     * @brief True if Shared-backend updates follow the snapshot sequence protocol
+     */
+    bool get_snapshot_sequencing() const noexcept { return snapshot_sequencing_; }
+
+    /**
+     * @brief Get the active metrics backend
+     * @return MetricsBackend in use
+     * @traceability DES-C-005 → get_metrics_backend
+     */
+    MetricsBackend get_metrics_backend() const noexcept;
+
     /**
      * @brief Reset performance metrics to zero
      * @traceability DES-C-005 → reset_metrics
@@ -234,6 +549,163 @@ public:
      */
     bool meets_realtime_constraints(uint64_t max_latency_ns = 100000) const noexcept; // 100μs default
 
+    /**
+     * @brief Check real-time constraints at a latency percentile
+     * @param max_latency_ns Maximum acceptable latency in nanoseconds
+     * @param percentile Share of validations (in %) that must meet it, e.g. 99.9
+     * @return true if the percentile latency is within max_latency_ns
+     *
+     * @traceability DES-C-005 → meets_realtime_constraints
+     *
+     * @exception none (noexcept guarantee)
+     * @performance O(LatencyHistogram::BUCKET_COUNT)
+     * @thread_safety Thread-safe
+     *
+     * Uses the attached LatencyHistogram (percentile rounded up to bucket
+     * precision). Without a histogram, or before any timed validation, this
+     * falls back to the all-time maximum check.
+     */
+    bool meets_realtime_constraints(uint64_t max_latency_ns, double percentile) const noexcept;
+
+    /**
+     * @brief Attach caller-owned histogram storage for latency distribution
+     * @param histogram Histogram to record into (nullptr detaches); must
+     *        outlive the attachment
+     *
+     * @traceability DES-C-005 → attach_latency_histogram
+     *
+     * @exception none (noexcept guarantee)
+     * @thread_safety Thread-safe; recordings racing the switch go to either histogram
+     *
+     * Every timed validation (validate(), record_validation() with latency,
+     * record_batch() as count × per-element average) is recorded. One
+     * histogram may be attached to several cores to aggregate them. Copies of
+     * a core start detached. reset_metrics() also clears the histogram.
+     */
+    void attach_latency_histogram(LatencyHistogram* histogram) noexcept {
+        latency_histogram_.store(histogram, std::memory_order_release);
+    }
+
+    /**
+     * @brief Attached histogram, or nullptr
+     */
+    LatencyHistogram* get_latency_histogram() const noexcept {
+        return latency_histogram_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Latency at a percentile from the attached histogram
+     * @param percentile Percentile in [0, 100]
+     * @return Latency in ns, 0 without histogram or samples
+     * @traceability DES-C-005 → get_latency_percentile_ns
+     */
+    uint64_t get_latency_percentile_ns(double percentile) const noexcept;
+
+    /**
+     * @brief Set the per-validation latency deadline
+     * @param deadline_ns Deadline in nanoseconds, 0 disables deadline checks (default)
+     *
+     * @traceability DES-C-005 → set_latency_deadline_ns
+     *
+     * @exception none (noexcept guarantee)
+     * @thread_safety Thread-safe; may be changed while validations run
+     *
+     * Every timed validation slower than the deadline increments
+     * ValidationMetrics::deadline_violations (batches: per-element average,
+     * counted per element). validate() additionally returns
+     * ValidationResult::PerformanceViolation when the validator accepted the
+     * value but missed the deadline. Success/failure counters and batch
+     * per-element results keep reporting the validator's own outcome.
+     */
+    void set_latency_deadline_ns(uint64_t deadline_ns) noexcept {
+        latency_deadline_ns_.store(deadline_ns, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Current latency deadline in nanoseconds (0 = disabled)
+     */
+    uint64_t get_latency_deadline_ns() const noexcept {
+        return latency_deadline_ns_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Attach caller-owned sliding-window metrics
+     * @param windowed Window to record into (nullptr detaches); must outlive
+     *        the attachment
+     *
+     * @traceability DES-C-005 → attach_windowed_metrics
+     *
+     * @exception none (noexcept guarantee)
+     * @thread_safety Thread-safe; recordings racing the switch go to either window
+     *
+     * Records the same samples as attach_latency_histogram(), timestamped
+     * with this core's ClockSource (one extra clock read per recording in
+     * WindowMode::Time). Copies of a core start detached. reset_metrics()
+     * also clears the window.
+     */
+    void attach_windowed_metrics(WindowedLatencyMetrics* windowed) noexcept {
+        windowed_metrics_.store(windowed, std::memory_order_release);
+    }
+
+    /**
+     * @brief Attached window, or nullptr
+     */
+    WindowedLatencyMetrics* get_windowed_metrics() const noexcept {
+        return windowed_metrics_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Statistics over the attached window ending now
+     * @return Window statistics, all zero without an attached window
+     * @traceability DES-C-005 → get_windowed_stats
+     */
+    WindowedLatencyStats get_windowed_stats() const noexcept;
+
+    /**
+     * @brief Check real-time constraints over the recent window only
+     * @param max_latency_ns Maximum acceptable latency in nanoseconds
+     * @param percentile Share of windowed validations (in %) that must meet
+     *        it; 100 uses the exact windowed maximum
+     * @return true if the windowed latency is within max_latency_ns (also
+     *         when the window holds no samples)
+     *
+     * @traceability DES-C-005 → meets_windowed_realtime_constraints
+     *
+     * @exception none (noexcept guarantee)
+     * @performance O(window_intervals × WindowedLatencyMetrics::Layout::BUCKET_COUNT)
+     * @thread_safety Thread-safe
+     *
+     * Unlike meets_realtime_constraints(), an old spike stops failing the
+     * check once it leaves the window. Without an attached window this
+     * falls back to meets_realtime_constraints(max_latency_ns, percentile).
+     */
+    bool meets_windowed_realtime_constraints(uint64_t max_latency_ns, double percentile = 100.0) const noexcept;
+
+    /**
+     * @brief Attach a caller-owned flight recorder
+     * @param recorder Recorder to write events into (nullptr detaches); must
+     *        outlive the attachment
+     *
+     * @traceability DES-C-005 → attach_flight_recorder
+     *
+     * @exception none (noexcept guarantee)
+     * @thread_safety Thread-safe; events racing the switch go to either recorder
+     *
+     * FrequencyValidator records each single-frequency validation into the
+     * recorder of its core; batch validations are not recorded. Copies of a
+     * core start detached; reset_metrics() leaves the recorded events alone.
+     */
+    void attach_flight_recorder(FlightRecorder* recorder) noexcept {
+        flight_recorder_.store(recorder, std::memory_order_release);
+    }
+
+    /**
+     * @brief Attached flight recorder, or nullptr
+     */
+    FlightRecorder* get_flight_recorder() const noexcept {
+        return flight_recorder_.load(std::memory_order_acquire);
+    }
+
     /**
      * @brief Get memory footprint of ValidationCore instance
      * @return Size in bytes of this instance
@@ -244,27 +716,167 @@ public:
         return sizeof(ValidationCore);
     }
 
+    /// Values per timing/metrics chunk in batch validation
+    static constexpr size_t BATCH_CHUNK_SIZE = 1024;
+
 private:
-    /// Maximum number of values in batch validation
-    static constexpr size_t MAX_BATCH_SIZE = 16;
 
-    /// Performance metrics (atomic for thread safety)
-    mutable ValidationMetrics metrics_;
+    /// Performance metrics (atomic for thread safety; only deadline_violations when sharded)
+    ValidationMetrics metrics_;
+
+    /// Sharded backend (nullptr for MetricsBackend::Shared)
+    std::unique_ptr<ShardedValidationMetrics> sharded_metrics_;
+
+    /// Per-core shard totals returned by get_metrics() (Sharded backend only)
+    std::unique_ptr<ValidationMetrics> sharded_view_;
+
+    /// Timestamp source for latency metrics (cycle counter when invariant)
+    ClockSource clock_source_ = ClockSource::automatic();
+
+    /// Optional caller-owned latency distribution (nullptr = not recorded)
+    std::atomic<LatencyHistogram*> latency_histogram_{nullptr};
+
+    /// Optional caller-owned sliding window (nullptr = not recorded)
+    std::atomic<WindowedLatencyMetrics*> windowed_metrics_{nullptr};
+
+    /// Optional caller-owned event ring (nullptr = not recorded)
+    std::atomic<FlightRecorder*> flight_recorder_{nullptr};
+
+    /// Per-validation latency deadline in ns (0 = disabled)
+    std::atomic<uint64_t> latency_deadline_ns_{0};
+
+    /// Shared-backend updates bump writes_begun/writes_done (opt-in)
+    bool snapshot_sequencing_ = false;
 
     /**
      * @brief Update metrics after validation operation
      * @param result Validation result
      * @param latency_ns Operation latency in nanoseconds
+     * @return result, or PerformanceViolation if a Valid result missed the deadline
+     *
+     * Compiles to nothing at InstrumentationLevel::None.
      */
-    void update_metrics(ValidationResult result, uint64_t latency_ns) noexcept;
+    ValidationResult update_metrics(ValidationResult result, uint64_t latency_ns) noexcept {
+        if constexpr (INSTRUMENT_COUNTERS) {
+            return record_metrics(result, latency_ns);
+        } else {
+            (void)latency_ns;
+            return result;
+        }
+    }
 
-    /**
-     * @brief Get high-resolution timestamp in nanoseconds
-     * @return Current time in nanoseconds since epoch
-     */
-    static uint64_t get_timestamp_ns() noexcept;
+    /// update_metrics() body; counts only below InstrumentationLevel::Timing
+    ValidationResult record_metrics(ValidationResult result, uint64_t latency_ns) noexcept;
+
+    /// record_batch() body; counts only below InstrumentationLevel::Timing
+    void record_batch_metrics(size_t count, size_t successful, uint64_t latency_ns) noexcept;
+
+    /// Count validations without latency
+    void record_counts(size_t count, size_t successful) noexcept;
+
+    /// Allocate shards and view; leaves the core on the Shared backend on failure
+    void create_sharded_backend(size_t shard_count) noexcept;
+
+    /// Open a shared-backend metrics update (snapshot sequence protocol, if enabled)
+    void begin_metrics_write() noexcept {
+        if (snapshot_sequencing_) {
+            metrics_.writes_begun.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+    }
+
+    /// Close a shared-backend metrics update
+    void end_metrics_write() noexcept {
+        if (snapshot_sequencing_) {
+            metrics_.writes_done.fetch_add(1, std::memory_order_release);
+        }
+    }
 };
 
+// Template implementations (inlined into callers)
+
+template<typename F, typename>
+ValidationResult ValidationCore::validate(uint32_t value, F&& validator) noexcept {
+    const uint64_t start_ticks = start_measurement();
+    const ValidationResult result = validator(value);
+    return update_metrics(result, elapsed_measurement_ns(start_ticks));
+}
+
+template<typename F, typename>
+ValidationResult ValidationCore::batch_validate(const uint32_t* values, size_t count, F&& validator) noexcept {
+    if (values == nullptr || count == 0) {
+        update_metrics(ValidationResult::InternalError, 0);
+        return ValidationResult::InternalError;
+    }
+    return batch_validate_into(values, count, nullptr, std::forward<F>(validator),
+                               BatchStopPolicy::StopOnFirstFailure).first_failure;
+}
+
+template<typename F, typename>
+BatchValidationSummary ValidationCore::batch_validate_into(const uint32_t* values,
+                                                           size_t count,
+                                                           ValidationResult* results,
+                                                           F&& validator,
+                                                           BatchStopPolicy stop_policy) noexcept {
+    BatchValidationSummary summary{0, 0, ValidationResult::Valid, count};
+
+    if (values == nullptr && count > 0) {
+        update_metrics(ValidationResult::InternalError, 0);
+        summary.first_failure = ValidationResult::InternalError;
+        summary.first_failure_index = 0;
+        return summary;
+    }
+
+    ValidationResult scratch[BATCH_CHUNK_SIZE];
+
+    for (size_t begin = 0; begin < count; begin += BATCH_CHUNK_SIZE) {
+        const size_t chunk = (count - begin < BATCH_CHUNK_SIZE) ? count - begin : BATCH_CHUNK_SIZE;
+        ValidationResult* out = (results != nullptr) ? results + begin : scratch;
+        const uint32_t* in = values + begin;
+        const uint64_t start_ticks = start_measurement();
+
+        size_t processed = chunk;
+        size_t successful = 0;
+        if (stop_policy == BatchStopPolicy::StopOnFirstFailure) {
+            for (size_t i = 0; i < chunk; ++i) {
+                const ValidationResult result = validator(in[i]);
+                out[i] = result;
+                if (result != ValidationResult::Valid) {
+                    processed = i + 1;
+                    break;
+                }
+                ++successful;
+            }
+        } else {
+            // Branch-free body; first failure located after the loop
+            for (size_t i = 0; i < chunk; ++i) {
+                const ValidationResult result = validator(in[i]);
+                out[i] = result;
+                successful += (result == ValidationResult::Valid) ? 1 : 0;
+            }
+        }
+
+        record_batch(processed, successful, elapsed_measurement_ns(start_ticks));
+        summary.processed = begin + processed;
+        summary.successful += successful;
+
+        if (successful != processed && summary.first_failure == ValidationResult::Valid) {
+            for (size_t i = 0; i < processed; ++i) {
+                if (out[i] != ValidationResult::Valid) {
+                    summary.first_failure = out[i];
+                    summary.first_failure_index = begin + i;
+                    break;
+                }
+            }
+            if (stop_policy == BatchStopPolicy::StopOnFirstFailure) {
+                break;
+            }
+        }
+    }
+
+    return summary;
+}
+
 } // namespace validation
 } // namespace core
 } // namespace _2018
@@ -0,0 +1,40 @@
+/**
+ * @file validation_result.hpp
+ * @brief Outcome of a single validation
+ * @traceability DES-C-005 → ValidationResult
+ *
+ * Kept separate from validation_core.hpp so header-only code (the
+ * compile-time engine, flight recorder events) can name results without
+ * pulling in ValidationCore.
+ */
+
+#ifndef AES_AES5_2018_CORE_VALIDATION_VALIDATION_RESULT_HPP
+#define AES_AES5_2018_CORE_VALIDATION_VALIDATION_RESULT_HPP
+
+#include <cstdint>
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+/**
+ * @brief Validation result enumeration
+ * @traceability DES-C-005 → ValidationResult
+ */
+enum class ValidationResult : uint8_t {
+    Valid = 0,              ///< Validation passed
+    InvalidInput = 1,       ///< Input parameters invalid
+    OutOfTolerance = 2,     ///< Value outside acceptable tolerance
+    PerformanceViolation = 3, ///< Latency exceeded the deadline (ValidationCore::set_latency_deadline_ns)
+    InternalError = 4       ///< Internal validation error
+};
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_VALIDATION_VALIDATION_RESULT_HPP
@@ -0,0 +1,139 @@
+/**
+ * @file windowed_metrics.cpp
+ * @brief Sliding-window latency metrics: slot recycling and window queries
+ * @traceability DES-C-005 → WindowedLatencyMetrics
+ */
+
+#include "windowed_metrics.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+WindowedLatencyMetrics::WindowedLatencyMetrics(WindowMode mode,
+                                               uint64_t interval_length,
+                                               size_t window_intervals) noexcept
+    : mode_(mode)
+    , interval_length_(interval_length ? interval_length : 1)
+    , window_intervals_(window_intervals == 0 ? 1
+                        : (window_intervals > MAX_WINDOW_INTERVALS ? MAX_WINDOW_INTERVALS : window_intervals)) {
+    reset();
+}
+
+bool WindowedLatencyMetrics::claim_slot(Slot& slot, uint64_t interval) noexcept {
+    const uint64_t tag = interval + 1;
+    uint64_t seen = slot.tag.load(std::memory_order_acquire);
+    while (seen != tag) {
+        // Being cleared by another writer, or already recycled for a newer
+        // interval (this writer lagged a full ring): drop rather than wait
+        if (seen == CLAIMING || seen > tag) {
+            return false;
+        }
+        if (slot.tag.compare_exchange_weak(seen, CLAIMING, std::memory_order_acquire,
+                                           std::memory_order_acquire)) {
+            slot.count.store(0, std::memory_order_relaxed);
+            slot.violations.store(0, std::memory_order_relaxed);
+            slot.max_latency_ns.store(0, std::memory_order_relaxed);
+            for (auto& bucket : slot.buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            slot.tag.store(tag, std::memory_order_release);
+            return true;
+        }
+    }
+    return true;
+}
+
+uint64_t WindowedLatencyMetrics::current_interval(uint64_t now_ns) const noexcept {
+    if (mode_ == WindowMode::Time) {
+        return now_ns / interval_length_;
+    }
+    // Interval of the most recent sample: an interval that has no sample yet
+    // would otherwise take a window slot and shorten the span by one interval
+    const uint64_t samples = sample_counter_.load(std::memory_order_relaxed);
+    return (samples == 0) ? 0 : (samples - 1) / interval_length_;
+}
+
+uint64_t WindowedLatencyMetrics::collect(uint64_t current, uint64_t* counts, uint64_t* max_latency_ns,
+                                         uint64_t* violations) const noexcept {
+    for (size_t i = 0; i < Layout::BUCKET_COUNT; ++i) {
+        counts[i] = 0;
+    }
+    *max_latency_ns = 0;
+    *violations = 0;
+
+    uint64_t total = 0;
+    for (size_t back = 0; back < window_intervals_ && back <= current; ++back) {
+        const uint64_t interval = current - back;
+        const Slot& slot = slots_[interval % SLOT_COUNT];
+        if (slot.tag.load(std::memory_order_acquire) != interval + 1) {
+            continue;   // Idle interval (never written, or already recycled)
+        }
+        total += slot.count.load(std::memory_order_relaxed);
+        *violations += slot.violations.load(std::memory_order_relaxed);
+        const uint64_t slot_max = slot.max_latency_ns.load(std::memory_order_relaxed);
+        *max_latency_ns = (slot_max > *max_latency_ns) ? slot_max : *max_latency_ns;
+        for (size_t i = 0; i < Layout::BUCKET_COUNT; ++i) {
+            counts[i] += slot.buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+    return total;
+}
+
+WindowedLatencyStats WindowedLatencyMetrics::stats(uint64_t now_ns) const noexcept {
+    WindowedLatencyStats stats{0, 0, 0, 0, 0.0};
+
+    uint64_t counts[Layout::BUCKET_COUNT];
+    stats.count = collect(current_interval(now_ns), counts, &stats.max_latency_ns, &stats.deadline_violations);
+    if (stats.count == 0) {
+        return stats;
+    }
+
+    uint64_t bucket_total = 0;
+    for (uint64_t count : counts) {
+        bucket_total += count;
+    }
+    stats.p99_latency_ns = Layout::value_at_percentile(counts, bucket_total, 99.0);
+
+    if (mode_ == WindowMode::Time) {
+        // Completed intervals plus the elapsed part of the current one
+        const uint64_t span_ns = (window_intervals_ - 1) * interval_length_ + now_ns % interval_length_ + 1;
+        stats.throughput_per_second = static_cast<double>(stats.count) * 1e9 / static_cast<double>(span_ns);
+    }
+    return stats;
+}
+
+uint64_t WindowedLatencyMetrics::value_at_percentile(double percentile, uint64_t now_ns) const noexcept {
+    uint64_t counts[Layout::BUCKET_COUNT];
+    uint64_t max_latency_ns = 0;
+    uint64_t violations = 0;
+    collect(current_interval(now_ns), counts, &max_latency_ns, &violations);
+
+    uint64_t total = 0;
+    for (uint64_t count : counts) {
+        total += count;
+    }
+    return Layout::value_at_percentile(counts, total, percentile);
+}
+
+void WindowedLatencyMetrics::reset() noexcept {
+    for (Slot& slot : slots_) {
+        slot.tag.store(0, std::memory_order_relaxed);
+        slot.count.store(0, std::memory_order_relaxed);
+        slot.violations.store(0, std::memory_order_relaxed);
+        slot.max_latency_ns.store(0, std::memory_order_relaxed);
+        for (auto& bucket : slot.buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+    sample_counter_.store(0, std::memory_order_relaxed);
+    dropped_samples_.store(0, std::memory_order_relaxed);
+}
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
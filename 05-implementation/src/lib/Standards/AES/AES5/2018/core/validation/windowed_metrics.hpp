@@ -0,0 +1,199 @@
+/**
+ * @file windowed_metrics.hpp
+ * @brief Sliding-window latency metrics (ring of per-interval buckets)
+ * @traceability DES-C-005 → WindowedLatencyMetrics
+ *
+ * All-time statistics never forget: one cold-cache spike at startup fails
+ * meets_realtime_constraints() until reset_metrics() discards every count.
+ * WindowedLatencyMetrics keeps a ring of SLOT_COUNT intervals, each with its
+ * own count, maximum, deadline-violation count and coarse log-linear latency
+ * histogram, and answers queries over the most recent window_intervals only.
+ *
+ * Intervals are either time based (interval_length in ns of the owning
+ * core's ClockSource) or count based (interval_length samples). A slot is
+ * recycled lazily by the first writer of a new interval. A Count-mode window
+ * ends at the interval holding the most recent sample, so it always spans
+ * window_intervals intervals of recorded samples.
+ *
+ * Like LatencyHistogram this is caller-owned storage (static or member
+ * allocation per ADR-002), attached with
+ * ValidationCore::attach_windowed_metrics(). It never allocates.
+ *
+ * @performance record(): a handful of relaxed atomic updates on one slot
+ *              (max via CAS loop), no locks. Queries walk window_intervals
+ *              slots of Layout::BUCKET_COUNT buckets.
+ * @thread_safety record() is lock-free and may run on audio threads.
+ *                Samples racing a slot recycle (first write of an interval
+ *                while the slot is being cleared) are dropped and counted in
+ *                dropped_samples(). Queries during recording are approximate.
+ * @exception none (noexcept guarantee)
+ */
+
+#ifndef AES_AES5_2018_CORE_VALIDATION_WINDOWED_METRICS_HPP
+#define AES_AES5_2018_CORE_VALIDATION_WINDOWED_METRICS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "latency_histogram.hpp"
+
+namespace AES {
+namespace AES5 {
+namespace _2018 {
+namespace core {
+namespace validation {
+
+/**
+ * @brief How WindowedLatencyMetrics advances intervals
+ * @traceability DES-C-005 → WindowMode
+ */
+enum class WindowMode : uint8_t {
+    Time = 0,    ///< interval_length nanoseconds per interval
+    Count = 1    ///< interval_length recorded samples per interval
+};
+
+/**
+ * @brief Aggregate over the current window
+ * @traceability DES-C-005 → WindowedLatencyStats
+ */
+struct WindowedLatencyStats {
+    uint64_t count;                 ///< Samples in the window
+    uint64_t deadline_violations;   ///< Samples over the core's latency deadline
+    uint64_t max_latency_ns;        ///< Exact maximum in the window (0 if empty)
+    uint64_t p99_latency_ns;        ///< 99th percentile (bucket upper bound, 12.5% precision)
+    double throughput_per_second;   ///< Samples per second over the window span (0 in Count mode)
+};
+
+/**
+ * @brief Lock-free ring of per-interval latency statistics
+ * @traceability DES-C-005 → WindowedLatencyMetrics
+ *
+ * Usage Example:
+ * @code
+ * static WindowedLatencyMetrics window(WindowMode::Time, 100000000, 10); // last ~1 s
+ * core.attach_windowed_metrics(&window);
+ * core.set_latency_deadline_ns(20000);
+ * ...
+ * bool ok = core.meets_windowed_realtime_constraints(20000, 99.0);
+ * @endcode
+ */
+class WindowedLatencyMetrics {
+public:
+    using Layout = LogLinearBuckets<3, 32>;                   ///< 12.5% precision, 2^32 ns range
+
+    static constexpr size_t SLOT_COUNT = 16;                  ///< Intervals held in the ring
+    static constexpr size_t MAX_WINDOW_INTERVALS = SLOT_COUNT - 1;   ///< One slot kept for late writers
+    static constexpr uint64_t DEFAULT_INTERVAL_NS = 100000000;       ///< 100 ms
+
+    /**
+     * @brief Configure the window
+     * @param mode Time or Count intervals
+     * @param interval_length Nanoseconds (Time) or samples (Count) per interval, at least 1
+     * @param window_intervals Intervals covered by queries, clamped to [1, MAX_WINDOW_INTERVALS]
+     */
+    explicit WindowedLatencyMetrics(WindowMode mode = WindowMode::Time,
+                                    uint64_t interval_length = DEFAULT_INTERVAL_NS,
+                                    size_t window_intervals = 10) noexcept;
+
+    WindowedLatencyMetrics(const WindowedLatencyMetrics&) = delete;
+    WindowedLatencyMetrics& operator=(const WindowedLatencyMetrics&) = delete;
+
+    /**
+     * @brief Record occurrences of a latency
+     * @param latency_ns Latency in nanoseconds
+     * @param now_ns Current time (Time mode; ignored in Count mode)
+     * @param count Number of occurrences (e.g. batch size)
+     * @param deadline_violation True if the occurrences missed the deadline
+     * @traceability DES-C-005 → WindowedLatencyMetrics::record
+     */
+    void record(uint64_t latency_ns, uint64_t now_ns, uint64_t count = 1,
+                bool deadline_violation = false) noexcept {
+        const uint64_t interval = (mode_ == WindowMode::Time)
+            ? now_ns / interval_length_
+            : sample_counter_.fetch_add(count, std::memory_order_relaxed) / interval_length_;
+
+        Slot& slot = slots_[interval % SLOT_COUNT];
+        if (slot.tag.load(std::memory_order_acquire) != interval + 1 && !claim_slot(slot, interval)) {
+            dropped_samples_.fetch_add(count, std::memory_order_relaxed);
+            return;
+        }
+
+        slot.count.fetch_add(count, std::memory_order_relaxed);
+        slot.buckets[Layout::index(latency_ns)].fetch_add(count, std::memory_order_relaxed);
+        if (deadline_violation) {
+            slot.violations.fetch_add(count, std::memory_order_relaxed);
+        }
+        uint64_t current_max = slot.max_latency_ns.load(std::memory_order_relaxed);
+        while (latency_ns > current_max &&
+               !slot.max_latency_ns.compare_exchange_weak(current_max, latency_ns,
+                                                          std::memory_order_relaxed,
+                                                          std::memory_order_relaxed)) {
+            // Retry until updated or another thread stored a larger value
+        }
+    }
+
+    /**
+     * @brief Statistics over the window ending at now_ns
+     * @param now_ns Current time (Time mode; ignored in Count mode)
+     * @traceability DES-C-005 → WindowedLatencyMetrics::stats
+     */
+    WindowedLatencyStats stats(uint64_t now_ns) const noexcept;
+
+    /**
+     * @brief Latency at a percentile over the window ending at now_ns
+     * @param percentile Percentile in [0, 100]
+     * @param now_ns Current time (Time mode; ignored in Count mode)
+     * @return Bucket upper bound in ns, 0 if the window is empty
+     */
+    uint64_t value_at_percentile(double percentile, uint64_t now_ns) const noexcept;
+
+    /**
+     * @brief Clear every interval
+     */
+    void reset() noexcept;
+
+    WindowMode mode() const noexcept { return mode_; }
+    uint64_t interval_length() const noexcept { return interval_length_; }
+    size_t window_intervals() const noexcept { return window_intervals_; }
+
+    /// Samples lost to slot recycling races since construction/reset
+    uint64_t dropped_samples() const noexcept { return dropped_samples_.load(std::memory_order_relaxed); }
+
+private:
+    /// Tag of a slot being cleared by the writer that claimed it
+    static constexpr uint64_t CLAIMING = ~0ULL;
+
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> tag;              ///< interval + 1, 0 if unused, CLAIMING while cleared
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> violations;
+        std::atomic<uint64_t> max_latency_ns;
+        std::atomic<uint64_t> buckets[Layout::BUCKET_COUNT];   ///< Full width: batch counts may exceed 2^32
+    };
+
+    /// Recycle a slot for interval; false if another writer holds it or it is newer
+    bool claim_slot(Slot& slot, uint64_t interval) noexcept;
+
+    /// Last interval of the window (reads the sample counter in Count mode)
+    uint64_t current_interval(uint64_t now_ns) const noexcept;
+
+    /// Sum buckets of in-window slots into counts; returns the sample count
+    uint64_t collect(uint64_t current, uint64_t* counts, uint64_t* max_latency_ns,
+                     uint64_t* violations) const noexcept;
+
+    const WindowMode mode_;
+    const uint64_t interval_length_;
+    const size_t window_intervals_;
+    std::atomic<uint64_t> sample_counter_{0};
+    std::atomic<uint64_t> dropped_samples_{0};
+    Slot slots_[SLOT_COUNT];
+};
+
+} // namespace validation
+} // namespace core
+} // namespace _2018
+} // namespace AES5
+} // namespace AES
+
+#endif // AES_AES5_2018_CORE_VALIDATION_WINDOWED_METRICS_HPP
@@ -10,11 +10,17 @@
 #include <functional>
 #include <thread>
 #include <atomic>
+#include <cstdio>
+#include <string>
+#include <type_traits>
 
 // Include FrequencyValidator and dependencies
+#include "AES/AES5/2018/core/compile_time/aes5_compile_time.hpp"
 #include "AES/AES5/2018/core/frequency_validation/frequency_validator.hpp"
+#include "AES/AES5/2018/core/frequency_validation/inline_frequency_validator.hpp"
 #include "AES/AES5/2018/core/compliance/compliance_engine.hpp"
 #include "AES/AES5/2018/core/validation/validation_core.hpp"
+#include "AES/AES5/2018/core/simd/cpu_features.hpp"
 
 using namespace AES::AES5::_2018::core::frequency_validation;
 using namespace AES::AES5::_2018::core::compliance;
@@ -499,6 +505,489 @@ TEST_F(FrequencyValidatorTest, MemoryFootprintValidation) {
     }, "Batch validation (10x)", std::chrono::nanoseconds(500000)); // 500μs for 10 validations
 }
 
+/**
+ * @brief Test batch validation matches per-call validation for every kernel
+ * @requirement SYS-PERF-003: Batch processing optimization
+ * @traceability TEST-C-001-016 → DES-C-001 → SYS-PERF-003
+ */
+TEST_F(FrequencyValidatorTest, BatchValidationMatchesScalarValidation) {
+    // Given: Sweep across all capture ranges plus standard rates and edge values
+    std::vector<uint32_t> frequencies = {
+        0, 1, 32000, 38050, 38051, 44100, 45999, 46000, 47952, 47976, 47977,
+        48000, 48150, 48151, 48048, 88200, 96000, 176400, 192000, 384000, UINT32_MAX
+    };
+    for (uint32_t frequency = 1; frequency < 500000; frequency += 997) {
+        frequencies.push_back(frequency);
+    }
+
+    const size_t count = frequencies.size();
+    std::vector<ValidationResult> status(count);
+    std::vector<uint32_t> closest(count);
+    std::vector<double> ppm(count);
+    std::vector<AES5Clause> clause(count);
+    const FrequencyBatchResults results{status.data(), closest.data(), ppm.data(), clause.data()};
+
+    for (auto level : {AES::AES5::_2018::core::simd::SimdLevel::Scalar,
+                       AES::AES5::_2018::core::simd::SimdLevel::AVX512}) {
+        AES::AES5::_2018::core::simd::set_max_simd_level(level);
+
+        // When: Validating the whole array in one call
+        size_t valid = validator_->validate_frequency_batch(frequencies.data(), count, results, 200);
+
+        // Then: Every element matches validate_frequency()
+        size_t expected_valid = 0;
+        for (size_t i = 0; i < count; ++i) {
+            FrequencyValidationResult expected = validator_->validate_frequency(frequencies[i], 200);
+            expected_valid += expected.is_valid() ? 1 : 0;
+            EXPECT_EQ(status[i], expected.status) << "Frequency: " << frequencies[i];
+            EXPECT_EQ(closest[i], expected.closest_standard_frequency) << "Frequency: " << frequencies[i];
+            EXPECT_EQ(ppm[i], expected.tolerance_ppm) << "Frequency: " << frequencies[i];
+            EXPECT_EQ(clause[i], expected.applicable_clause) << "Frequency: " << frequencies[i];
+        }
+        EXPECT_EQ(valid, expected_valid);
+    }
+    AES::AES5::_2018::core::simd::set_max_simd_level(AES::AES5::_2018::core::simd::SimdLevel::AVX512);
+}
+
+/**
+ * @brief Test batch validation with per-element tolerances and metrics amortization
+ * @requirement SYS-PERF-003: Batch processing optimization
+ * @traceability TEST-C-001-017 → DES-C-001 → SYS-PERF-003
+ */
+TEST_F(FrequencyValidatorTest, BatchValidationPerElementToleranceAndMetrics) {
+    // Given: 48005 Hz (~104 ppm) checked against alternating tolerances
+    std::vector<uint32_t> frequencies(20, 48005);
+    std::vector<uint32_t> tolerances(20);
+    for (size_t i = 0; i < tolerances.size(); ++i) {
+        tolerances[i] = (i % 2 == 0) ? 200 : 50;
+    }
+    std::vector<ValidationResult> status(20);
+    std::vector<uint32_t> closest(20);
+    std::vector<double> ppm(20);
+    validator_->reset_metrics();
+
+    // When: Validating with per-element tolerances
+    size_t valid = validator_->validate_frequency_batch(
+        frequencies.data(), tolerances.data(), frequencies.size(),
+        {status.data(), closest.data(), ppm.data(), nullptr});
+
+    // Then: Only elements with the wide tolerance pass
+    EXPECT_EQ(valid, 10u);
+    for (size_t i = 0; i < status.size(); ++i) {
+        EXPECT_EQ(status[i], (i % 2 == 0) ? ValidationResult::Valid : ValidationResult::OutOfTolerance);
+    }
+
+    // And: Metrics count every element, updated once for the batch
+    const ValidationMetrics& metrics = validator_->get_metrics();
+    EXPECT_EQ(metrics.total_validations.load(), 20u);
+    EXPECT_EQ(metrics.successful_validations.load(), 10u);
+    EXPECT_EQ(metrics.failed_validations.load(), 10u);
+    EXPECT_TRUE(validator_->meets_realtime_constraints());
+
+    // And: Invalid parameters are rejected without touching metrics
+    EXPECT_EQ(validator_->validate_frequency_batch(nullptr, 20, {status.data(), closest.data(), ppm.data(), nullptr}), 0u);
+    EXPECT_EQ(validator_->validate_frequency_batch(frequencies.data(), 20, {nullptr, closest.data(), ppm.data(), nullptr}), 0u);
+    EXPECT_EQ(validator_->validate_frequency_batch(frequencies.data(), nullptr, 20, {status.data(), closest.data(), ppm.data(), nullptr}), 0u);
+    EXPECT_EQ(metrics.total_validations.load(), 20u);
+
+    // And: Zero elements are InvalidInput but, as with validate_frequency(0), not counted
+    const std::vector<uint32_t> with_zeros = {0, 48000, 0, 44100};
+    validator_->reset_metrics();
+    EXPECT_EQ(validator_->validate_frequency_batch(with_zeros.data(), with_zeros.size(),
+                                                   {status.data(), closest.data(), ppm.data(), nullptr}), 2u);
+    EXPECT_EQ(status[0], ValidationResult::InvalidInput);
+    EXPECT_EQ(metrics.total_validations.load(), 2u);
+    EXPECT_EQ(metrics.failed_validations.load(), 0u);
+    validator_->validate_frequency(0);
+    EXPECT_EQ(metrics.total_validations.load(), 2u);
+    EXPECT_EQ(validator_->validate_frequency_batch(with_zeros.data(), 1,
+                                                   {status.data(), closest.data(), ppm.data(), nullptr}), 0u);
+    EXPECT_EQ(metrics.total_validations.load(), 2u);
+}
+
+/**
+ * @brief Test closest standard frequency on both sides of every decision boundary
+ * @requirement REQ-F-002: Standard frequency identification
+ * @traceability TEST-C-001-018 → DES-C-001 → REQ-F-002
+ */
+TEST_F(FrequencyValidatorTest, ClosestStandardFrequencyBoundaries) {
+    // Given: Frequencies at the edges of each capture range
+    const std::pair<uint32_t, uint32_t> cases[] = {
+        {1, 32000},          {38050, 32000},      {38051, 44100},
+        {45999, 44100},      {46000, 47952},      {47976, 47952},
+        {47977, 48000},      {48047, 48000},      {48048, 48048},
+        {48049, 48000},      {48150, 48000},      {48151, 48048},
+        {68124, 48048},      {68125, 88200},      {92100, 88200},
+        {92101, 96000},      {136200, 96000},     {136201, 176400},
+        {184200, 176400},    {184201, 192000},    {288000, 192000},
+        {288001, 384000},    {UINT32_MAX, 384000}
+    };
+
+    for (const auto& [frequency, expected] : cases) {
+        // When: Validating the frequency
+        FrequencyValidationResult result = validator_->validate_frequency(frequency);
+
+        // Then: The expected standard frequency is selected
+        EXPECT_EQ(result.closest_standard_frequency, expected) << "Frequency: " << frequency;
+    }
+}
+
+/**
+ * @brief Test timing policies keep counts exact and time only selected calls
+ * @requirement SYS-PERF-001: Real-time validation latency
+ * @traceability TEST-C-001-019 → DES-C-001 → SYS-PERF-001
+ */
+TEST_F(FrequencyValidatorTest, TimingPolicyCountsAndSampling) {
+    // Given: 100 validations, every other one out of tolerance
+    auto run_validations = [this]() {
+        for (uint32_t i = 0; i < 100; ++i) {
+            validator_->validate_frequency((i % 2 == 0) ? 48000 : 50000);
+        }
+    };
+    const ValidationMetrics& metrics = validator_->get_metrics();
+    EXPECT_EQ(validator_->get_timing_policy(), TimingPolicy::Always);
+
+    // When: Timing is off
+    validator_->set_timing_policy(TimingPolicy::Off);
+    validator_->reset_metrics();
+    run_validations();
+
+    // Then: Counts are exact and no latency is recorded
+    EXPECT_EQ(metrics.total_validations.load(), 100u);
+    EXPECT_EQ(metrics.successful_validations.load(), 50u);
+    EXPECT_EQ(metrics.failed_validations.load(), 50u);
+    EXPECT_EQ(metrics.timed_validations.load(), 0u);
+    EXPECT_EQ(metrics.max_latency_ns.load(), 0u);
+    EXPECT_EQ(metrics.get_average_latency_ns(), 0u);
+
+    // When: Timing is sampled (interval 10 rounds up to 16)
+    validator_->set_timing_policy(TimingPolicy::Sampled, 10);
+    validator_->reset_metrics();
+    run_validations();
+
+    // Then: Counts are exact and calls 0, 16, ..., 96 are timed
+    EXPECT_EQ(validator_->get_timing_sample_interval(), 16u);
+    EXPECT_EQ(metrics.total_validations.load(), 100u);
+    EXPECT_EQ(metrics.successful_validations.load(), 50u);
+    EXPECT_EQ(metrics.timed_validations.load(), 7u);
+
+    // When: Timing every call
+    validator_->set_timing_policy(TimingPolicy::Always);
+    validator_->reset_metrics();
+    run_validations();
+
+    // Then: Every call is timed
+    EXPECT_EQ(metrics.total_validations.load(), 100u);
+    EXPECT_EQ(metrics.timed_validations.load(), 100u);
+    EXPECT_TRUE(validator_->meets_realtime_constraints());
+
+    // And: The compile-time policy overrides the instance policy with identical results
+    validator_->reset_metrics();
+    FrequencyValidationResult result = validator_->validate_frequency<TimingPolicy::Off>(48005);
+    FrequencyValidationResult expected = validator_->validate_frequency(48005);
+    EXPECT_EQ(result.status, expected.status);
+    EXPECT_EQ(result.closest_standard_frequency, expected.closest_standard_frequency);
+    EXPECT_DOUBLE_EQ(result.tolerance_ppm, expected.tolerance_ppm);
+    EXPECT_EQ(metrics.total_validations.load(), 2u);
+    EXPECT_EQ(metrics.timed_validations.load(), 1u);
+}
+
+/**
+ * @brief Test fixed-point deviation and floating-point-free validation path
+ * @requirement AES5-CALC-001: Tolerance calculation accuracy
+ * @traceability TEST-C-001-020 → DES-C-001 → AES5-CALC-001
+ */
+TEST_F(FrequencyValidatorTest, FixedPointDeviationMatchesFloatingPoint) {
+    // Given: Signed deviations in parts per billion
+    EXPECT_EQ(FrequencyValidator::calculate_deviation_ppb(48048, 48000), 1000000LL);
+    EXPECT_EQ(FrequencyValidator::calculate_deviation_ppb(47976, 48000), -500000LL);
+    EXPECT_EQ(FrequencyValidator::calculate_deviation_ppb(48001, 48000), 20833LL);
+    EXPECT_EQ(FrequencyValidator::calculate_deviation_ppb(UINT32_MAX, 384000), 11183810664062LL);
+
+    // And: Tolerance boundary uses whole ppm like calculate_tolerance_ppm()
+    EXPECT_TRUE(FrequencyValidator::is_within_tolerance_ppb(-100999, 100));
+    EXPECT_FALSE(FrequencyValidator::is_within_tolerance_ppb(101000, 100));
+
+    // And: Precomputed table entries agree with the computed path
+    EXPECT_DOUBLE_EQ(validator_->calculate_tolerance_ppm(47999, 48000), 20.0);
+    EXPECT_DOUBLE_EQ(validator_->calculate_tolerance_ppm(47900, 48000), 2083.0);
+    EXPECT_DOUBLE_EQ(validator_->calculate_tolerance_ppm(35000, 32000), 93750.0);
+    EXPECT_DOUBLE_EQ(validator_->calculate_tolerance_ppm(40000, 44100), 92970.0);
+
+    // When: Validating a sweep through both paths
+    for (uint32_t frequency = 0; frequency < 400000; frequency += 331) {
+        FrequencyValidationResult expected = validator_->validate_frequency(frequency, 500);
+        FixedPointFrequencyResult fixed = validator_->validate_frequency_fixed(frequency, 500);
+
+        // Then: Every field matches bit for bit
+        EXPECT_EQ(fixed.status, expected.status) << "Frequency: " << frequency;
+        EXPECT_EQ(fixed.closest_standard_frequency, expected.closest_standard_frequency);
+        EXPECT_EQ(fixed.applicable_clause, expected.applicable_clause);
+        EXPECT_EQ(fixed.deviation_ppb, expected.deviation_ppb) << "Frequency: " << frequency;
+        const int64_t magnitude = (fixed.deviation_ppb < 0) ? -fixed.deviation_ppb : fixed.deviation_ppb;
+        EXPECT_EQ(expected.tolerance_ppm, static_cast<double>(magnitude / 1000)) << "Frequency: " << frequency;
+    }
+}
+
+/**
+ * @brief Test sub-Hz (Q32.32) frequency validation
+ * @requirement AES5-CALC-001: Tolerance calculation accuracy
+ * @traceability TEST-C-001-021 → DES-C-001 → AES5-CALC-001
+ */
+TEST_F(FrequencyValidatorTest, SubHzFrequencyValidation) {
+    // Given: A recovered clock of 47999.73 Hz (4799973 samples in 100 s)
+    const PreciseFrequency recovered = PreciseFrequency::from_sample_count(4799973ULL, 100000000000ULL);
+    EXPECT_EQ(recovered.rounded_hz(), 48000u);
+
+    // When: Validating at full precision
+    FrequencyValidationResult result = validator_->validate_frequency(recovered, 6);
+
+    // Then: The sub-ppm drift survives (-0.27 Hz = -5.625 ppm)
+    EXPECT_EQ(result.status, ValidationResult::Valid);
+    EXPECT_EQ(result.detected_frequency, 48000u);
+    EXPECT_EQ(result.closest_standard_frequency, 48000u);
+    EXPECT_EQ(result.applicable_clause, AES5Clause::Section_5_1);
+    EXPECT_EQ(result.deviation_ppb, -5625);
+    EXPECT_DOUBLE_EQ(result.tolerance_ppm, 5.0);
+    EXPECT_EQ(validator_->validate_frequency(recovered, 4).status, ValidationResult::OutOfTolerance);
+
+    // And: Half-Hz steps are resolved between whole-Hz neighbours
+    const PreciseFrequency half_above{(48000ULL << 32) + (1ULL << 31)};
+    EXPECT_EQ(FrequencyValidator::calculate_deviation_ppb(half_above, 48000), 10416);
+    EXPECT_EQ(FrequencyValidator::calculate_deviation_ppb(recovered, 0), INT64_MAX);
+
+    // And: Whole-Hz inputs give results identical to the uint32_t overload
+    for (uint32_t frequency = 1; frequency < 400000; frequency += 331) {
+        FrequencyValidationResult expected = validator_->validate_frequency(frequency, 500);
+        FrequencyValidationResult precise = validator_->validate_frequency(PreciseFrequency::from_hz(frequency), 500);
+        EXPECT_EQ(precise.status, expected.status) << "Frequency: " << frequency;
+        EXPECT_EQ(precise.closest_standard_frequency, expected.closest_standard_frequency);
+        EXPECT_EQ(precise.applicable_clause, expected.applicable_clause);
+        EXPECT_EQ(precise.deviation_ppb, expected.deviation_ppb) << "Frequency: " << frequency;
+        EXPECT_EQ(precise.tolerance_ppm, expected.tolerance_ppm) << "Frequency: " << frequency;
+    }
+
+    // And: Degenerate inputs are handled without overflow
+    EXPECT_EQ(validator_->validate_frequency(PreciseFrequency::from_sample_count(48000, 0)).status,
+              ValidationResult::InvalidInput);
+    const PreciseFrequency saturated = PreciseFrequency::from_sample_count(UINT64_MAX, 1);
+    EXPECT_EQ(saturated.q32_32, UINT64_MAX);
+    EXPECT_EQ(saturated.rounded_hz(), UINT32_MAX);
+    EXPECT_EQ(validator_->validate_frequency(saturated).status, ValidationResult::OutOfTolerance);
+
+    // And: Same latency budget as the whole-Hz overload
+    measure_performance([&]() {
+        validator_->validate_frequency(recovered);
+    }, "Sub-Hz frequency validation",
+       std::chrono::nanoseconds(FrequencyValidator::MAX_VALIDATION_LATENCY_NS));
+}
+
+/**
+ * @brief Test latency is measured with the ValidationCore clock source
+ * @requirement SYS-PERF-001: Low-overhead latency measurement
+ * @traceability TEST-C-001-022 → DES-C-001 → SYS-PERF-001
+ */
+TEST_F(FrequencyValidatorTest, LatencyUsesValidationCoreClockSource) {
+    // Given: A ValidationCore whose clock advances 250 ns per read
+    auto core = std::make_unique<ValidationCore>();
+    uint64_t fake_now = 0;
+    core->set_clock_source(ClockSource::injected([](void* context) noexcept {
+        auto* now = static_cast<uint64_t*>(context);
+        return *now += 250;
+    }, &fake_now));
+    auto validator = FrequencyValidator::create(std::make_unique<ComplianceEngine>(), std::move(core));
+    ASSERT_NE(validator, nullptr);
+    validator->set_timing_policy(TimingPolicy::Always);
+
+    // When: Validating singly and in a batch
+    for (int i = 0; i < 4; ++i) {
+        validator->validate_frequency(48000);
+    }
+    const uint32_t frequencies[] = {48000, 44100, 96000, 12345};
+    ValidationResult status[4];
+    uint32_t closest[4];
+    double ppm[4];
+    validator->validate_frequency_batch(frequencies, 4, {status, closest, ppm, nullptr});
+
+    // Then: Every measured interval is exactly one clock step
+    EXPECT_EQ(validator->get_metrics().total_validations.load(), 8u);
+    EXPECT_EQ(validator->get_metrics().total_latency_ns.load(), 5u * 250u);
+    EXPECT_EQ(validator->get_metrics().max_latency_ns.load(), 250u);
+}
+
+/**
+ * @brief Test the flight recorder keeps the last events and freezes on failure
+ * @requirement SYS-REAL-TIME-001: Post-mortem analysis without allocation on the audio path
+ * @traceability TEST-C-001-023 → DES-C-001, DES-C-005 → SYS-REAL-TIME-001
+ */
+TEST_F(FrequencyValidatorTest, FlightRecorderCapturesEventsUpToFirstFailure) {
+    // Given: A validator whose core records into an 8-event ring that
+    // freezes on the first failure; the clock advances 100 ticks per read
+    static FlightRecorderStorage<8> recorder;
+    recorder.clear();
+    recorder.resume();
+    recorder.set_freeze_on_failure(true);
+    auto core = std::make_unique<ValidationCore>();
+    uint64_t fake_now = 0;
+    core->set_clock_source(ClockSource::injected([](void* context) noexcept {
+        auto* now = static_cast<uint64_t*>(context);
+        return *now += 100;
+    }, &fake_now));
+    const ClockSource clock = core->get_clock_source();
+    core->attach_flight_recorder(&recorder);
+    auto validator = FrequencyValidator::create(std::make_unique<ComplianceEngine>(), std::move(core));
+    ASSERT_NE(validator, nullptr);
+    validator->set_timing_policy(TimingPolicy::Always);
+
+    // When: Twelve valid validations, one failure, then more traffic
+    for (uint32_t i = 0; i < 12; ++i) {
+        validator->validate_frequency(i % 2 ? 44100 : 48000);
+    }
+    validator->validate_frequency(47900);
+    EXPECT_TRUE(recorder.is_frozen());
+    validator->validate_frequency(96000);
+    validator->validate_frequency(47900);
+
+    // Then: The ring holds the last 8 events before the freeze, oldest first
+    EXPECT_EQ(recorder.total_recorded(), 13u);
+    EXPECT_EQ(validator->get_metrics().total_validations.load(), 15u);
+    FlightEvent events[8];
+    ASSERT_EQ(recorder.snapshot(events, 8), 8u);
+    EXPECT_EQ(events[0].sequence, 6u);
+    EXPECT_EQ(events[0].frequency_hz, 44100u);
+    const FlightEvent& failure = events[7];
+    EXPECT_EQ(failure.sequence, 13u);
+    EXPECT_EQ(failure.frequency_hz, 47900u);
+    EXPECT_EQ(failure.closest_standard_hz, 47952u);       // 48 kHz / 1.001
+    EXPECT_EQ(failure.deviation_ppb, -1084417);
+    EXPECT_NEAR(failure.deviation_ppm(), -1084.417, 0.001);
+    EXPECT_EQ(failure.result, ValidationResult::OutOfTolerance);
+    EXPECT_EQ(failure.latency_ns, 100u);
+    EXPECT_EQ(failure.timestamp_ticks, 2500u);    // 13th validation starts at the 25th clock read
+    for (size_t i = 0; i < 7; ++i) {
+        EXPECT_EQ(events[i].result, ValidationResult::Valid);
+        EXPECT_EQ(events[i + 1].timestamp_ticks - events[i].timestamp_ticks, 200u);
+    }
+
+    // And: A dump reads back identically with the clock description
+    const std::string path = ::testing::TempDir() + "aes5_flight_record_test.bin";
+    ASSERT_TRUE(recorder.dump(path.c_str(), clock));
+    FlightRecordHeader header;
+    FlightEvent loaded[8];
+    ASSERT_EQ(FlightRecorder::read_dump(path.c_str(), &header, loaded, 8), 8u);
+    EXPECT_EQ(header.event_count, 8u);
+    EXPECT_EQ(header.frozen, 1u);
+    EXPECT_EQ(header.clock_kind, static_cast<uint32_t>(ClockSourceKind::Injected));
+    for (size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(loaded[i].sequence, events[i].sequence);
+        EXPECT_EQ(loaded[i].timestamp_ticks, events[i].timestamp_ticks);
+        EXPECT_EQ(loaded[i].frequency_hz, events[i].frequency_hz);
+        EXPECT_EQ(loaded[i].deviation_ppb, events[i].deviation_ppb);
+        EXPECT_EQ(loaded[i].result, events[i].result);
+    }
+    std::remove(path.c_str());
+    EXPECT_EQ(FlightRecorder::read_dump(path.c_str(), nullptr, loaded, 8), 0u);
+
+    // And: Untimed validations record a timestamp but no latency after resuming
+    recorder.resume();
+    validator->set_timing_policy(TimingPolicy::Off);
+    validator->validate_frequency(96000);
+    ASSERT_EQ(recorder.snapshot(events, 1), 1u);
+    EXPECT_EQ(events[0].frequency_hz, 96000u);
+    EXPECT_EQ(events[0].latency_ns, 0u);
+    EXPECT_EQ(events[0].timestamp_ticks, fake_now);
+
+    // And: Invalid input is recorded and freezes the ring; batches are not recorded
+    const uint32_t batch[] = {48000, 47900};
+    ValidationResult batch_status[2];
+    uint32_t batch_closest[2];
+    double batch_ppm[2];
+    EXPECT_EQ(validator->validate_frequency_batch(batch, 2, {batch_status, batch_closest, batch_ppm, nullptr}), 1u);
+    EXPECT_FALSE(recorder.is_frozen());
+    validator->validate_frequency(0);
+    EXPECT_TRUE(recorder.is_frozen());
+    ASSERT_EQ(recorder.snapshot(events, 8), 8u);
+    EXPECT_EQ(events[6].frequency_hz, 96000u);
+    EXPECT_EQ(events[7].frequency_hz, 0u);
+    EXPECT_EQ(events[7].result, ValidationResult::InvalidInput);
+    EXPECT_EQ(events[7].timestamp_ticks, fake_now);
+}
+
+/**
+ * @brief Test the constexpr engine decides like the runtime validator
+ * @requirement REQ-F-002: Standard frequency identification at compile time
+ * @traceability TEST-C-001-024 → DES-C-001 → REQ-F-002
+ */
+TEST_F(FrequencyValidatorTest, CompileTimeEngineMatchesRuntimeValidation) {
+    namespace ct = AES::AES5::_2018::core::compile_time;
+
+    // Given: Rates checked entirely at compile time
+    static_assert(ct::is_aes5_frequency_v<48000>, "48 kHz is primary");
+    static_assert(ct::is_aes5_frequency_v<44101>, "44.101 kHz is within 100 ppm of 44.1 kHz");
+    static_assert(!ct::is_aes5_frequency_v<44200>, "44.2 kHz is not a standard rate");
+    static_assert(ct::is_aes5_frequency_v<44105, 200> && !ct::is_aes5_frequency_v<44105, 100>,
+                  "Tolerance is a template parameter");
+    static_assert(ct::check_frequency(48048).applicable_clause == AES5Clause::Annex_A, "Pull-up is Annex A");
+    static_assert(ct::check_frequency(0).status == ValidationResult::InvalidInput, "0 Hz is invalid");
+
+    // When/Then: Runtime and constexpr results agree across 8 kHz..400 kHz,
+    // including every capture boundary region
+    for (uint32_t frequency = 8000; frequency <= 400000; frequency += 7) {
+        const auto expected = ct::check_frequency(frequency, 100);
+        const auto result = validator_->validate_frequency(frequency, 100);
+        ASSERT_EQ(result.status, expected.status) << "Frequency: " << frequency;
+        ASSERT_EQ(result.closest_standard_frequency, expected.closest_standard_frequency);
+        ASSERT_EQ(result.deviation_ppb, expected.deviation_ppb);
+        ASSERT_EQ(result.applicable_clause, expected.applicable_clause);
+        ASSERT_EQ(result.tolerance_ppm, static_cast<double>(expected.deviation_ppm()));
+        ASSERT_EQ(validator_->find_closest_standard_frequency(frequency), ct::closest_standard_frequency(frequency));
+    }
+}
+
+/**
+ * @brief Test the value-type validator matches FrequencyValidator without allocating
+ * @requirement SYS-PERF-001: Allocation-free per-connection validation
+ * @traceability TEST-C-001-025 → DES-C-001 → SYS-PERF-001
+ */
+TEST_F(FrequencyValidatorTest, InlineValidatorMatchesHeapValidator) {
+    // Given: Value-type validators with each metrics policy, and a shared core
+    ValidationCore shared_core;
+    InlineFrequencyValidator<> plain;
+    InlineFrequencyValidator<LocalCountersPolicy> counting(50);
+    InlineFrequencyValidator<SharedCorePolicy> forwarding(100, SharedCorePolicy{&shared_core});
+    static_assert(std::is_trivially_copyable<InlineFrequencyValidator<SharedCorePolicy>>::value,
+                  "Value validators are plain values");
+
+    // When/Then: Every result equals the heap-allocated validator's
+    const uint32_t frequencies[] = {0, 32000, 44100, 44105, 47900, 47952, 48000, 48004, 48100, 96000, 384000, 500000};
+    for (uint32_t frequency : frequencies) {
+        const auto expected = validator_->validate_frequency(frequency, 100);
+        const auto result = plain.validate_frequency(frequency);
+        EXPECT_EQ(result.status, expected.status) << "Frequency: " << frequency;
+        EXPECT_EQ(result.closest_standard_frequency, expected.closest_standard_frequency);
+        EXPECT_EQ(result.deviation_ppb, expected.deviation_ppb);
+        EXPECT_EQ(result.tolerance_ppm, expected.tolerance_ppm);
+        EXPECT_EQ(result.applicable_clause, expected.applicable_clause);
+        EXPECT_EQ(counting.validate_frequency(frequency).status, validator_->validate_frequency(frequency, 50).status);
+        forwarding.validate_frequency(frequency);
+    }
+
+    // And: Policies count like ValidationCore (0 Hz is rejected unrecorded)
+    EXPECT_EQ(counting.metrics().total_validations(), 11u);
+    EXPECT_EQ(counting.metrics().successful_validations(), 6u);
+    EXPECT_EQ(counting.metrics().failed_validations(), 5u);
+    EXPECT_EQ(shared_core.get_metrics().total_validations.load(), 11u);
+    EXPECT_EQ(shared_core.get_metrics().successful_validations.load(), 7u);
+
+    // And: Copies are independent values
+    auto copy = counting;
+    copy.set_tolerance_ppm(5000);
+    EXPECT_TRUE(copy.is_valid_frequency(47900));
+    EXPECT_EQ(copy.metrics().total_validations(), 12u);
+    EXPECT_EQ(counting.metrics().total_validations(), 11u);
+    EXPECT_EQ(counting.get_tolerance_ppm(), 50u);
+}
+
 /**
  * @brief Document expected FrequencyValidator interface
  * @traceability TEST-C-001-015 → DES-C-001
@@ -0,0 +1,224 @@
+// Test file for MetricsShmExporter and MetricsShmReader (shared-memory metrics export)
+// Traceability: DES-C-005, DES-C-010 → TEST-MONITOR
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "AES/AES5/2018/core/monitoring/metrics_shm_exporter.hpp"
+#include "AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core::monitoring;
+using namespace AES::AES5::_2018::core::validation;
+
+namespace {
+
+ValidationResult accept_all(uint32_t, void*) noexcept { return ValidationResult::Valid; }
+ValidationResult reject_all(uint32_t, void*) noexcept { return ValidationResult::OutOfTolerance; }
+
+} // namespace
+
+/**
+ * @brief Test fixture for shared-memory metrics export
+ * @traceability TEST-MONITOR → DES-C-005, DES-C-010
+ */
+class MetricsShmExporterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Unique per process so parallel test runs do not collide
+        segment_name_ = "/aes5_metrics_test_" + std::to_string(getpid());
+    }
+
+    std::string segment_name_;
+};
+
+/**
+ * @brief Test counters and histogram reach a reader in the same layout
+ * @traceability TEST-MONITOR-001 → DES-C-005, DES-C-010
+ * @requirement Monitoring agents read live metrics without linking the engine
+ */
+TEST_F(MetricsShmExporterTest, PublishedMetricsRoundTripThroughSegment) {
+    // Given: Two cores, one with a histogram, registered with an exporter
+    auto exporter = MetricsShmExporter::create(segment_name_.c_str(), 4);
+    ASSERT_NE(exporter, nullptr);
+    EXPECT_EQ(exporter->capacity(), 4u);
+    EXPECT_STREQ(exporter->segment_name(), segment_name_.c_str());
+
+    ValidationCore input;
+    ValidationCore output;
+    LatencyHistogram histogram;
+    input.attach_latency_histogram(&histogram);
+    input.set_snapshot_sequencing(true);
+
+    const int input_slot = exporter->register_core(&input, "input-0");
+    const int output_slot = exporter->register_core(&output, "output \"main\"");
+    ASSERT_EQ(input_slot, 0);
+    ASSERT_EQ(output_slot, 1);
+
+    for (int i = 0; i < 50; ++i) {
+        input.validate(48000, accept_all);
+    }
+    for (int i = 0; i < 5; ++i) {
+        input.validate(48000, reject_all);
+    }
+    output.record_validation(ValidationResult::Valid, 1000);
+
+    // When: Publishing and reading from a separate mapping
+    EXPECT_EQ(exporter->publish(), 2u);
+    auto reader = MetricsShmReader::open(segment_name_.c_str());
+    ASSERT_NE(reader, nullptr);
+
+    // Then: The reader sees exactly the cores' snapshots
+    EXPECT_EQ(reader->slot_capacity(), 4u);
+    EXPECT_EQ(reader->publish_count(), 1u);
+    EXPECT_EQ(reader->exporter_pid(), static_cast<uint64_t>(getpid()));
+
+    ShmCoreRecord record;
+    ASSERT_TRUE(reader->read_slot(0, record));
+    const MetricsSnapshot expected = input.get_metrics_snapshot();
+    EXPECT_STREQ(record.name, "input-0");
+    EXPECT_EQ(record.metrics.total_validations, 55u);
+    EXPECT_EQ(record.metrics.successful_validations, 50u);
+    EXPECT_EQ(record.metrics.failed_validations, 5u);
+    EXPECT_EQ(record.metrics.total_latency_ns, expected.total_latency_ns);
+    EXPECT_TRUE(record.metrics.consistent);
+    ASSERT_TRUE(record.has_histogram);
+    uint64_t histogram_total = 0;
+    for (uint64_t count : record.histogram) {
+        histogram_total += count;
+    }
+    EXPECT_EQ(histogram_total, histogram.total_count());
+    EXPECT_EQ(record.latency_percentile_ns(99.0), histogram.value_at_percentile(99.0));
+
+    ASSERT_TRUE(reader->read_slot(1, record));
+    EXPECT_STREQ(record.name, "output \"main\"");
+    EXPECT_EQ(record.metrics.total_validations, 1u);
+    EXPECT_EQ(record.metrics.total_latency_ns, 1000u);
+    EXPECT_FALSE(record.has_histogram);
+    EXPECT_EQ(record.latency_percentile_ns(99.0), 0u);
+
+    // And: Later publishes update the same mapping in place
+    output.record_validation(ValidationResult::OutOfTolerance, 3000);
+    exporter->publish();
+    ASSERT_TRUE(reader->read_slot(1, record));
+    EXPECT_EQ(record.metrics.total_validations, 2u);
+    EXPECT_EQ(record.metrics.failed_validations, 1u);
+    EXPECT_EQ(record.metrics.max_latency_ns, 3000u);
+    EXPECT_EQ(reader->publish_count(), 2u);
+}
+
+/**
+ * @brief Test slot allocation, release and argument validation
+ * @traceability TEST-MONITOR-002 → DES-C-005, DES-C-010
+ * @requirement Exporter never allocates after create and fails by return value
+ */
+TEST_F(MetricsShmExporterTest, SlotsAreReusedAndInvalidArgumentsRejected) {
+    // Given: A two-slot exporter
+    auto exporter = MetricsShmExporter::create(segment_name_.c_str(), 2);
+    ASSERT_NE(exporter, nullptr);
+    ValidationCore first;
+    ValidationCore second;
+    ValidationCore third;
+
+    // When/Then: Arguments are validated and capacity is enforced
+    EXPECT_EQ(exporter->register_core(nullptr, "none"), -1);
+    EXPECT_EQ(exporter->register_core(&first, nullptr), -1);
+    EXPECT_EQ(exporter->register_core(&first, "first"), 0);
+    EXPECT_EQ(exporter->register_core(&second, "second"), 1);
+    EXPECT_EQ(exporter->register_core(&third, "third"), -1);
+
+    EXPECT_FALSE(exporter->unregister_core(-1));
+    EXPECT_FALSE(exporter->unregister_core(2));
+
+    // When: Releasing a slot
+    EXPECT_TRUE(exporter->unregister_core(0));
+    EXPECT_FALSE(exporter->unregister_core(0));
+    EXPECT_EQ(exporter->publish(), 1u);
+
+    // Then: Readers see it as free, and it is handed out again
+    auto reader = MetricsShmReader::open(segment_name_.c_str());
+    ASSERT_NE(reader, nullptr);
+    ShmCoreRecord record;
+    EXPECT_FALSE(reader->read_slot(0, record));
+    EXPECT_FALSE(reader->read_slot(2, record));
+
+    std::string long_name(100, 'x');
+    EXPECT_EQ(exporter->register_core(&third, long_name.c_str()), 0);
+    ASSERT_TRUE(reader->read_slot(0, record));
+    EXPECT_EQ(std::strlen(record.name), SHM_NAME_CAPACITY - 1);
+    EXPECT_EQ(record.metrics.total_validations, 0u);
+
+    // And: Malformed segment names are rejected without touching shm
+    EXPECT_EQ(MetricsShmExporter::create(nullptr), nullptr);
+    EXPECT_EQ(MetricsShmExporter::create("no_leading_slash"), nullptr);
+    EXPECT_EQ(MetricsShmExporter::create("/nested/name"), nullptr);
+    EXPECT_EQ(MetricsShmReader::open("/"), nullptr);
+}
+
+/**
+ * @brief Test readers only open live segments; exporters only replace dead ones
+ * @traceability TEST-MONITOR-003 → DES-C-005, DES-C-010
+ * @requirement Stale or missing segments are reported, not misread
+ */
+TEST_F(MetricsShmExporterTest, ReaderRequiresLiveSegment) {
+    // Given: No segment exists yet
+    EXPECT_EQ(MetricsShmReader::open(segment_name_.c_str()), nullptr);
+
+    // When: An exporter creates one
+    {
+        auto exporter = MetricsShmExporter::create(segment_name_.c_str());
+        ASSERT_NE(exporter, nullptr);
+        EXPECT_EQ(exporter->capacity(), MetricsShmExporter::DEFAULT_CAPACITY);
+        auto reader = MetricsShmReader::open(segment_name_.c_str());
+        ASSERT_NE(reader, nullptr);
+        EXPECT_EQ(reader->publish_count(), 0u);
+
+        // And: A second exporter cannot take over the live segment
+        EXPECT_EQ(MetricsShmExporter::create(segment_name_.c_str(), 1), nullptr);
+        auto same_reader = MetricsShmReader::open(segment_name_.c_str());
+        ASSERT_NE(same_reader, nullptr);
+        EXPECT_EQ(same_reader->slot_capacity(), MetricsShmExporter::DEFAULT_CAPACITY);
+    }
+
+    // Then: Destroying the exporter unlinks the segment
+    EXPECT_EQ(MetricsShmReader::open(segment_name_.c_str()), nullptr);
+
+    // Given: A segment left behind by an exporter process that died
+    const pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        auto crashed = MetricsShmExporter::create(segment_name_.c_str(), 2);
+        _exit(crashed != nullptr ? 0 : 1);   // Skips the destructor, like a crash
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    auto stale_reader = MetricsShmReader::open(segment_name_.c_str());
+    ASSERT_NE(stale_reader, nullptr);
+    EXPECT_EQ(stale_reader->exporter_pid(), static_cast<uint64_t>(child));
+
+    // When: A new exporter starts under the same name
+    auto replacement = MetricsShmExporter::create(segment_name_.c_str(), 1);
+
+    // Then: It replaces the stale segment; old readers keep their copy
+    ASSERT_NE(replacement, nullptr);
+    auto replacement_reader = MetricsShmReader::open(segment_name_.c_str());
+    ASSERT_NE(replacement_reader, nullptr);
+    EXPECT_EQ(replacement_reader->slot_capacity(), 1u);
+    EXPECT_EQ(replacement_reader->exporter_pid(), static_cast<uint64_t>(getpid()));
+    EXPECT_EQ(stale_reader->slot_capacity(), 2u);
+    replacement.reset();
+
+    // And: A segment that is not an initialized metrics segment is left alone
+    const int fd = shm_open(segment_name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    EXPECT_EQ(MetricsShmExporter::create(segment_name_.c_str()), nullptr);
+    EXPECT_EQ(shm_unlink(segment_name_.c_str()), 0);
+}
@@ -0,0 +1,147 @@
+// Test file for ParallelValidationEngine and WorkStealingPool (DES-C-005 parallel batch validation)
+// Traceability: DES-C-001, DES-C-003, DES-C-005 → TEST-PARALLEL
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "AES/AES5/2018/core/parallel/parallel_validation_engine.hpp"
+#include "AES/AES5/2018/core/compliance/compliance_engine.hpp"
+#include "AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core::parallel;
+using namespace AES::AES5::_2018::core::frequency_validation;
+using namespace AES::AES5::_2018::core::rate_categories;
+using namespace AES::AES5::_2018::core::compliance;
+using namespace AES::AES5::_2018::core::validation;
+
+/**
+ * @brief Test fixture for ParallelValidationEngine
+ * @traceability TEST-PARALLEL → DES-C-001, DES-C-003, DES-C-005
+ */
+class ParallelValidationEngineTest : public ::testing::Test {
+protected:
+    static std::unique_ptr<FrequencyValidator> make_validator() {
+        return FrequencyValidator::create(std::make_unique<ComplianceEngine>(),
+                                          std::make_unique<ValidationCore>());
+    }
+
+    static std::unique_ptr<ParallelValidationEngine> make_engine(size_t workers, size_t chunk_size) {
+        return ParallelValidationEngine::create(
+            make_validator(),
+            RateCategoryManager::create(std::make_unique<ValidationCore>()),
+            workers, chunk_size);
+    }
+};
+
+/**
+ * @brief Test the pool runs every chunk exactly once with several workers
+ * @traceability TEST-PARALLEL-001 → DES-C-005
+ */
+TEST_F(ParallelValidationEngineTest, PoolRunsEveryChunkExactlyOnce) {
+    // Given: A four-worker pool and a per-chunk execution counter
+    auto pool = WorkStealingPool::create(4);
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(pool->worker_count(), 4u);
+
+    struct Job {
+        std::vector<std::atomic<int>> executions;
+        std::atomic<bool> bad_worker{false};
+        size_t worker_count;
+        explicit Job(size_t chunks, size_t workers) : executions(chunks), worker_count(workers) {}
+    };
+    Job job(10007, pool->worker_count());
+
+    // When: Running the same pool several times
+    for (int round = 0; round < 3; ++round) {
+        pool->run(job.executions.size(), [](void* context, size_t chunk, size_t worker) {
+            auto* j = static_cast<Job*>(context);
+            j->executions[chunk].fetch_add(1);
+            if (worker >= j->worker_count) {
+                j->bad_worker = true;
+            }
+        }, &job);
+    }
+
+    // Then: Every chunk ran once per round on a valid worker index
+    for (size_t chunk = 0; chunk < job.executions.size(); ++chunk) {
+        ASSERT_EQ(job.executions[chunk].load(), 3) << "Chunk " << chunk;
+    }
+    EXPECT_FALSE(job.bad_worker.load());
+}
+
+/**
+ * @brief Test per-element results match the single-call APIs and never stop early
+ * @traceability TEST-PARALLEL-002 → DES-C-001, DES-C-003, DES-C-005
+ */
+TEST_F(ParallelValidationEngineTest, ReportsEveryElementLikeSingleCalls) {
+    // Given: An array with failures spread throughout and a partial last chunk
+    auto engine = make_engine(3, 256);
+    ASSERT_NE(engine, nullptr);
+    auto reference = make_validator();
+    auto reference_categories = RateCategoryManager::create(std::make_unique<ValidationCore>());
+
+    const uint32_t rates[] = {48000, 0, 44100, 48010, 96000, 50000, 192000, 11025, 384000, 47999, 1000000};
+    std::vector<uint32_t> frequencies(256 * 40 + 77);
+    for (size_t i = 0; i < frequencies.size(); ++i) {
+        frequencies[i] = rates[i % 11];
+    }
+
+    // When: Validating in parallel
+    ParallelValidationReport report;
+    ASSERT_TRUE(engine->validate(frequencies.data(), frequencies.size(), report, 50));
+
+    // Then: Every element matches validate_frequency() and get_rate_category()
+    ASSERT_EQ(report.size(), frequencies.size());
+    size_t expected_valid = 0;
+    std::array<size_t, RATE_CATEGORY_COUNT> expected_counts{};
+    for (size_t i = 0; i < frequencies.size(); ++i) {
+        FrequencyValidationResult expected = reference->validate_frequency(frequencies[i], 50);
+        ASSERT_EQ(report.status[i], expected.status) << "Element " << i;
+        EXPECT_EQ(report.closest_standard_frequency[i], expected.closest_standard_frequency);
+        EXPECT_DOUBLE_EQ(report.deviation_ppm[i], expected.tolerance_ppm);
+        EXPECT_EQ(report.applicable_clause[i], expected.applicable_clause);
+        RateCategory category = reference_categories->get_rate_category(frequencies[i]);
+        EXPECT_EQ(report.category[i], category);
+        expected_valid += expected.is_valid() ? 1 : 0;
+        ++expected_counts[static_cast<size_t>(category)];
+    }
+
+    // And: Merged tallies and metrics cover the whole array
+    EXPECT_EQ(report.valid_count, expected_valid);
+    EXPECT_EQ(report.category_counts, expected_counts);
+    EXPECT_EQ(report.classified_count,
+              frequencies.size() - expected_counts[static_cast<size_t>(RateCategory::Unknown)]);
+    EXPECT_EQ(report.chunk_count, 41u);
+    const size_t zero_count = static_cast<size_t>(std::count(frequencies.begin(), frequencies.end(), 0u));
+    EXPECT_EQ(engine->get_validator().get_metrics().total_validations.load(), frequencies.size() - zero_count);
+    EXPECT_EQ(engine->get_rate_category_manager().get_metrics().total_validations.load(), frequencies.size());
+}
+
+/**
+ * @brief Test argument handling and empty input
+ * @traceability TEST-PARALLEL-003 → DES-C-005
+ */
+TEST_F(ParallelValidationEngineTest, RejectsInvalidArguments) {
+    // Given/When: Missing dependencies or zero chunk size
+    auto no_validator = ParallelValidationEngine::create(
+        nullptr, RateCategoryManager::create(std::make_unique<ValidationCore>()), 2);
+    auto zero_chunk = make_engine(2, 0);
+
+    // Then: Creation fails
+    EXPECT_EQ(no_validator, nullptr);
+    EXPECT_EQ(zero_chunk, nullptr);
+
+    // And: Null input is rejected, empty input yields an empty report
+    auto engine = make_engine(2, 64);
+    ASSERT_NE(engine, nullptr);
+    ParallelValidationReport report;
+    EXPECT_FALSE(engine->validate(nullptr, 10, report));
+    ASSERT_TRUE(engine->validate(nullptr, 0, report));
+    EXPECT_EQ(report.size(), 0u);
+    EXPECT_EQ(report.valid_count, 0u);
+    EXPECT_EQ(report.chunk_count, 0u);
+}
@@ -12,8 +12,14 @@
 #include <vector>
 #include <chrono>
 #include <thread>
+#include <atomic>
 
+#include "AES/AES5/2018/core/compile_time/aes5_compile_time.hpp"
+#include "AES/AES5/2018/core/rate_categories/inline_rate_category_manager.hpp"
+#include "AES/AES5/2018/core/rate_categories/period_sizing.hpp"
 #include "AES/AES5/2018/core/rate_categories/rate_category_manager.hpp"
+#include "AES/AES5/2018/core/rate_categories/rate_category_table.hpp"
+#include "AES/AES5/2018/core/simd/cpu_features.hpp"
 #include "AES/AES5/2018/core/validation/validation_core.hpp"
 
 using namespace AES::AES5::_2018::core::rate_categories;
@@ -374,9 +380,9 @@ TEST_F(RateCategoryManagerTest, ThreadSafetyValidation) {
     
     std::vector<std::thread> threads;
     
-    // Use unique frequencies to avoid cache hits (cache skips metrics increment)
+    // Unique frequencies per thread: every call misses the classification
+    // cache and goes through the timed ValidationCore path
     // Generate frequencies: 31000 + (thread_id * 1000) + iteration
-    // This ensures each call increments the metrics counter
     
     // When: Multiple threads perform concurrent classifications
     for (size_t t = 0; t < num_threads; ++t) {
@@ -400,7 +406,6 @@ TEST_F(RateCategoryManagerTest, ThreadSafetyValidation) {
     }
     
     // Then: Metrics should reflect all operations
-    // With unique frequencies, cache is bypassed and all operations increment counter
     const auto& metrics = rate_manager_->get_metrics();
     size_t expected_count = num_threads * classifications_per_thread;
     size_t actual_count = metrics.total_validations.load();
@@ -431,6 +436,348 @@ TEST_F(RateCategoryManagerTest, MemoryFootprintValidation) {
     EXPECT_GT(footprint, 100) << "Memory footprint seems too small";
 }
 
+/**
+ * @brief Test batch classification matches single-call classification
+ * @requirement AES5-PERF-003: Rate classification performance
+ * @traceability TEST-C-003-014 → DES-C-003 → AES5-PERF-003
+ */
+TEST_F(RateCategoryManagerTest, BatchClassificationMatchesSingleCall) {
+    // Given: Frequencies across every category boundary
+    std::vector<uint32_t> frequencies;
+    for (uint32_t frequency = 0; frequency <= 440000; frequency += 250) {
+        frequencies.push_back(frequency);
+    }
+    frequencies.push_back(44100);
+    frequencies.push_back(352800);
+
+    // When: Classifying the whole array at once
+    std::vector<RateCategory> categories(frequencies.size());
+    size_t classified = rate_manager_->classify_rate_category_batch(
+        frequencies.data(), frequencies.size(), categories.data());
+
+    // Then: Metrics are recorded once for the whole batch
+    EXPECT_EQ(rate_manager_->get_metrics().total_validations.load(), frequencies.size());
+    EXPECT_EQ(rate_manager_->get_metrics().successful_validations.load(), classified);
+
+    // And: Every element matches classify_rate_category()
+    size_t expected_classified = 0;
+    for (size_t i = 0; i < frequencies.size(); ++i) {
+        RateCategory expected = rate_manager_->get_rate_category(frequencies[i]);
+        EXPECT_EQ(categories[i], expected) << "Frequency: " << frequencies[i];
+        expected_classified += (expected != RateCategory::Unknown) ? 1 : 0;
+    }
+    EXPECT_EQ(classified, expected_classified);
+
+    // And: Invalid parameters are rejected
+    EXPECT_EQ(rate_manager_->classify_rate_category_batch(nullptr, 4, categories.data()), 0u);
+    EXPECT_EQ(rate_manager_->classify_rate_category_batch(frequencies.data(), 4, nullptr), 0u);
+}
+
+/**
+ * @brief Test every SIMD batch kernel matches single-call classification
+ * @requirement AES5-PERF-003: Rate classification performance
+ * @traceability TEST-C-003-020 → DES-C-003 → AES5-PERF-003
+ */
+TEST_F(RateCategoryManagerTest, SimdBatchKernelsMatchSingleCall) {
+    namespace simd = AES::AES5::_2018::core::simd;
+
+    // Given: Every segment edge, the common rates and extreme values, in an
+    // odd-sized array so each kernel also runs its scalar tail
+    std::vector<uint32_t> frequencies = {0, 1, 44100, 88200, 176400, 352800, 0x7FFFFFFFu, 0x80000000u, UINT32_MAX};
+    for (const auto& bounds : RATE_CATEGORY_BOUNDS) {
+        for (uint32_t edge : {bounds.min_hz, bounds.max_hz}) {
+            frequencies.insert(frequencies.end(), {edge - 1, edge, edge + 1});
+        }
+    }
+    for (uint32_t frequency = 3; frequency < 500000; frequency += 613) {
+        frequencies.push_back(frequency);
+    }
+    const size_t count = frequencies.size();
+
+    for (auto level : {simd::SimdLevel::Scalar, simd::SimdLevel::SSE2,
+                       simd::SimdLevel::AVX2, simd::SimdLevel::AVX512}) {
+        simd::set_max_simd_level(level);
+        std::vector<RateCategory> categories(count, RateCategory::Quarter);
+        std::vector<double> multipliers(count, -1.0);
+
+        // When: Classifying the whole array with the kernel for this level
+        size_t classified = rate_manager_->classify_rate_category_batch(
+            frequencies.data(), count, RateCategoryBatchResults{categories.data(), multipliers.data()});
+
+        // Then: Every element matches classify_rate_category()
+        size_t expected_classified = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const auto expected = rate_manager_->classify_rate_category(frequencies[i]);
+            ASSERT_EQ(categories[i], expected.category)
+                << simd::to_string(simd::get_active_simd_level()) << " frequency: " << frequencies[i];
+            ASSERT_EQ(multipliers[i], expected.multiplier)
+                << simd::to_string(simd::get_active_simd_level()) << " frequency: " << frequencies[i];
+            expected_classified += expected.is_valid() ? 1 : 0;
+        }
+        EXPECT_EQ(classified, expected_classified);
+    }
+    simd::set_max_simd_level(simd::SimdLevel::AVX512);
+
+    // And: Multipliers are optional, categories are not
+    std::vector<RateCategory> categories(count);
+    EXPECT_GT(rate_manager_->classify_rate_category_batch(
+        frequencies.data(), count, RateCategoryBatchResults{categories.data(), nullptr}), 0u);
+    EXPECT_EQ(rate_manager_->classify_rate_category_batch(
+        frequencies.data(), count, RateCategoryBatchResults{nullptr, nullptr}), 0u);
+}
+
+/**
+ * @brief Test the constexpr engine classifies like the runtime manager
+ * @requirement AES5-MULTIPLIER-CALC: Rate category and multiplier at compile time
+ * @traceability TEST-C-003-015 → DES-C-003 → AES5-MULTIPLIER-CALC
+ */
+TEST_F(RateCategoryManagerTest, CompileTimeEngineMatchesRuntimeClassification) {
+    namespace ct = AES::AES5::_2018::core::compile_time;
+
+    // Given: Categories resolved at compile time
+    static_assert(ct::rate_category_v<48000> == RateCategory::Basic, "48 kHz is basic rate");
+    static_assert(ct::rate_category_v<192000> == RateCategory::Quadruple, "192 kHz is quadruple rate");
+    static_assert(ct::rate_category_v<60000> == RateCategory::Unknown, "60 kHz is between categories");
+    static_assert(ct::rate_multiplier(24000) == 0.5, "24 kHz is half the base rate");
+
+    // When/Then: Runtime results agree at every category edge and across the range
+    std::vector<uint32_t> frequencies = {0};
+    for (const auto& bounds : RATE_CATEGORY_BOUNDS) {
+        for (uint32_t edge : {bounds.min_hz, bounds.max_hz}) {
+            frequencies.insert(frequencies.end(), {edge - 1, edge, edge + 1});
+        }
+    }
+    for (uint32_t frequency = 0; frequency <= 512000; frequency += 250) {
+        frequencies.push_back(frequency);
+    }
+    for (uint32_t frequency : frequencies) {
+        const auto result = rate_manager_->classify_rate_category(frequency);
+        ASSERT_EQ(result.category, ct::classify_rate_category(frequency)) << "Frequency: " << frequency;
+        ASSERT_EQ(result.multiplier, ct::rate_multiplier(frequency)) << "Frequency: " << frequency;
+    }
+}
+
+/**
+ * @brief Test the O(1) boundary table against the category ranges for every Hz
+ * @requirement AES5-MULTIPLIER-CALC: Rate category classification for any integer frequency
+ * @traceability TEST-C-003-018 → DES-C-003 → AES5-MULTIPLIER-CALC
+ */
+TEST_F(RateCategoryManagerTest, BoundaryTableMatchesRangesForEveryFrequency) {
+    namespace detail = AES::AES5::_2018::core::rate_categories::detail;
+
+    // Given: The table stays small enough to live in L1
+    EXPECT_LT(sizeof(detail::RATE_BUCKET_TABLE) + sizeof(detail::RATE_SEGMENT_CATEGORIES), 1024u);
+
+    // When/Then: Table lookup equals the range checks for every Hz up to
+    // past the last bucket, and for large out-of-range values
+    size_t mismatches = 0;
+    const uint32_t limit = static_cast<uint32_t>(detail::RATE_BUCKET_COUNT + 8) << detail::BUCKET_SHIFT;
+    for (uint32_t frequency = 0; frequency <= limit; ++frequency) {
+        if (detail::lookup_rate_category(frequency) != detail::classify_rate_category_by_range(frequency)) {
+            ++mismatches;
+        }
+    }
+    EXPECT_EQ(mismatches, 0u);
+    for (uint32_t frequency : {1000000u, 0x7FFFFFFFu, 0xFFFFFFFFu}) {
+        EXPECT_EQ(detail::lookup_rate_category(frequency), RateCategory::Unknown) << "Frequency: " << frequency;
+    }
+
+    // And: Non-kHz rates go through the same table in the manager
+    EXPECT_EQ(rate_manager_->classify_rate_category(44100).category, RateCategory::Basic);
+    EXPECT_EQ(rate_manager_->classify_rate_category(88200).category, RateCategory::Double);
+    EXPECT_EQ(rate_manager_->classify_rate_category(176400).category, RateCategory::Quadruple);
+    EXPECT_EQ(rate_manager_->classify_rate_category(352800).category, RateCategory::Octuple);
+}
+
+/**
+ * @brief Test exact rational multipliers and drift-free frame conversion
+ * @requirement AES5-MULTIPLIER-CALC: Exact rate multipliers for frame-count computation
+ * @traceability TEST-C-003-019 → DES-C-003 → AES5-MULTIPLIER-CALC
+ */
+TEST_F(RateCategoryManagerTest, ExactMultipliersAndFrameConversion) {
+    // Given/When: Both rate families classified
+    const auto r44k1 = rate_manager_->classify_rate_category(44100);
+    const auto r88k2 = rate_manager_->classify_rate_category(88200);
+    const auto r96k = rate_manager_->classify_rate_category(96000);
+    const auto r60k = rate_manager_->classify_rate_category(60000);
+
+    // Then: Ratios are reduced and exact relative to both bases
+    EXPECT_EQ(r44k1.exact_multiplier, (RateRatio{147, 160}));
+    EXPECT_EQ(r44k1.exact_multiplier_44k1, (RateRatio{1, 1}));
+    EXPECT_EQ(r88k2.exact_multiplier, (RateRatio{147, 80}));
+    EXPECT_EQ(r88k2.exact_multiplier_44k1, (RateRatio{2, 1}));
+    EXPECT_EQ(r96k.exact_multiplier, (RateRatio{2, 1}));
+    EXPECT_EQ(r96k.exact_multiplier_44k1, (RateRatio{320, 147}));
+    EXPECT_EQ(r60k.exact_multiplier, (RateRatio{0, 1}));
+    EXPECT_DOUBLE_EQ(r44k1.exact_multiplier.to_double(), r44k1.multiplier);
+
+    // And: The value-type classifier fills the same fields
+    InlineRateCategoryManager<> inline_manager;
+    for (uint32_t frequency : {0u, 11025u, 32000u, 44100u, 176400u, 352800u, 384000u, 500000u}) {
+        const auto heap = rate_manager_->classify_rate_category(frequency);
+        const auto value = inline_manager.classify_rate_category(frequency);
+        EXPECT_EQ(heap.exact_multiplier, value.exact_multiplier) << "Frequency: " << frequency;
+        EXPECT_EQ(heap.exact_multiplier_44k1, value.exact_multiplier_44k1) << "Frequency: " << frequency;
+    }
+
+    // And: One-shot conversions are exact with floor/ceil rounding
+    EXPECT_EQ(convert_frame_count(480, 48000, 44100), 441u);
+    EXPECT_EQ(convert_frame_count(256, 48000, 44100), 235u);
+    EXPECT_EQ(convert_frame_count_ceil(256, 48000, 44100), 236u);
+    EXPECT_EQ(convert_frame_count(1024, 44100, 192000), 4458u);
+    EXPECT_EQ(convert_frame_count(1000, 0, 48000), 0u);
+    const uint64_t day_of_frames = 86400ull * 352800;
+    EXPECT_EQ(convert_frame_count(day_of_frames, 352800, 384000), 86400ull * 384000);
+
+    // And: A running converter never drifts from the one-shot total
+    FrameCountConverter converter(48000, 44100);
+    uint64_t source_total = 0;
+    uint64_t target_total = 0;
+    for (uint64_t period = 0; period < 100000; ++period) {
+        const uint64_t frames = 64 + (period % 7) * 32;
+        source_total += frames;
+        target_total += converter.convert(frames);
+        ASSERT_LT(converter.remainder(), converter.ratio().denominator);
+    }
+    EXPECT_EQ(target_total, convert_frame_count(source_total, 48000, 44100));
+}
+
+/**
+ * @brief Test period and buffer sizing scales with the rate category
+ * @requirement AES5-MULTIPLIER-CALC: Rate-category-aware period sizing
+ * @traceability TEST-C-003-021 → DES-C-003 → AES5-MULTIPLIER-CALC
+ */
+TEST_F(RateCategoryManagerTest, PeriodSizingScalesWithRateCategory) {
+    // Given: Classified streams from both rate families, 1x to 8x
+    const uint32_t latency_target_us = 5000;
+    const auto basic = plan_periods(rate_manager_->classify_rate_category(48000), latency_target_us);
+    const auto octuple = plan_periods(rate_manager_->classify_rate_category(384000), latency_target_us);
+    const auto octuple_44k1 = plan_periods(rate_manager_->classify_rate_category(352800), latency_target_us);
+
+    // Then: Period duration, not frame count, is constant across categories
+    EXPECT_EQ(basic.period_frames, 64u);
+    EXPECT_EQ(basic.period_count, 3u);
+    EXPECT_EQ(octuple.period_frames, 8 * basic.period_frames);
+    EXPECT_EQ(octuple.period_count, basic.period_count);
+    EXPECT_EQ(octuple.latency_us, basic.latency_us);
+    EXPECT_EQ(octuple_44k1.period_frames, 512u);
+    EXPECT_EQ(octuple_44k1.latency_us, 4354u);
+
+    // And: Ring capacity is a power of two holding every period, memory follows the format
+    EXPECT_EQ(basic.ring_capacity_frames, 256u);
+    EXPECT_EQ(basic.memory_bytes, 256u * 2 * 4);
+    EXPECT_EQ(plan_periods(48000, RateCategory::Basic, latency_target_us, SampleFormat{8, 3}).memory_bytes,
+              256u * 8 * 3);
+
+    // And: Every standard-rate plan meets the target within the category limits
+    for (size_t k = 0; k < STANDARD_PERIOD_PLANS.size(); ++k) {
+        const PeriodPlan& plan = STANDARD_PERIOD_PLANS[k];
+        const PeriodSizingProfile& profile = period_sizing_profile(plan.category);
+        ASSERT_TRUE(plan.is_valid()) << "Frequency: " << plan.frequency_hz;
+        EXPECT_TRUE(plan.meets_latency_target) << "Frequency: " << plan.frequency_hz;
+        EXPECT_GE(plan.period_frames, profile.min_period_frames) << "Frequency: " << plan.frequency_hz;
+        EXPECT_LE(plan.period_frames, profile.max_period_frames) << "Frequency: " << plan.frequency_hz;
+        EXPECT_GE(plan.period_count, MIN_PERIOD_COUNT) << "Frequency: " << plan.frequency_hz;
+        EXPECT_GE(plan.ring_capacity_frames, plan.period_frames * plan.period_count);
+    }
+
+    // And: Unreachable targets clamp to the smallest plan, unknown rates have none
+    const auto tight = plan_periods(384000, RateCategory::Octuple, 100);
+    EXPECT_EQ(tight.period_frames, period_sizing_profile(RateCategory::Octuple).min_period_frames);
+    EXPECT_EQ(tight.period_count, MIN_PERIOD_COUNT);
+    EXPECT_FALSE(tight.meets_latency_target);
+    EXPECT_FALSE(plan_periods(rate_manager_->classify_rate_category(60000), latency_target_us).is_valid());
+
+    // And: The cost model charges per period and per sample
+    const PeriodCostModel model{2000, 5};
+    const StreamCost basic_cost = estimate_stream_cost(basic, 2, model);
+    EXPECT_EQ(basic_cost.processing_ns, 2000u + 64u * 2 * 5);
+    EXPECT_EQ(basic_cost.period_ns, 1333333u);
+    EXPECT_EQ(basic_cost.core_load_ppm, 1980u);       // 750 periods/s * 2640 ns
+    EXPECT_TRUE(basic_cost.meets_deadline());
+    const StreamCost octuple_cost = estimate_stream_cost(octuple, 2, model);
+    EXPECT_LT(octuple_cost.core_load_ppm, 8 * basic_cost.core_load_ppm);   // Overhead not scaled 8x
+    EXPECT_TRUE(fits_on_core(0, octuple_cost));
+    EXPECT_FALSE(fits_on_core(CORE_CAPACITY_PPM, octuple_cost));
+    EXPECT_EQ(estimate_stream_cost(PeriodPlan{}).core_load_ppm, 0u);
+}
+
+/**
+ * @brief Test the value-type classifier matches RateCategoryManager
+ * @requirement AES5-MEMORY-003: Allocation-free classification
+ * @traceability TEST-C-003-016 → DES-C-003 → AES5-MEMORY-003
+ */
+TEST_F(RateCategoryManagerTest, InlineManagerMatchesHeapManager) {
+    // Given: A counting value-type classifier on the stack
+    InlineRateCategoryManager<LocalCountersPolicy> classifier;
+    static_assert(InlineRateCategoryManager<>::get_rate_category(176400) == RateCategory::Quadruple,
+                  "Stateless queries are constexpr");
+
+    // When/Then: Results equal the heap-allocated manager's
+    const uint32_t frequencies[] = {0, 8000, 14000, 22050, 44100, 48000, 60000, 96000, 192000, 384000, 500000};
+    for (uint32_t frequency : frequencies) {
+        const auto expected = rate_manager_->classify_rate_category(frequency);
+        const auto result = classifier.classify_rate_category(frequency);
+        EXPECT_EQ(result.category, expected.category) << "Frequency: " << frequency;
+        EXPECT_EQ(result.multiplier, expected.multiplier);
+        EXPECT_EQ(result.is_valid(), expected.is_valid());
+    }
+
+    // And: Every classification is counted, Unknown as a failure
+    EXPECT_EQ(classifier.metrics().total_validations(), 11u);
+    EXPECT_EQ(classifier.metrics().successful_validations(), 7u);
+}
+
+/**
+ * @brief Test the shared classification cache under concurrent hits and evictions
+ * @requirement AES5-THREAD-SAFETY-003: Thread-safe operations
+ * @traceability TEST-C-003-017 → DES-C-003 → AES5-THREAD-SAFETY-003
+ */
+TEST_F(RateCategoryManagerTest, ConcurrentClassificationCacheStaysConsistent) {
+    // Given: A small cache keeps entries until its set is full
+    RateClassificationCache<1, 2> cache;
+    RateCategory category = RateCategory::Unknown;
+    EXPECT_FALSE(cache.lookup(0, category));
+    cache.insert(0, RateCategory::Unknown);
+    cache.insert(48000, RateCategory::Basic);
+    EXPECT_TRUE(cache.lookup(0, category));
+    EXPECT_EQ(category, RateCategory::Unknown);
+    EXPECT_TRUE(cache.lookup(48000, category));
+    EXPECT_EQ(category, RateCategory::Basic);
+    cache.insert(96000, RateCategory::Double);      // Evicts round-robin
+    EXPECT_TRUE(cache.lookup(96000, category));
+    EXPECT_EQ(category, RateCategory::Double);
+    EXPECT_FALSE(cache.lookup(0, category) && cache.lookup(48000, category));
+
+    // When: Threads share the manager with a working set larger than the
+    // cache, so hits, inserts and evictions race
+    constexpr size_t num_threads = 4;
+    constexpr size_t classifications_per_thread = 20000;
+    constexpr uint32_t working_set = 3 * RateClassificationCache<>::capacity();
+    std::atomic<size_t> mismatches{0};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([this, t, &mismatches]() {
+            for (size_t i = 0; i < classifications_per_thread; ++i) {
+                const uint32_t frequency = 7000 + static_cast<uint32_t>((i * 7 + t) % working_set) * 2500;
+                const auto result = rate_manager_->classify_rate_category(frequency);
+                if (result.category != AES::AES5::_2018::core::compile_time::classify_rate_category(frequency) ||
+                    result.valid != (result.category != RateCategory::Unknown)) {
+                    mismatches.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Then: Every result is correct and every call is counted, hit or miss
+    EXPECT_EQ(mismatches.load(), 0u);
+    EXPECT_EQ(rate_manager_->get_metrics().total_validations.load(),
+              num_threads * classifications_per_thread);
+}
+
 /**
  * @brief Document expected interface and validate TDD completion
  * @requirement AES5-INTERFACE-003: Rate category manager interface
@@ -0,0 +1,165 @@
+// Test file for DES-C-008 SampleRateEstimator
+// Traceability: DES-C-008 → TEST-C-008
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "AES/AES5/2018/core/rate_estimation/sample_rate_estimator.hpp"
+#include "AES/AES5/2018/core/frequency_validation/frequency_validator.hpp"
+#include "AES/AES5/2018/core/compliance/compliance_engine.hpp"
+#include "AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core::rate_estimation;
+using namespace AES::AES5::_2018::core::frequency_validation;
+using namespace AES::AES5::_2018::core::compliance;
+using namespace AES::AES5::_2018::core::validation;
+
+/**
+ * @brief Test fixture for SampleRateEstimator
+ * @traceability TEST-C-008 → DES-C-008
+ */
+class SampleRateEstimatorTest : public ::testing::Test {
+protected:
+    static constexpr uint32_t FRAMES_PER_BLOCK = 480;
+
+    void SetUp() override {
+        validator_ = FrequencyValidator::create(
+            std::make_unique<ComplianceEngine>(),
+            std::make_unique<ValidationCore>());
+    }
+
+    /**
+     * @brief Feed blocks of a clock running at rate_hz with optional timestamp jitter
+     */
+    void feed(SampleRateEstimator& estimator, double rate_hz, size_t blocks,
+              uint64_t first_frame = 0, uint32_t jitter_ns = 0) {
+        uint32_t lcg = 12345;
+        for (size_t block = 0; block < blocks; ++block) {
+            const uint64_t frames = static_cast<uint64_t>(block) * FRAMES_PER_BLOCK;
+            double timestamp = 1e12 + static_cast<double>(frames) * 1e9 / rate_hz;
+            if (jitter_ns != 0) {
+                lcg = lcg * 1664525u + 1013904223u;
+                timestamp += static_cast<double>(lcg % (2 * jitter_ns + 1)) - jitter_ns;
+            }
+            estimator.update(first_frame + frames, static_cast<uint64_t>(std::llround(timestamp)));
+        }
+    }
+
+    std::unique_ptr<FrequencyValidator> validator_;
+};
+
+/**
+ * @brief Test estimate of an ideal 48 kHz clock feeds FrequencyValidator
+ * @requirement AES5-CALC-001: Tolerance calculation accuracy
+ * @traceability TEST-C-008-001 → DES-C-008 → AES5-CALC-001
+ */
+TEST_F(SampleRateEstimatorTest, IdealClockEstimatesNominalRate) {
+    // Given: An estimator fed with 1 s of 10 ms callbacks at exactly 48 kHz
+    SampleRateEstimator estimator;
+    feed(estimator, 48000.0, 100);
+
+    // When: Reading the estimate
+    SampleRateEstimate estimate = estimator.estimate();
+
+    // Then: The rate is recovered to well below one ppm
+    ASSERT_TRUE(estimate.is_valid());
+    EXPECT_NEAR(estimate.frequency_hz, 48000.0, 48000.0 * 1e-8);
+    EXPECT_EQ(estimate.frequency.rounded_hz(), 48000u);
+    EXPECT_LT(estimate.uncertainty_ppb, 10.0);
+    EXPECT_EQ(estimate.accepted_updates, 100u);
+    EXPECT_EQ(estimate.rejected_updates, 0u);
+
+    // And: It validates directly as the AES5-2018 primary frequency
+    FrequencyValidationResult result = estimator.validate(*validator_);
+    EXPECT_TRUE(result.is_valid());
+    EXPECT_EQ(result.closest_standard_frequency, 48000u);
+    EXPECT_EQ(result.applicable_clause, AES5Clause::Section_5_1);
+    EXPECT_EQ(validator_->get_metrics().total_validations.load(), 1u);
+}
+
+/**
+ * @brief Test sub-ppm offset is recovered from jittered timestamps
+ * @requirement AES5-CALC-001: Tolerance calculation accuracy
+ * @traceability TEST-C-008-002 → DES-C-008 → AES5-CALC-001
+ */
+TEST_F(SampleRateEstimatorTest, JitteredClockRecoversSubPpmOffset) {
+    // Given: A 47999.73 Hz clock (-5.625 ppm) with +/-2 us timestamp jitter
+    SampleRateEstimator estimator(1024);
+    feed(estimator, 47999.73, 4000, 0, 2000);
+
+    // When: Validating the estimate
+    SampleRateEstimate estimate = estimator.estimate();
+    FrequencyValidationResult result = estimator.validate(*validator_, 10);
+
+    // Then: The offset is resolved to within the reported uncertainty margin
+    ASSERT_TRUE(estimate.is_valid());
+    EXPECT_GT(estimate.uncertainty_ppb, 0.0);
+    EXPECT_LT(estimate.uncertainty_ppb, 20.0);
+    EXPECT_TRUE(result.is_valid());
+    EXPECT_EQ(result.closest_standard_frequency, 48000u);
+    EXPECT_NEAR(static_cast<double>(result.deviation_ppb), -5625.0,
+                5.0 * estimate.uncertainty_ppb + 50.0);
+}
+
+/**
+ * @brief Test drift of a slewing clock is reported with the right sign
+ * @requirement AES5-CALC-001: Tolerance calculation accuracy
+ * @traceability TEST-C-008-003 → DES-C-008 → AES5-CALC-001
+ */
+TEST_F(SampleRateEstimatorTest, SlewingClockReportsDrift) {
+    // Given: A clock whose rate rises by 1000 ppb per second
+    SampleRateEstimator estimator(64);
+    const double drift_per_second = 1000e-9;
+    double timestamp = 0.0;
+    for (uint64_t block = 0; block < 3000; ++block) {
+        const double rate = 48000.0 * (1.0 + drift_per_second * timestamp * 1e-9);
+        estimator.update(block * FRAMES_PER_BLOCK, static_cast<uint64_t>(std::llround(timestamp)));
+        timestamp += FRAMES_PER_BLOCK * 1e9 / rate;
+    }
+
+    // When: Reading the estimate
+    SampleRateEstimate estimate = estimator.estimate();
+
+    // Then: Drift is close to +1000 ppb/s
+    ASSERT_TRUE(estimate.is_valid());
+    EXPECT_NEAR(estimate.drift_ppb_per_second, 1000.0, 100.0);
+}
+
+/**
+ * @brief Test rejection of invalid observations, warm-up, wrap and reset
+ * @requirement AES5-CALC-001: Tolerance calculation accuracy
+ * @traceability TEST-C-008-004 → DES-C-008 → AES5-CALC-001
+ */
+TEST_F(SampleRateEstimatorTest, RejectsInvalidObservationsAndHandlesWrap) {
+    // Given: A fresh estimator
+    SampleRateEstimator estimator;
+
+    // Then: No estimate before MIN_UPDATES points
+    EXPECT_TRUE(estimator.update(0, 1000));
+    EXPECT_TRUE(estimator.update(480, 10001000));
+    EXPECT_FALSE(estimator.estimate().is_valid());
+    EXPECT_EQ(estimator.validate(*validator_).status, ValidationResult::InvalidInput);
+
+    // And: Repeated frames or backwards time are rejected
+    EXPECT_FALSE(estimator.update(480, 20001000));
+    EXPECT_FALSE(estimator.update(960, 5000));
+    EXPECT_EQ(estimator.estimate().rejected_updates, 2u);
+
+    // When: The frame counter wraps around 2^64
+    estimator.reset();
+    EXPECT_EQ(estimator.estimate().accepted_updates, 0u);
+    feed(estimator, 96000.0, 50, UINT64_MAX - 10 * FRAMES_PER_BLOCK);
+
+    // Then: The estimate is unaffected
+    SampleRateEstimate estimate = estimator.estimate();
+    EXPECT_EQ(estimate.rejected_updates, 0u);
+    EXPECT_NEAR(estimate.frequency_hz, 96000.0, 96000.0 * 1e-8);
+
+    // And: The estimator is a fixed-size value type (no allocation per stream)
+    static_assert(std::is_trivially_copyable<SampleRateEstimator>::value,
+                  "estimator must be trivially copyable");
+    EXPECT_LE(sizeof(SampleRateEstimator), 128u);
+}
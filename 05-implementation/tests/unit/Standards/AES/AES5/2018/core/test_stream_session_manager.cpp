@@ -0,0 +1,144 @@
+// Test file for StreamSessionManager (DES-C-001 + DES-C-003 multi-stream monitoring)
+// Traceability: DES-C-001, DES-C-003 → TEST-SESSION
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "AES/AES5/2018/core/stream_sessions/stream_session_manager.hpp"
+#include "AES/AES5/2018/core/compliance/compliance_engine.hpp"
+#include "AES/AES5/2018/core/validation/validation_core.hpp"
+
+using namespace AES::AES5::_2018::core::stream_sessions;
+using namespace AES::AES5::_2018::core::frequency_validation;
+using namespace AES::AES5::_2018::core::rate_categories;
+using namespace AES::AES5::_2018::core::compliance;
+using namespace AES::AES5::_2018::core::validation;
+
+/**
+ * @brief Test fixture for StreamSessionManager
+ * @traceability TEST-SESSION → DES-C-001, DES-C-003
+ */
+class StreamSessionManagerTest : public ::testing::Test {
+protected:
+    static std::unique_ptr<StreamSessionManager> make_manager(size_t capacity) {
+        return StreamSessionManager::create(
+            FrequencyValidator::create(std::make_unique<ComplianceEngine>(),
+                                       std::make_unique<ValidationCore>()),
+            RateCategoryManager::create(std::make_unique<ValidationCore>()),
+            capacity);
+    }
+};
+
+/**
+ * @brief Test factory rejects invalid arguments
+ * @traceability TEST-SESSION-001 → DES-C-001, DES-C-003
+ */
+TEST_F(StreamSessionManagerTest, FactoryRejectsInvalidArguments) {
+    // Given/When: Missing dependencies or zero capacity
+    auto no_validator = StreamSessionManager::create(
+        nullptr, RateCategoryManager::create(std::make_unique<ValidationCore>()), 16);
+    auto zero_capacity = make_manager(0);
+
+    // Then: Creation fails
+    EXPECT_EQ(no_validator, nullptr);
+    EXPECT_EQ(zero_capacity, nullptr);
+
+    // And: A valid manager starts empty
+    auto manager = make_manager(16);
+    ASSERT_NE(manager, nullptr);
+    EXPECT_EQ(manager->stream_count(), 0u);
+    EXPECT_EQ(manager->capacity(), 16u);
+    EXPECT_EQ(manager->tick(), 0u);
+}
+
+/**
+ * @brief Test one tick validates and classifies every stream like the single-call APIs
+ * @traceability TEST-SESSION-002 → DES-C-001, DES-C-003
+ */
+TEST_F(StreamSessionManagerTest, TickMatchesSingleStreamValidation) {
+    // Given: More streams than one tick block, with assorted rates
+    const size_t stream_count = StreamSessionManager::TICK_BLOCK_STREAMS * 2 + 37;
+    auto manager = make_manager(stream_count);
+    ASSERT_NE(manager, nullptr);
+    auto reference = FrequencyValidator::create(std::make_unique<ComplianceEngine>(),
+                                                std::make_unique<ValidationCore>());
+    auto reference_categories = RateCategoryManager::create(std::make_unique<ValidationCore>());
+
+    const uint32_t rates[] = {48000, 48003, 44100, 96000, 47952, 192000, 0, 50000, 384000, 11025};
+    std::vector<StreamId> ids;
+    for (size_t i = 0; i < stream_count; ++i) {
+        ids.push_back(manager->add_stream(rates[i % 10]));
+    }
+
+    // When: Ticking once
+    size_t valid = manager->tick(50);
+
+    // Then: Every stream matches validate_frequency() and classify_rate_category()
+    size_t expected_valid = 0;
+    for (size_t i = 0; i < stream_count; ++i) {
+        StreamState state;
+        ASSERT_TRUE(manager->get_stream_state(ids[i], state));
+        FrequencyValidationResult expected = reference->validate_frequency(rates[i % 10], 50);
+        EXPECT_EQ(state.measured_rate_hz, rates[i % 10]);
+        EXPECT_EQ(state.status, expected.status) << "Stream " << i;
+        EXPECT_EQ(state.closest_standard_frequency, expected.closest_standard_frequency);
+        EXPECT_EQ(state.applicable_clause, expected.applicable_clause);
+        EXPECT_DOUBLE_EQ(state.deviation_ppm, expected.tolerance_ppm);
+        EXPECT_EQ(state.category, reference_categories->get_rate_category(rates[i % 10]));
+        expected_valid += expected.is_valid() ? 1 : 0;
+    }
+    EXPECT_EQ(valid, expected_valid);
+
+    // And: Each component recorded one validation per stream (the validator,
+    // like validate_frequency(0), does not count streams without a rate)
+    size_t measured_streams = 0;
+    for (size_t i = 0; i < stream_count; ++i) {
+        measured_streams += (rates[i % 10] != 0) ? 1 : 0;
+    }
+    EXPECT_EQ(manager->get_validator().get_metrics().total_validations.load(), measured_streams);
+    EXPECT_EQ(manager->get_rate_category_manager().get_metrics().total_validations.load(), stream_count);
+}
+
+/**
+ * @brief Test stream ids stay stable across removal and reuse
+ * @traceability TEST-SESSION-003 → DES-C-001, DES-C-003
+ */
+TEST_F(StreamSessionManagerTest, StreamIdsStableAcrossRemoval) {
+    // Given: A full manager
+    auto manager = make_manager(4);
+    ASSERT_NE(manager, nullptr);
+    StreamId a = manager->add_stream(48000);
+    StreamId b = manager->add_stream(44100);
+    StreamId c = manager->add_stream(96000);
+    StreamId d = manager->add_stream(32000);
+    EXPECT_EQ(manager->add_stream(48000), INVALID_STREAM_ID);
+
+    // When: Removing a stream from the middle and updating another
+    EXPECT_TRUE(manager->remove_stream(b));
+    EXPECT_FALSE(manager->remove_stream(b));
+    EXPECT_TRUE(manager->set_measured_rate(d, 88200));
+    EXPECT_FALSE(manager->set_measured_rate(b, 48000));
+    manager->tick();
+
+    // Then: Remaining ids still address their own streams
+    StreamState state;
+    EXPECT_FALSE(manager->get_stream_state(b, state));
+    ASSERT_TRUE(manager->get_stream_state(a, state));
+    EXPECT_EQ(state.closest_standard_frequency, 48000u);
+    ASSERT_TRUE(manager->get_stream_state(c, state));
+    EXPECT_EQ(state.category, RateCategory::Double);
+    ASSERT_TRUE(manager->get_stream_state(d, state));
+    EXPECT_EQ(state.measured_rate_hz, 88200u);
+    EXPECT_EQ(state.closest_standard_frequency, 88200u);
+
+    // And: The view is dense and the freed id is reused
+    StreamSessionView view = manager->view();
+    EXPECT_EQ(view.count, 3u);
+    for (size_t slot = 0; slot < view.count; ++slot) {
+        EXPECT_NE(view.stream_ids[slot], b);
+        EXPECT_EQ(view.status[slot], ValidationResult::Valid);
+    }
+    EXPECT_EQ(manager->add_stream(), b);
+    EXPECT_EQ(manager->stream_count(), 4u);
+}
@@ -3,6 +3,7 @@
 // Traceability: DES-C-005 → TEST-C-005
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
@@ -350,6 +351,461 @@ TEST_F(ValidationCoreTest, MetricsResetFunctionality) {
     EXPECT_EQ(1, new_metrics.total_validations);
 }
 
+/**
+ * @brief Test sharded metrics backend aggregates concurrent updates exactly
+ * @requirement SYS-THREAD-001: Thread-safe validation operations
+ * @traceability TEST-C-005-011 → DES-C-005 → SYS-THREAD-001
+ */
+TEST_F(ValidationCoreTest, ShardedMetricsBackendAggregation) {
+    // Given: ValidationCore with per-thread sharded metrics
+    ValidationCore sharded_core(MetricsBackend::Sharded);
+    ASSERT_EQ(MetricsBackend::Sharded, sharded_core.get_metrics_backend());
+    EXPECT_EQ(MetricsBackend::Shared, core_->get_metrics_backend());
+    EXPECT_LE(sizeof(ValidationCore), 2048u);
+
+    // When: Several threads validate and record concurrently
+    const int num_threads = 4;
+    const int validations_per_thread = 250;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&sharded_core, validations_per_thread]() {
+            for (int i = 0; i < validations_per_thread; ++i) {
+                sharded_core.validate(48000, always_valid_validator);
+                sharded_core.record_validation(ValidationResult::OutOfTolerance);
+            }
+            sharded_core.record_batch(10, 7, 1000);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Then: The aggregated snapshot matches the shared backend semantics
+    const ValidationMetrics& metrics = sharded_core.get_metrics();
+    EXPECT_EQ(num_threads * (2 * validations_per_thread + 10), metrics.total_validations);
+    EXPECT_EQ(num_threads * (validations_per_thread + 7), metrics.successful_validations);
+    EXPECT_EQ(num_threads * (validations_per_thread + 3), metrics.failed_validations);
+    EXPECT_EQ(num_threads * (validations_per_thread + 10), metrics.timed_validations);
+    EXPECT_GE(metrics.max_latency_ns.load(), 100u);
+    EXPECT_TRUE(sharded_core.meets_realtime_constraints(1000000));
+
+    // And: Reset clears every shard
+    sharded_core.reset_metrics();
+    EXPECT_EQ(0, sharded_core.get_metrics().total_validations);
+    EXPECT_EQ(0, sharded_core.get_metrics().max_latency_ns);
+
+    // And: Copies keep the backend
+    ValidationCore copy(sharded_core);
+    EXPECT_EQ(MetricsBackend::Sharded, copy.get_metrics_backend());
+
+    // And: Each core aggregates into its own view, so references from two
+    // cores never alias
+    sharded_core.record_batch(5, 5, 500);
+    copy.record_batch(2, 2, 200);
+    const ValidationMetrics& original_view = sharded_core.get_metrics();
+    const ValidationMetrics& copy_view = copy.get_metrics();
+    EXPECT_NE(&original_view, &copy_view);
+    EXPECT_EQ(5u, original_view.total_validations.load());
+    EXPECT_EQ(2u, copy_view.total_validations.load());
+}
+
+/**
+ * @brief Test unbounded batch validation with per-element results
+ * @requirement SYS-PERF-003: Batch processing optimization
+ * @traceability TEST-C-005-012 → DES-C-005 → SYS-PERF-003
+ */
+TEST_F(ValidationCoreTest, UnboundedBatchValidationWithResults) {
+    // Given: Far more values than one chunk, with sparse failures
+    const size_t count = ValidationCore::BATCH_CHUNK_SIZE * 3 + 123;
+    std::vector<uint32_t> values(count, 48000);
+    values[5] = 44100;
+    values[count - 1] = 96000;
+    std::vector<ValidationResult> results(count, ValidationResult::InternalError);
+
+    // When: Validating every element
+    BatchValidationSummary summary = core_->batch_validate_into(
+        values.data(), count, results.data(), frequency_48khz_validator);
+
+    // Then: Every element is reported, not just the first 16
+    EXPECT_EQ(count, summary.processed);
+    EXPECT_EQ(count - 2, summary.successful);
+    EXPECT_EQ(ValidationResult::OutOfTolerance, summary.first_failure);
+    EXPECT_EQ(5u, summary.first_failure_index);
+    EXPECT_EQ(ValidationResult::OutOfTolerance, results[count - 1]);
+    EXPECT_EQ(ValidationResult::Valid, results[count - 2]);
+    EXPECT_EQ(count, core_->get_metrics().total_validations);
+    EXPECT_EQ(2, core_->get_metrics().failed_validations);
+
+    // When: Stopping at the first failure past the first chunk
+    core_->reset_metrics();
+    values[5] = 48000;
+    std::fill(results.begin(), results.end(), ValidationResult::InternalError);
+    summary = core_->batch_validate_into(values.data(), count, results.data(), frequency_48khz_validator,
+                                         nullptr, BatchStopPolicy::StopOnFirstFailure);
+
+    // Then: Processing ends at the failing element
+    EXPECT_EQ(count, summary.processed);
+    EXPECT_EQ(count - 1, summary.first_failure_index);
+    values[ValidationCore::BATCH_CHUNK_SIZE + 1] = 0;
+    summary = core_->batch_validate_into(values.data(), count, results.data(), frequency_48khz_validator,
+                                         nullptr, BatchStopPolicy::StopOnFirstFailure);
+    EXPECT_EQ(ValidationCore::BATCH_CHUNK_SIZE + 2, summary.processed);
+    EXPECT_EQ(ValidationCore::BATCH_CHUNK_SIZE + 1, summary.first_failure_index);
+
+    // And: The legacy API no longer ignores values past the sixteenth
+    EXPECT_EQ(ValidationResult::OutOfTolerance,
+              core_->batch_validate(values.data(), count, frequency_48khz_validator));
+
+    // And: Invalid arguments and empty input
+    summary = core_->batch_validate_into(nullptr, 10, nullptr, always_valid_validator);
+    EXPECT_EQ(ValidationResult::InternalError, summary.first_failure);
+    EXPECT_EQ(0u, summary.processed);
+    summary = core_->batch_validate_into(values.data(), 0, nullptr, always_valid_validator);
+    EXPECT_TRUE(summary.all_valid());
+    EXPECT_EQ(0u, summary.processed);
+}
+
+/**
+ * @brief Test templated validate/batch_validate match the function-pointer API
+ * @requirement SYS-PERF-003: Batch processing optimization
+ * @traceability TEST-C-005-013 → DES-C-005 → SYS-PERF-003
+ */
+TEST_F(ValidationCoreTest, TemplatedCallableValidation) {
+    // Given: A capturing lambda equivalent to frequency_48khz_validator
+    const uint32_t expected_rate = 48000;
+    auto lambda = [expected_rate](uint32_t value) noexcept {
+        return (value == expected_rate) ? ValidationResult::Valid : ValidationResult::OutOfTolerance;
+    };
+
+    // When/Then: Single validation records metrics like the pointer API
+    EXPECT_EQ(ValidationResult::Valid, core_->validate(48000, lambda));
+    EXPECT_EQ(ValidationResult::OutOfTolerance, core_->validate(44100, lambda));
+    EXPECT_EQ(2, core_->get_metrics().total_validations);
+    EXPECT_EQ(1, core_->get_metrics().failed_validations);
+
+    // Given: Values spanning several chunks with failures in the second chunk
+    const size_t count = ValidationCore::BATCH_CHUNK_SIZE * 2 + 9;
+    std::vector<uint32_t> values(count, 48000);
+    values[ValidationCore::BATCH_CHUNK_SIZE + 3] = 96000;
+    values[ValidationCore::BATCH_CHUNK_SIZE + 7] = 44100;
+    std::vector<ValidationResult> expected(count);
+    std::vector<ValidationResult> actual(count);
+
+    // When: Validating with both APIs under both stop policies
+    for (BatchStopPolicy policy : {BatchStopPolicy::ValidateAll, BatchStopPolicy::StopOnFirstFailure}) {
+        BatchValidationSummary pointer_summary = core_->batch_validate_into(
+            values.data(), count, expected.data(), frequency_48khz_validator, nullptr, policy);
+        BatchValidationSummary template_summary = core_->batch_validate_into(
+            values.data(), count, actual.data(), lambda, policy);
+
+        // Then: Summaries and per-element results are identical
+        EXPECT_EQ(pointer_summary.processed, template_summary.processed);
+        EXPECT_EQ(pointer_summary.successful, template_summary.successful);
+        EXPECT_EQ(pointer_summary.first_failure, template_summary.first_failure);
+        EXPECT_EQ(ValidationCore::BATCH_CHUNK_SIZE + 3, template_summary.first_failure_index);
+        for (size_t i = 0; i < pointer_summary.processed; ++i) {
+            ASSERT_EQ(expected[i], actual[i]) << "Element " << i;
+        }
+    }
+
+    // And: First-failure batch validation without a results buffer
+    EXPECT_EQ(ValidationResult::OutOfTolerance, core_->batch_validate(values.data(), count, lambda));
+    EXPECT_EQ(ValidationResult::InternalError, core_->batch_validate(nullptr, 4, lambda));
+}
+
+/**
+ * @brief Test pluggable clock sources for latency measurement
+ * @requirement SYS-PERF-001: Low-overhead latency measurement
+ * @traceability TEST-C-005-014 → DES-C-005 → SYS-PERF-001
+ */
+TEST_F(ValidationCoreTest, PluggableClockSource) {
+    // Given: An injected clock advancing 100 ns per read
+    uint64_t fake_now = 1000;
+    auto fake_clock = [](void* context) noexcept {
+        auto* now = static_cast<uint64_t*>(context);
+        return *now += 100;
+    };
+    core_->set_clock_source(ClockSource::injected(fake_clock, &fake_now));
+    ASSERT_EQ(ClockSourceKind::Injected, core_->get_clock_source().kind());
+
+    // When: Validating through both APIs
+    core_->validate(48000, always_valid_validator);
+    core_->validate(48000, [](uint32_t) noexcept { return ValidationResult::Valid; });
+
+    // Then: Latency is exactly one clock step per validation
+    EXPECT_EQ(200u, core_->get_metrics().total_latency_ns);
+    EXPECT_EQ(100u, core_->get_metrics().max_latency_ns);
+
+    // And: Copies keep the clock source; a null function falls back to steady_clock
+    ValidationCore copy(*core_);
+    EXPECT_EQ(ClockSourceKind::Injected, copy.get_clock_source().kind());
+    EXPECT_EQ(ClockSourceKind::SteadyClock, ClockSource::injected(nullptr).kind());
+
+    // And: The cycle counter is used only when invariant, becomes the default
+    // once calibrated, and agrees with steady_clock
+    const bool calibrated = ClockSource::calibrate();
+    ClockSource cycle = ClockSource::cycle_counter();
+    EXPECT_EQ(calibrated, cycle.kind() == ClockSourceKind::CycleCounter);
+    EXPECT_EQ(cycle.kind(), ClockSource::automatic().kind());
+    EXPECT_EQ(cycle.kind(), ValidationCore().get_clock_source().kind());
+    if (cycle.kind() == ClockSourceKind::CycleCounter) {
+        EXPECT_GT(cycle.tick_frequency_hz(), 1e6);
+        const ClockSource steady = ClockSource::steady();
+        const uint64_t cycle_start = cycle.now_ticks();
+        const uint64_t steady_start = steady.now_ticks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const double cycle_ns = static_cast<double>(cycle.elapsed_ns(cycle_start));
+        const double steady_ns = static_cast<double>(steady.elapsed_ns(steady_start));
+        EXPECT_NEAR(cycle_ns, steady_ns, steady_ns * 0.02);
+    }
+}
+
+/**
+ * @brief Test latency histogram percentiles, merging and percentile constraints
+ * @requirement SYS-REAL-TIME-001: Real-time performance guarantee
+ * @traceability TEST-C-005-015 → DES-C-005 → SYS-REAL-TIME-001
+ */
+TEST_F(ValidationCoreTest, LatencyHistogramPercentiles) {
+    // Given: Bucket layout with bounded relative error
+    for (uint64_t value : {0ull, 31ull, 64ull, 1000ull, 123456ull, 4000000000ull}) {
+        const size_t index = LatencyHistogram::bucket_index(value);
+        EXPECT_LE(LatencyHistogram::bucket_lower_bound(index), value);
+        EXPECT_GE(LatencyHistogram::bucket_upper_bound(index), value);
+        EXPECT_LE(LatencyHistogram::bucket_upper_bound(index) - LatencyHistogram::bucket_lower_bound(index),
+                  value / LatencyHistogram::SUB_BUCKET_COUNT);
+    }
+    EXPECT_EQ(LatencyHistogram::BUCKET_COUNT - 1, LatencyHistogram::bucket_index(UINT64_MAX));
+
+    // Given: A core with an attached histogram and a clock advancing 500 ns per read
+    static LatencyHistogram histogram;
+    histogram.reset();
+    uint64_t step = 500;
+    uint64_t fake_now = 0;
+    struct FakeClock { uint64_t* now; uint64_t* step; } fake{&fake_now, &step};
+    core_->set_clock_source(ClockSource::injected([](void* context) noexcept {
+        auto* clock = static_cast<FakeClock*>(context);
+        return *clock->now += *clock->step;
+    }, &fake));
+    core_->attach_latency_histogram(&histogram);
+    EXPECT_EQ(&histogram, core_->get_latency_histogram());
+
+    // When: 999 fast validations and one 50 us outlier
+    for (int i = 0; i < 999; ++i) {
+        core_->validate(48000, always_valid_validator);
+    }
+    step = 50000;
+    core_->validate(48000, always_valid_validator);
+
+    // Then: Percentiles see through the outlier, the all-time max does not
+    EXPECT_EQ(1000u, histogram.total_count());
+    const uint64_t fast_bucket_max = LatencyHistogram::bucket_upper_bound(LatencyHistogram::bucket_index(500));
+    EXPECT_EQ(fast_bucket_max, core_->get_latency_percentile_ns(50.0));
+    EXPECT_EQ(fast_bucket_max, core_->get_latency_percentile_ns(99.9));
+    EXPECT_LE(fast_bucket_max, 500u + 500u / LatencyHistogram::SUB_BUCKET_COUNT);
+    EXPECT_GE(core_->get_latency_percentile_ns(100.0), 50000u);
+    EXPECT_LE(core_->get_latency_percentile_ns(100.0), 50000u + 50000u / LatencyHistogram::SUB_BUCKET_COUNT);
+    EXPECT_FALSE(core_->meets_realtime_constraints(10000));
+    EXPECT_TRUE(core_->meets_realtime_constraints(10000, 99.9));
+    EXPECT_FALSE(core_->meets_realtime_constraints(10000, 100.0));
+
+    // And: Batches record count x per-element latency; histograms merge
+    core_->record_batch(1000, 1000, 1000 * 2000);
+    EXPECT_EQ(2000u, histogram.total_count());
+    LatencyHistogram other;
+    other.record(300, 5);
+    other.merge(histogram);
+    EXPECT_EQ(2005u, other.total_count());
+    EXPECT_EQ(LatencyHistogram::bucket_upper_bound(LatencyHistogram::bucket_index(300)),
+              other.value_at_percentile(0.1));
+
+    // And: Reset clears the attached histogram; detaching stops recording
+    core_->reset_metrics();
+    EXPECT_EQ(0u, histogram.total_count());
+    core_->attach_latency_histogram(nullptr);
+    core_->validate(48000, always_valid_validator);
+    EXPECT_EQ(0u, histogram.total_count());
+    EXPECT_EQ(0u, core_->get_latency_percentile_ns(99.0));
+    EXPECT_LE(sizeof(ValidationCore), 2048u);
+}
+
+/**
+ * @brief Test sliding-window constraints and deadline violations
+ * @requirement SYS-REAL-TIME-001: Real-time performance guarantee
+ * @traceability TEST-C-005-016 → DES-C-005 → SYS-REAL-TIME-001
+ */
+TEST_F(ValidationCoreTest, WindowedMetricsForgetOldSpikes) {
+    // Given: 1 ms intervals, a 4 ms window, a 10 us deadline and a controllable clock
+    static WindowedLatencyMetrics window(WindowMode::Time, 1000000, 4);
+    window.reset();
+    uint64_t step = 50000;
+    uint64_t fake_now = 0;
+    struct FakeClock { uint64_t* now; uint64_t* step; } fake{&fake_now, &step};
+    core_->set_clock_source(ClockSource::injected([](void* context) noexcept {
+        auto* clock = static_cast<FakeClock*>(context);
+        return *clock->now += *clock->step;
+    }, &fake));
+    core_->attach_windowed_metrics(&window);
+    core_->set_latency_deadline_ns(10000);
+    EXPECT_EQ(&window, core_->get_windowed_metrics());
+
+    // When: A 50 us cold-start spike
+    // Then: It is reported as PerformanceViolation and fails both checks
+    EXPECT_EQ(ValidationResult::PerformanceViolation, core_->validate(48000, always_valid_validator));
+    EXPECT_EQ(1u, core_->get_metrics().deadline_violations.load());
+    EXPECT_EQ(1u, core_->get_metrics().successful_validations.load());
+    EXPECT_FALSE(core_->meets_realtime_constraints(10000));
+    EXPECT_FALSE(core_->meets_windowed_realtime_constraints(10000));
+    EXPECT_EQ(ValidationResult::OutOfTolerance,
+              core_->validate(48000, [](uint32_t) noexcept { return ValidationResult::OutOfTolerance; }));
+    EXPECT_EQ(2u, core_->get_metrics().deadline_violations.load());
+
+    // When: 10 ms later, fast validations only
+    step = 500;
+    fake_now += 10000000;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(ValidationResult::Valid, core_->validate(48000, always_valid_validator));
+    }
+
+    // Then: The spike left the window; the all-time check still fails
+    EXPECT_TRUE(core_->meets_windowed_realtime_constraints(10000));
+    EXPECT_TRUE(core_->meets_windowed_realtime_constraints(10000, 99.0));
+    EXPECT_FALSE(core_->meets_realtime_constraints(10000));
+    const WindowedLatencyStats stats = core_->get_windowed_stats();
+    EXPECT_EQ(100u, stats.count);
+    EXPECT_EQ(0u, stats.deadline_violations);
+    EXPECT_EQ(500u, stats.max_latency_ns);
+    EXPECT_EQ(WindowedLatencyMetrics::Layout::upper_bound(WindowedLatencyMetrics::Layout::index(500)),
+              stats.p99_latency_ns);
+    EXPECT_GT(stats.throughput_per_second, 0.0);
+    EXPECT_EQ(0u, window.dropped_samples());
+
+    // And: Slow batches count one violation per element without changing results
+    core_->record_batch(100, 100, 100 * 20000);
+    EXPECT_EQ(102u, core_->get_metrics().deadline_violations.load());
+    EXPECT_EQ(100u, core_->get_windowed_stats().deadline_violations);
+    EXPECT_FALSE(core_->meets_windowed_realtime_constraints(10000));
+
+    // And: Count windows cover the most recent interval_length x window_intervals samples
+    WindowedLatencyMetrics by_count(WindowMode::Count, 10, 2);
+    by_count.record(100000, 0);
+    for (int i = 0; i < 30; ++i) {
+        by_count.record(100, 0);
+    }
+    EXPECT_EQ(11u, by_count.stats(0).count);
+    EXPECT_EQ(100u, by_count.stats(0).max_latency_ns);
+    EXPECT_EQ(0.0, by_count.stats(0).throughput_per_second);
+
+    // And: Exactly at an interval boundary the window still spans two full intervals
+    for (int i = 0; i < 9; ++i) {
+        by_count.record(100, 0);
+    }
+    EXPECT_EQ(20u, by_count.stats(0).count);
+
+    // And: Batch counts beyond 32 bits are kept exactly in the buckets
+    WindowedLatencyMetrics large(WindowMode::Count, 1ULL << 40, 1);
+    large.record(100, 0, (1ULL << 32) + 5);
+    large.record(1000000, 0, 1);
+    EXPECT_EQ((1ULL << 32) + 6, large.stats(0).count);
+    EXPECT_EQ(WindowedLatencyMetrics::Layout::upper_bound(WindowedLatencyMetrics::Layout::index(100)),
+              large.value_at_percentile(99.0, 0));
+
+    // And: Reset clears the window and the violation counter
+    core_->reset_metrics();
+    EXPECT_EQ(0u, core_->get_windowed_stats().count);
+    EXPECT_EQ(0u, core_->get_metrics().deadline_violations.load());
+    core_->attach_windowed_metrics(nullptr);
+    EXPECT_EQ(0u, core_->get_windowed_stats().count);
+    EXPECT_LE(sizeof(ValidationCore), 2048u);
+}
+
+/**
+ * @brief Test consistent metrics snapshots under concurrent writers and snapshot diffs
+ * @requirement SYS-PERF-001: Thread-safe metric collection
+ * @traceability TEST-C-005-017 → DES-C-005 → SYS-PERF-001
+ */
+TEST_F(ValidationCoreTest, ConsistentMetricsSnapshots) {
+    // Given: A default Shared core does not pay for the sequence protocol
+    EXPECT_FALSE(core_->get_snapshot_sequencing());
+    core_->record_validation(ValidationResult::Valid, 100);
+    EXPECT_EQ(0u, core_->get_metrics().writes_begun.load());
+    EXPECT_FALSE(core_->get_metrics_snapshot().consistent);
+    EXPECT_EQ(1u, core_->get_metrics_snapshot().total_validations);
+    core_->reset_metrics();
+
+    // Given: Both backends (Shared with sequencing enabled), written by
+    // threads whose updates keep latency = 100 ns x timed
+    for (MetricsBackend backend : {MetricsBackend::Shared, MetricsBackend::Sharded}) {
+        ValidationCore core(backend);
+        core.set_snapshot_sequencing(true);
+        EXPECT_TRUE(ValidationCore(core).get_snapshot_sequencing());
+        std::atomic<bool> stop{false};
+        std::vector<std::thread> writers;
+        for (int t = 0; t < 3; ++t) {
+            writers.emplace_back([&core, &stop] {
+                while (!stop.load(std::memory_order_relaxed)) {
+                    core.record_validation(ValidationResult::Valid, 100);
+                    core.record_batch(4, 3, 400);
+                }
+            });
+        }
+
+        // When: A scraper takes snapshots while they run
+        size_t consistent = 0;
+        uint64_t observed = 0;
+        for (int i = 0; i < 2000 || observed < 100000; ++i) {
+            const MetricsSnapshot snapshot = core.get_metrics_snapshot();
+            if (!snapshot.consistent) {
+                std::this_thread::yield();
+                continue;
+            }
+            observed = snapshot.total_validations;
+            ++consistent;
+
+            // Then: Every consistent snapshot satisfies the writers' invariants
+            ASSERT_EQ(snapshot.total_latency_ns, 100u * snapshot.timed_validations);
+            ASSERT_EQ(snapshot.total_validations, snapshot.successful_validations + snapshot.failed_validations);
+            ASSERT_EQ(snapshot.total_validations, snapshot.timed_validations);
+        }
+        stop.store(true);
+        for (auto& writer : writers) {
+            writer.join();
+        }
+        EXPECT_GT(consistent, 0u);
+        const MetricsSnapshot final_snapshot = core.get_metrics_snapshot();
+        EXPECT_TRUE(final_snapshot.consistent);
+        EXPECT_EQ(100u, final_snapshot.average_latency_ns());
+    }
+
+    // Given: A clock advancing 1 ms per read
+    uint64_t fake_now = 0;
+    core_->set_clock_source(ClockSource::injected([](void* context) noexcept {
+        return *static_cast<uint64_t*>(context) += 1000000;
+    }, &fake_now));
+
+    // When: 10 validations (one failing) happen between two snapshots
+    const MetricsSnapshot before = core_->get_metrics_snapshot();
+    core_->record_batch(9, 9, 900);
+    core_->record_validation(ValidationResult::OutOfTolerance, 300);
+    const MetricsSnapshot after = core_->get_metrics_snapshot();
+    const MetricsDelta delta = after.since(before);
+
+    // Then: The delta reports per-interval counts and rates
+    EXPECT_FALSE(delta.counters_reset);
+    EXPECT_EQ(10u, delta.validations);
+    EXPECT_EQ(1u, delta.failed_validations);
+    EXPECT_EQ(120u, delta.average_latency_ns());
+    EXPECT_DOUBLE_EQ(90.0, delta.success_rate());
+    EXPECT_EQ(after.timestamp_ns - before.timestamp_ns, delta.interval_ns);
+    EXPECT_DOUBLE_EQ(10.0 * 1e9 / static_cast<double>(delta.interval_ns), delta.validations_per_second());
+
+    // And: A reset in between is detected and the delta restarts from zero
+    core_->reset_metrics();
+    core_->record_validation(ValidationResult::Valid, 50);
+    const MetricsDelta after_reset = core_->get_metrics_snapshot().since(after);
+    EXPECT_TRUE(after_reset.counters_reset);
+    EXPECT_EQ(1u, after_reset.validations);
+}
+
 // RED PHASE SUMMARY TEST - Document what we expect to implement
 
 /**
@@ -0,0 +1,174 @@
+/**
+ * @file metrics_shm_reader.cpp
+ * @brief Prints ValidationCore metrics exported to shared memory
+ * @traceability DES-C-005, DES-C-010 → MetricsShmReader
+ *
+ * Usage: metrics_shm_reader [--segment NAME] [--prometheus]
+ *
+ * Default output is a table, one row per registered core. --prometheus
+ * prints the Prometheus text exposition format, suitable for a textfile
+ * collector or a sidecar that serves it; this tool opens no sockets.
+ *
+ * The latency histogram family is built from the exported histogram alone,
+ * which may cover fewer samples than the core counters (attached late,
+ * shared between cores). Its _sum is therefore estimated from bucket
+ * midpoints, and the last bucket, which also holds latencies clamped from
+ * 2^32 ns upward, is reported only under le="+Inf".
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "src/lib/Standards/AES/AES5/2018/core/monitoring/metrics_shm_exporter.hpp"
+
+using namespace AES::AES5::_2018::core::monitoring;
+
+namespace {
+
+void print_usage(const char* program) {
+    std::cerr << "Usage: " << program << " [--segment NAME] [--prometheus]\n"
+              << "  --segment NAME  POSIX shm name (default " << DEFAULT_SHM_SEGMENT_NAME << ")\n"
+              << "  --prometheus    Prometheus text format instead of a table\n";
+}
+
+/// Prometheus label value escaping: backslash, double quote, newline
+std::string escape_label(const char* value) {
+    std::string escaped;
+    for (const char* c = value; *c != '\0'; ++c) {
+        switch (*c) {
+            case '\\': escaped += "\\\\"; break;
+            case '"':  escaped += "\\\""; break;
+            case '\n': escaped += "\\n"; break;
+            default:   escaped += *c; break;
+        }
+    }
+    return escaped;
+}
+
+void print_table(const MetricsShmReader& reader) {
+    std::printf("%-24s %12s %12s %12s %10s %10s %10s %10s\n",
+                "core", "total", "successful", "failed", "avg_ns", "p99_ns", "max_ns", "deadline");
+    ShmCoreRecord record;
+    for (size_t i = 0; i < reader.slot_capacity(); ++i) {
+        if (!reader.read_slot(i, record)) {
+            continue;
+        }
+        const auto& m = record.metrics;
+        std::printf("%-24s %12llu %12llu %12llu %10llu %10llu %10llu %10llu\n",
+                    record.name,
+                    static_cast<unsigned long long>(m.total_validations),
+                    static_cast<unsigned long long>(m.successful_validations),
+                    static_cast<unsigned long long>(m.failed_validations),
+                    static_cast<unsigned long long>(m.average_latency_ns()),
+                    static_cast<unsigned long long>(record.latency_percentile_ns(99.0)),
+                    static_cast<unsigned long long>(m.max_latency_ns),
+                    static_cast<unsigned long long>(m.deadline_violations));
+    }
+}
+
+void print_prometheus(const MetricsShmReader& reader) {
+    struct Counter {
+        const char* name;
+        const char* type;
+        const char* help;
+        uint64_t (*value)(const ShmCoreRecord&);
+    };
+    static const Counter counters[] = {
+        {"aes5_validations_total", "counter", "Validations performed",
+         [](const ShmCoreRecord& r) { return r.metrics.total_validations; }},
+        {"aes5_validations_successful_total", "counter", "Validations that passed",
+         [](const ShmCoreRecord& r) { return r.metrics.successful_validations; }},
+        {"aes5_validations_failed_total", "counter", "Validations that failed",
+         [](const ShmCoreRecord& r) { return r.metrics.failed_validations; }},
+        {"aes5_deadline_violations_total", "counter", "Validations that exceeded the latency deadline",
+         [](const ShmCoreRecord& r) { return r.metrics.deadline_violations; }},
+        {"aes5_validation_max_latency_ns", "gauge", "Maximum validation latency in nanoseconds",
+         [](const ShmCoreRecord& r) { return r.metrics.max_latency_ns; }},
+    };
+
+    // Read every slot once so all metric families describe the same state
+    const size_t capacity = reader.slot_capacity();
+    std::unique_ptr<ShmCoreRecord[]> records(new ShmCoreRecord[capacity]);
+    std::unique_ptr<bool[]> active(new bool[capacity]);
+    for (size_t i = 0; i < capacity; ++i) {
+        active[i] = reader.read_slot(i, records[i]);
+    }
+
+    for (const Counter& counter : counters) {
+        std::printf("# HELP %s %s\n# TYPE %s %s\n", counter.name, counter.help, counter.name, counter.type);
+        for (size_t i = 0; i < capacity; ++i) {
+            if (active[i]) {
+                std::printf("%s{core=\"%s\"} %llu\n", counter.name, escape_label(records[i].name).c_str(),
+                            static_cast<unsigned long long>(counter.value(records[i])));
+            }
+        }
+    }
+
+    const char* histogram = "aes5_validation_latency_ns";
+    std::printf("# HELP %s Validation latency in nanoseconds\n# TYPE %s histogram\n", histogram, histogram);
+    for (size_t i = 0; i < capacity; ++i) {
+        if (!active[i] || !records[i].has_histogram) {
+            continue;
+        }
+        const std::string label = escape_label(records[i].name);
+        uint64_t cumulative = 0;
+        uint64_t sum = 0;
+        for (size_t bucket = 0; bucket < ShmHistogramLayout::BUCKET_COUNT; ++bucket) {
+            const uint64_t count = records[i].histogram[bucket];
+            if (count == 0) {
+                continue;   // Cumulative buckets may be sparse
+            }
+            cumulative += count;
+            const uint64_t lower = ShmHistogramLayout::lower_bound(bucket);
+            sum += count * (lower + (ShmHistogramLayout::upper_bound(bucket) - lower) / 2);
+            if (bucket + 1 == ShmHistogramLayout::BUCKET_COUNT) {
+                break;   // Holds clamped values: only +Inf bounds it
+            }
+            std::printf("%s_bucket{core=\"%s\",le=\"%llu\"} %llu\n", histogram, label.c_str(),
+                        static_cast<unsigned long long>(ShmHistogramLayout::upper_bound(bucket)),
+                        static_cast<unsigned long long>(cumulative));
+        }
+        std::printf("%s_bucket{core=\"%s\",le=\"+Inf\"} %llu\n", histogram, label.c_str(),
+                    static_cast<unsigned long long>(cumulative));
+        std::printf("%s_sum{core=\"%s\"} %llu\n", histogram, label.c_str(),
+                    static_cast<unsigned long long>(sum));
+        std::printf("%s_count{core=\"%s\"} %llu\n", histogram, label.c_str(),
+                    static_cast<unsigned long long>(cumulative));
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const char* segment = DEFAULT_SHM_SEGMENT_NAME;
+    bool prometheus = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--segment") == 0 && i + 1 < argc) {
+            segment = argv[++i];
+        } else if (std::strcmp(argv[i], "--prometheus") == 0) {
+            prometheus = true;
+        } else {
+            print_usage(argv[0]);
+            return 2;
+        }
+    }
+
+    auto reader = MetricsShmReader::open(segment);
+    if (!reader) {
+        std::cerr << "Cannot open metrics segment " << segment
+                  << " (not exported, or created by an incompatible version)\n";
+        return 1;
+    }
+
+    if (prometheus) {
+        print_prometheus(*reader);
+    } else {
+        print_table(*reader);
+    }
+    return 0;
+}